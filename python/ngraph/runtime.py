@@ -20,12 +20,16 @@ from typing import List, Union
 import numpy as np
 
 from ngraph.impl import Function, Node, Shape, serialize, util
+from ngraph.impl.op import Parameter
 from ngraph.impl.runtime import Backend, Tensor
-from ngraph.utils.types import get_dtype, NumericData
+from ngraph.utils.types import get_dtype, NgraphType, NumericData
 from ngraph.exceptions import UserInputError
 
 log = logging.getLogger(__name__)
 
+# Backends whose tensors live in host memory and may therefore wrap numpy buffers
+HOST_MEMORY_BACKENDS = ('CPU', 'INTERPRETER')
+
 
 def runtime(backend_name='CPU'):  # type: (str) -> 'Runtime'
     """Create a Runtime object (helper factory).
@@ -67,36 +71,51 @@ class Computation(object):
         self.runtime = runtime
         self.function = ng_function
         self.parameters = ng_function.get_parameters()
-
-        self.tensor_views = []  # type: List[Tensor]
-        for parameter in self.parameters:
-            shape = parameter.get_shape()
-            element_type = parameter.get_element_type()
-            self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
+        self.wrap_ndarrays = runtime.backend_name.split(':')[0] in HOST_MEMORY_BACKENDS
 
     def __repr__(self):  # type: () -> str
         params_string = ', '.join([param.name for param in self.parameters])
         return '<Computation: {}({})>'.format(self.function.get_name(), params_string)
 
-    def __call__(self, *input_values):  # type: (*NumericData) -> NumericData
-        """Run computation on input values and return result."""
-        for tensor_view, value in zip(self.tensor_views, input_values):
-            if not isinstance(value, np.ndarray):
-                value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
-
-        result_element_type = self.function.get_output_element_type(0)
-        result_shape = self.function.get_output_shape(0)
-        result_dtype = get_dtype(result_element_type)
-
-        result_view = self.runtime.backend.create_tensor(result_element_type, result_shape)
-        result_arr = np.empty(result_shape, dtype=result_dtype)
+    def __call__(self, *input_values):  # type: (*NumericData) -> Union[NumericData, List]
+        """Run computation on input values and return results.
 
-        self.runtime.backend.call(self.function, [result_view], self.tensor_views)
-
-        Computation._read_tensor_view_to_ndarray(result_view, result_arr)
-        result_arr = result_arr.reshape(result_shape)
-        return result_arr
+        On host memory backends, input arrays which are C-contiguous and of the parameter's type
+        are used by the backend in place, without copying, and results are written directly into
+        the returned arrays. Other backends copy the arrays to and from their own tensors. A
+        function with several outputs returns a list with one array per output.
+        """
+        # Keep the wrapped arrays referenced until the call has finished
+        input_arrays = [Computation._get_input_ndarray(parameter, value)
+                        for parameter, value in zip(self.parameters, input_values)]
+        input_tensors = [self._create_tensor_over_ndarray(parameter.get_element_type(),
+                                                          parameter.get_shape(),
+                                                          array)
+                         for parameter, array in zip(self.parameters, input_arrays)]
+
+        result_arrays = []  # type: List[np.ndarray]
+        result_tensors = []  # type: List[Tensor]
+        for index in range(self.function.get_output_size()):
+            result_element_type = self.function.get_output_element_type(index)
+            result_shape = self.function.get_output_shape(index)
+            result_array = np.empty(result_shape, dtype=get_dtype(result_element_type))
+            result_arrays.append(result_array)
+            if self.wrap_ndarrays:
+                result_tensors.append(self._create_tensor_over_ndarray(result_element_type,
+                                                                       result_shape,
+                                                                       result_array))
+            else:
+                result_tensors.append(self.runtime.backend.create_tensor(result_element_type,
+                                                                         result_shape))
+
+        self.runtime.backend.call(self.function, result_tensors, input_tensors)
+        if not self.wrap_ndarrays:
+            for result_tensor, result_array in zip(result_tensors, result_arrays):
+                result_tensor.read(util.numpy_to_c(result_array), 0, result_array.nbytes)
+
+        if len(result_arrays) == 1:
+            return result_arrays[0]
+        return result_arrays
 
     def serialize(self, indent=0):  # type: (int) -> str
         """Serialize function (compute graph) to a JSON string.
@@ -106,33 +125,37 @@ class Computation(object):
         """
         return serialize(self.function, indent)
 
-    @staticmethod
-    def _get_buffer_size(element_type, element_count):  # type: (Tensor, int) -> int
-        return int((element_type.bitwidth / 8.0) * element_count)
+    def _create_tensor_over_ndarray(self, element_type, shape, array):
+        # type: (NgraphType, Shape, np.ndarray) -> Tensor
+        """Return a backend tensor for the array.
+
+        Host memory backends use the array's memory as the tensor's buffer. Other backends, such
+        as GPU, would treat the pointer as device memory, so they get a tensor of their own
+        holding a copy of the array.
+        """
+        if self.wrap_ndarrays:
+            return self.runtime.backend.create_tensor(element_type, shape, array)
+        tensor = self.runtime.backend.create_tensor(element_type, shape)
+        tensor.write(util.numpy_to_c(array), 0, array.nbytes)
+        return tensor
 
     @staticmethod
-    def _write_ndarray_to_tensor_view(value, tensor_view):
-        # type: (np.ndarray, Tensor) -> None
-        tensor_view_dtype = get_dtype(tensor_view.element_type)
-        if list(tensor_view.shape) != list(value.shape) and len(value.shape) > 0:
-            raise UserInputError('Provided tensor\'s shape: %s does not match the expected: %s.',
-                                 list(value.shape), list(tensor_view.shape))
-        if value.dtype != tensor_view_dtype:
+    def _get_input_ndarray(parameter, value):  # type: (Parameter, NumericData) -> np.ndarray
+        """Return the value as a C-contiguous array of the parameter's type and shape.
+
+        Arrays which already satisfy this are returned as they are, other values are copied.
+        """
+        parameter_shape = list(parameter.get_shape())
+        parameter_dtype = get_dtype(parameter.get_element_type())
+        value = np.asarray(value)
+        if list(value.shape) != parameter_shape:
+            if len(value.shape) > 0:
+                raise UserInputError('Provided tensor\'s shape: %s does not match the '
+                                     'expected: %s.', list(value.shape), parameter_shape)
+            value = np.broadcast_to(value, parameter_shape)
+        if value.dtype != parameter_dtype:
             log.warning(
                 'Attempting to write a %s value to a %s tensor. Will attempt type conversion.',
                 value.dtype,
-                tensor_view.element_type)
-            value = value.astype(tensor_view_dtype)
-
-        buffer_size = Computation._get_buffer_size(
-            tensor_view.element_type, tensor_view.element_count)
-
-        nparray = np.ascontiguousarray(value)
-        tensor_view.write(util.numpy_to_c(nparray), 0, buffer_size)
-
-    @staticmethod
-    def _read_tensor_view_to_ndarray(tensor_view, output):
-        # type: (Tensor, np.ndarray) -> None
-        buffer_size = Computation._get_buffer_size(
-            tensor_view.element_type, tensor_view.element_count)
-        tensor_view.read(util.numpy_to_c(output), 0, buffer_size)
+                parameter.get_element_type())
+        return np.ascontiguousarray(value, dtype=parameter_dtype)
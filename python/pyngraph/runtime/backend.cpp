@@ -17,6 +17,8 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <stdexcept>
+
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "pyngraph/runtime/backend.hpp"
@@ -34,15 +36,44 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    // The tensor uses the buffer's memory directly, so the buffer object is kept
+    // alive for as long as the tensor is
+    backend.def("create_tensor",
+                [](ngraph::runtime::Backend& self,
+                   const ngraph::element::Type& element_type,
+                   const ngraph::Shape& shape,
+                   py::buffer buffer) {
+                    py::buffer_info info = buffer.request();
+                    size_t byte_size = ngraph::shape_size(shape) * element_type.size();
+                    if (static_cast<size_t>(info.size * info.itemsize) != byte_size)
+                    {
+                        throw std::invalid_argument(
+                            "Buffer size does not match the size of the tensor");
+                    }
+                    ssize_t stride = info.itemsize;
+                    for (ssize_t i = info.ndim - 1; i >= 0; i--)
+                    {
+                        if (info.shape[i] != 1 && info.strides[i] != stride)
+                        {
+                            throw std::invalid_argument("Buffer is not C-contiguous");
+                        }
+                        stride *= info.shape[i];
+                    }
+                    return self.create_tensor(element_type, shape, info.ptr);
+                },
+                py::keep_alive<0, 4>());
     backend.def("compile",
-                (void (ngraph::runtime::Backend::*)(std::shared_ptr<ngraph::Function>)) &
+                (bool (ngraph::runtime::Backend::*)(std::shared_ptr<ngraph::Function>)) &
                     ngraph::runtime::Backend::compile);
+    // Tensor arguments are converted before the GIL is released, execution
+    // itself does not touch Python objects
     backend.def("call",
-                (void (ngraph::runtime::Backend::*)(
+                (bool (ngraph::runtime::Backend::*)(
                     std::shared_ptr<ngraph::Function>,
                     const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&,
                     const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&)) &
-                    ngraph::runtime::Backend::call);
+                    ngraph::runtime::Backend::call,
+                py::call_guard<py::gil_scoped_release>());
     backend.def("remove_compiled_function",
                 (void (ngraph::runtime::Backend::*)(std::shared_ptr<ngraph::Function>)) &
                     ngraph::runtime::Backend::remove_compiled_function);
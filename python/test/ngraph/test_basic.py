@@ -173,6 +173,35 @@ def test_bad_data_shape():
         computation(value_a, value_b)
 
 
+def test_multiple_outputs():
+    runtime = get_runtime()
+    dtype = np.float32
+    parameter_a = ng.parameter([2, 2], dtype=dtype, name='A')
+    parameter_b = ng.parameter([2, 2], dtype=dtype, name='B')
+    func = Function(NodeVector([parameter_a + parameter_b, parameter_a * parameter_b]),
+                    [parameter_a, parameter_b], 'add_and_mul')
+    computation = runtime.computation(func)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=dtype)
+    value_b = np.array([[5, 6], [7, 8]], dtype=dtype)
+    sum_result, product_result = computation(value_a, value_b)
+    assert np.allclose(sum_result, value_a + value_b)
+    assert np.allclose(product_result, value_a * value_b)
+
+
+def test_non_contiguous_input():
+    runtime = get_runtime()
+    dtype = np.float32
+    parameter_a = ng.parameter([2, 2], dtype=dtype, name='A')
+    computation = runtime.computation(ng.negative(parameter_a), parameter_a)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=dtype)
+    first_result = computation(value_a.T)
+    second_result = computation(value_a)
+    assert np.allclose(first_result, -value_a.T)
+    assert np.allclose(second_result, -value_a)
+
+
 def test_constant_get_data_bool():
     input_data = np.array([True, False, False, True])
     node = ng.constant(input_data, dtype=np.bool)
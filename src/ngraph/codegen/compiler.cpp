@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <fstream>
 #include <iostream>
+#include <sstream>
 
 #include <clang/Basic/DiagnosticOptions.h>
 #include <clang/Basic/TargetInfo.h>
@@ -33,13 +35,18 @@
 #include <clang/Lex/Preprocessor.h>
 #include <clang/Lex/PreprocessorOptions.h>
 #include <llvm/ADT/Statistic.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/ExecutionEngine/MCJIT.h> // forces JIT to link in
+#include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/LinkAllPasses.h>
 #include <llvm/Option/Arg.h>
 #include <llvm/Option/ArgList.h>
 #include <llvm/Option/OptTable.h>
 #include <llvm/Support/ErrorHandling.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/ManagedStatic.h>
 #include <llvm/Support/Signals.h>
 #include <llvm/Support/TargetSelect.h>
@@ -108,9 +115,27 @@ std::unique_ptr<llvm::Module> codegen::Module::take_module()
     return move(m_module);
 }
 
+bool codegen::Module::write_bitcode(const std::string& path) const
+{
+    std::error_code ec;
+    raw_fd_ostream out(path, ec, sys::fs::F_None);
+    if (ec)
+    {
+        return false;
+    }
+    WriteBitcodeToFile(m_module.get(), out);
+    out.close();
+    return !out.has_error();
+}
+
 codegen::Compiler::Compiler()
     : m_compiler_core{}
 {
+    const char* cache_directory = std::getenv("NGRAPH_CODEGEN_CACHE_DIR");
+    if (cache_directory != nullptr)
+    {
+        m_cache_directory = cache_directory;
+    }
 }
 
 codegen::Compiler::~Compiler()
@@ -131,6 +156,21 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
 
 std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
 {
+    string cache_key;
+    string cache_path;
+    if (!m_cache_directory.empty())
+    {
+        cache_key = get_cache_key(source);
+        stringstream ss;
+        ss << hex << std::hash<string>()(cache_key);
+        cache_path = file_util::path_join(m_cache_directory, ss.str());
+        auto cached_module = load_cached_module(cache_path, cache_key);
+        if (cached_module)
+        {
+            return cached_module;
+        }
+    }
+
     // lock_guard<mutex> lock(m_mutex);
     CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
     if (!compiler_info.compiler)
@@ -143,9 +183,106 @@ std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& s
         compiler_info.compiler->set_precompiled_header_source(m_precompiled_header_source);
     }
     auto rc = compiler_info.compiler->compile(m_compiler_action, source);
+    if (rc && !cache_path.empty())
+    {
+        store_cached_module(*rc, cache_path, cache_key);
+    }
     return rc;
 }
 
+string codegen::Compiler::get_cache_key(const string& source) const
+{
+    // Everything that changes the generated module. The source is generated
+    // from the graph after all passes ran, so it already reflects the pass
+    // configuration.
+    stringstream ss;
+    ss << "version: " << NGRAPH_VERSION << "\n";
+    ss << "cpu: " << sys::getHostCPUName().str() << "\n";
+    ss << "debuginfo: " << (std::getenv("NGRAPH_COMPILER_DEBUGINFO_ENABLE") != nullptr) << "\n";
+    for (const string& path : m_header_search_paths)
+    {
+        ss << "search path: " << path << "\n";
+    }
+    ss << m_precompiled_header_source << "\n";
+    ss << source;
+    return ss.str();
+}
+
+unique_ptr<codegen::Module> codegen::Compiler::load_cached_module(const string& path,
+                                                                  const string& key)
+{
+    string key_path = path + ".key";
+    string bitcode_path = path + ".bc";
+    if (!file_util::exists(key_path) || !file_util::exists(bitcode_path) ||
+        file_util::read_file_to_string(key_path) != key)
+    {
+        return nullptr;
+    }
+
+    auto buffer = MemoryBuffer::getFile(bitcode_path);
+    if (!buffer)
+    {
+        return nullptr;
+    }
+    if (!m_cache_context)
+    {
+        m_cache_context.reset(new LLVMContext());
+    }
+    auto module = parseBitcodeFile((*buffer)->getMemBufferRef(), *m_cache_context);
+    if (!module)
+    {
+        consumeError(module.takeError());
+        NGRAPH_WARN << "Ignoring unreadable codegen cache entry " << bitcode_path;
+        return nullptr;
+    }
+    NGRAPH_DEBUG << "Loaded compiled module from " << bitcode_path;
+    return unique_ptr<codegen::Module>(new codegen::Module(move(*module)));
+}
+
+void codegen::Compiler::store_cached_module(const codegen::Module& module,
+                                            const string& path,
+                                            const string& key)
+{
+    if (!file_util::exists(m_cache_directory))
+    {
+        file_util::make_directory(m_cache_directory);
+    }
+
+    // Write under unique names and rename into place so that processes
+    // sharing the cache never read a partially written entry. The key file
+    // is renamed last and marks the entry as complete.
+    int fd;
+    SmallString<128> bitcode_tmp;
+    SmallString<128> key_tmp;
+    if (sys::fs::createUniqueFile(path + "-%%%%%%.bc.tmp", bitcode_tmp))
+    {
+        NGRAPH_WARN << "Unable to write codegen cache entry in " << m_cache_directory;
+        return;
+    }
+    if (!module.write_bitcode(bitcode_tmp.str().str()))
+    {
+        sys::fs::remove(bitcode_tmp);
+        NGRAPH_WARN << "Unable to write codegen cache entry in " << m_cache_directory;
+        return;
+    }
+    if (sys::fs::createUniqueFile(path + "-%%%%%%.key.tmp", fd, key_tmp))
+    {
+        sys::fs::remove(bitcode_tmp);
+        NGRAPH_WARN << "Unable to write codegen cache entry in " << m_cache_directory;
+        return;
+    }
+    {
+        raw_fd_ostream out(fd, true);
+        out << key;
+    }
+    if (sys::fs::rename(bitcode_tmp, path + ".bc") || sys::fs::rename(key_tmp, path + ".key"))
+    {
+        sys::fs::remove(bitcode_tmp);
+        sys::fs::remove(key_tmp);
+        NGRAPH_WARN << "Unable to write codegen cache entry in " << m_cache_directory;
+    }
+}
+
 static std::string GetExecutablePath(const char* Argv0)
 {
     // This just needs to be some symbol in the binary; C++ doesn't
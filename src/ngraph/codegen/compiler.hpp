@@ -39,6 +39,7 @@ namespace clang
 namespace llvm
 {
     class Module;
+    class LLVMContext;
 }
 
 class ngraph::codegen::Module
@@ -47,6 +48,7 @@ public:
     Module(std::unique_ptr<llvm::Module> module);
     ~Module();
     std::unique_ptr<llvm::Module> take_module();
+    bool write_bitcode(const std::string& path) const;
 
 private:
     std::unique_ptr<llvm::Module> m_module;
@@ -62,10 +64,21 @@ public:
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
 private:
+    std::string get_cache_key(const std::string& source) const;
+    std::unique_ptr<ngraph::codegen::Module> load_cached_module(const std::string& path,
+                                                                const std::string& key);
+    void store_cached_module(const ngraph::codegen::Module& module,
+                             const std::string& path,
+                             const std::string& key);
+
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
     std::shared_ptr<CompilerCore> m_compiler_core;
     std::string m_precompiled_header_source;
     std::vector<std::string> m_header_search_paths;
+    // Compiled modules are cached here when NGRAPH_CODEGEN_CACHE_DIR is set
+    std::string m_cache_directory;
+    // Owns the modules loaded from the cache, must outlive their execution engine
+    std::unique_ptr<llvm::LLVMContext> m_cache_context;
 };
 
 class ngraph::codegen::CompilerCore
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+
 #include "ngraph/cpio.hpp"
 #include "ngraph/log.hpp"
 
@@ -115,10 +117,10 @@ cpio::Header cpio::Header::read(istream& stream)
     return rc;
 }
 
-void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
+void cpio::Header::write(ostream& stream, const string& name, uint32_t size, uint16_t name_padding)
 {
     // namesize includes the null string terminator so + 1
-    uint16_t namesize = static_cast<uint16_t>(name.size()) + 1;
+    uint16_t namesize = static_cast<uint16_t>(name.size() + 1 + name_padding);
     write_u16(stream, 0x71C7);   // magic
     write_u16(stream, 0);        // dev
     write_u16(stream, 0);        // ino
@@ -130,11 +132,21 @@ void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
     write_u32(stream, 0);        // mtime
     write_u16(stream, namesize); // namesize
     write_u32(stream, size);     // filesize
-    stream.write(name.c_str(), namesize + (namesize % 2));
+    stream.write(name.c_str(), name.size() + 1);
+    // Readers stop at the first null, the rest of the name field is padding
+    string padding(name_padding + (namesize % 2), '\0');
+    stream.write(padding.data(), padding.size());
+}
+
+size_t cpio::Header::get_size(uint16_t namesize)
+{
+    // The fixed fields take 26 bytes and the name is padded to an even length
+    return 26 + namesize + (namesize % 2);
 }
 
 cpio::Writer::Writer()
     : m_stream(nullptr)
+    , m_position(0)
 {
 }
 
@@ -158,11 +170,13 @@ cpio::Writer::~Writer()
 void cpio::Writer::open(ostream& out)
 {
     m_stream = &out;
+    m_position = 0;
 }
 
 void cpio::Writer::open(const string& filename)
 {
     m_stream = &m_my_stream;
+    m_position = 0;
     m_my_stream.open(filename, ios_base::binary | ios_base::out);
 }
 
@@ -175,17 +189,34 @@ void cpio::Writer::close()
     }
 }
 
-void cpio::Writer::write(const string& record_name, const void* data, uint32_t size_in_bytes)
+void cpio::Writer::write(const string& record_name,
+                         const void* data,
+                         uint32_t size_in_bytes,
+                         size_t alignment)
 {
     if (m_stream)
     {
-        Header::write(*m_stream, record_name, size_in_bytes);
+        // The data follows the name, so the name is padded with nulls until the data lands on
+        // a multiple of alignment from the start of the archive. Every entry has an even size,
+        // so odd alignments are as good as 1 and only even alignments need padding.
+        uint16_t namesize = static_cast<uint16_t>(record_name.size() + 1);
+        uint16_t name_padding = 0;
+        if (alignment > 2 && alignment % 2 == 0)
+        {
+            while ((m_position + Header::get_size(namesize + name_padding)) % alignment != 0)
+            {
+                name_padding++;
+            }
+        }
+        Header::write(*m_stream, record_name, size_in_bytes, name_padding);
         m_stream->write(static_cast<const char*>(data), size_in_bytes);
         if (size_in_bytes % 2)
         {
             char ch = 0;
             m_stream->write(&ch, 1);
         }
+        m_position += Header::get_size(namesize + name_padding) + size_in_bytes +
+                      (size_in_bytes % 2);
     }
     else
     {
@@ -244,8 +275,8 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
 
             auto buffer = new char[header.namesize];
             m_stream->read(buffer, header.namesize);
-            // namesize includes the null string terminator so -1
-            string file_name = string(buffer, header.namesize - 1);
+            // namesize includes the null string terminator and any padding after it
+            string file_name = string(buffer, strnlen(buffer, header.namesize));
             delete[] buffer;
             // skip any pad characters
             if (header.namesize % 2)
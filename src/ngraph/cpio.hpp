@@ -54,7 +54,12 @@ public:
     uint32_t filesize;
 
     static Header read(std::istream&);
-    static void write(std::ostream&, const std::string& name, uint32_t size);
+    static void write(std::ostream&,
+                      const std::string& name,
+                      uint32_t size,
+                      uint16_t name_padding = 0);
+    // Bytes from the start of a header to the start of its file data
+    static size_t get_size(uint16_t namesize);
 
 private:
 };
@@ -89,11 +94,18 @@ public:
     void open(std::ostream& out);
     void open(const std::string& filename);
     void close();
-    void write(const std::string& file_name, const void* data, uint32_t size_in_bytes);
+    // The file data is placed at a multiple of alignment bytes from the start of the archive,
+    // by padding the file name with nulls
+    void write(const std::string& file_name,
+               const void* data,
+               uint32_t size_in_bytes,
+               size_t alignment = 2);
 
 private:
     std::ostream* m_stream;
     std::ofstream m_my_stream;
+    // Bytes written since the archive was opened
+    size_t m_position;
 };
 
 class ngraph::cpio::Reader
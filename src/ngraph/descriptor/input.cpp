@@ -16,6 +16,7 @@
 
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -37,6 +38,7 @@ void Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    ModifiedNodeTracker::record(m_node, m_src_node);
 
     static const auto nerc = std::getenv("NGRAPH_ENABLE_REPLACE_CHECK");
 
@@ -21,7 +21,7 @@ namespace ngraph
 {
     namespace onnx_import
     {
-        Graph::Graph(const onnx::GraphProto& graph_proto)
+        Graph::Graph(const onnx::GraphProto& graph_proto, const Weights& weights)
             : m_graph_proto{&graph_proto}
         {
             for (const auto& tensor : m_graph_proto->initializer())
@@ -37,7 +37,7 @@ namespace ngraph
             {
                 m_inputs.emplace_back(input);
                 m_ng_node_cache[input.name()] =
-                    m_inputs.back().get_ng_node(m_parameters, m_initializers);
+                    m_inputs.back().get_ng_node(m_parameters, m_initializers, weights);
             }
 
             for (const auto& output : m_graph_proto->output())
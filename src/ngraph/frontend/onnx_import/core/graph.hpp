@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "ngraph/frontend/onnx_import/onnx.hpp"
 #include "ngraph/op/parameter_vector.hpp"
 
 #include "value_info.hpp"
@@ -31,7 +32,7 @@ namespace ngraph
         class Graph
         {
         public:
-            explicit Graph(const onnx::GraphProto& proto);
+            explicit Graph(const onnx::GraphProto& proto, const Weights& weights = {});
 
             const std::vector<Node>& get_nodes() const { return m_nodes; }
             const std::vector<ValueInfo>& get_inputs() const { return m_inputs; }
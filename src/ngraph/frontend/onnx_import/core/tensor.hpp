@@ -81,6 +81,15 @@ namespace ngraph
                     }
                 };
 
+                struct external_data_unsupported : ngraph_error
+                {
+                    external_data_unsupported()
+                        : ngraph_error{"tensor data stored in an external file can only be "
+                                       "loaded from a model file path"}
+                    {
+                    }
+                };
+
             } // namespace tensor
 
         } // namespace error
@@ -260,6 +269,10 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (has_external_data())
+                {
+                    throw error::tensor::external_data_unsupported{};
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -307,6 +320,15 @@ namespace ngraph
                 }
             }
 
+            bool has_raw_data() const { return m_tensor_proto->has_raw_data(); }
+            const std::string& get_raw_data() const { return m_tensor_proto->raw_data(); }
+            bool has_external_data() const
+            {
+                return m_tensor_proto->has_data_location() &&
+                       m_tensor_proto->data_location() ==
+                           onnx::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
+            }
+
             operator onnx::TensorProto_DataType() const { return m_tensor_proto->data_type(); }
         private:
             const onnx::TensorProto* m_tensor_proto;
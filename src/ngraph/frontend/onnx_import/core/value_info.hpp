@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <cstdint>
+
+#include "ngraph/frontend/onnx_import/onnx.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/parameter_vector.hpp"
 #include "ngraph/shape.hpp"
@@ -104,8 +107,20 @@ namespace ngraph
 
             std::shared_ptr<ngraph::Node>
                 get_ng_node(op::ParameterVector& parameters,
-                            const std::map<std::string, Tensor>& initializers) const
+                            const std::map<std::string, Tensor>& initializers,
+                            const Weights& weights = {}) const
             {
+                const auto weight = weights.find(get_name());
+                if (weight != std::end(weights))
+                {
+                    const Weight& w = weight->second;
+                    if (w.owner != nullptr &&
+                        reinterpret_cast<std::uintptr_t>(w.data) % w.type.size() == 0)
+                    {
+                        return std::make_shared<op::Constant>(w.type, w.shape, w.data, w.owner);
+                    }
+                    return std::make_shared<op::Constant>(w.type, w.shape, w.data);
+                }
                 const auto it = initializers.find(get_name());
                 if (it != std::end(initializers))
                 {
@@ -126,6 +141,16 @@ namespace ngraph
 
             std::shared_ptr<op::Constant> get_ng_constant(const Tensor& tensor) const
             {
+                // Raw data already has the layout of the constant, copy it once instead of
+                // converting it through a vector
+                if (tensor.has_raw_data() && tensor.get_type() != Tensor::Type::float16 &&
+                    tensor.get_ng_type() == get_element_type() &&
+                    tensor.get_raw_data().size() ==
+                        shape_size(m_shape) * get_element_type().size())
+                {
+                    return std::make_shared<op::Constant>(
+                        get_element_type(), m_shape, tensor.get_raw_data().data());
+                }
                 switch (m_value_info_proto->type().tensor_type().elem_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL:
@@ -15,8 +15,11 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <limits>
 
 #include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/mapped_file.hpp"
 
 #include "core/graph.hpp"
 #include "core/model.hpp"
@@ -39,6 +42,14 @@ namespace ngraph
                     }
                 };
 
+                struct file_parse : ngraph_error
+                {
+                    explicit file_parse(const std::string& path)
+                        : ngraph_error{"failure parsing model from file:" + path}
+                    {
+                    }
+                };
+
                 struct stream_parse : ngraph_error
                 {
                     explicit stream_parse(std::istream&)
@@ -47,8 +58,114 @@ namespace ngraph
                     }
                 };
 
+                struct invalid_external_data : ngraph_error
+                {
+                    invalid_external_data(const std::string& tensor, const std::string& reason)
+                        : ngraph_error{"invalid external data of tensor " + tensor + ": " +
+                                       reason}
+                    {
+                    }
+                };
+
             } // namespace error
-        }     // namespace detail
+
+            using MappedFiles = std::map<std::string, std::shared_ptr<MappedFile>>;
+
+            // Maps the external data files of the initializers and returns the initializers as
+            // weights pointing into the mappings, which are kept in files. With share set the
+            // weights also own their mapping, so the Constants made from them are views.
+            Weights map_external_data(const onnx::ModelProto& model_proto,
+                                      const std::string& model_path,
+                                      MappedFiles& files,
+                                      bool share)
+            {
+                std::string model_dir;
+                if (model_path.find_last_of('/') != std::string::npos)
+                {
+                    model_dir = file_util::get_directory(model_path);
+                }
+
+                Weights weights;
+                for (const auto& tensor_proto : model_proto.graph().initializer())
+                {
+                    Tensor tensor{tensor_proto};
+                    if (!tensor.has_external_data())
+                    {
+                        continue;
+                    }
+                    std::string location;
+                    std::size_t offset = 0;
+                    std::size_t length = std::numeric_limits<std::size_t>::max();
+                    for (const auto& entry : tensor_proto.external_data())
+                    {
+                        if (entry.key() == "location")
+                        {
+                            location = entry.value();
+                        }
+                        else if (entry.key() == "offset")
+                        {
+                            offset = std::stoull(entry.value());
+                        }
+                        else if (entry.key() == "length")
+                        {
+                            length = std::stoull(entry.value());
+                        }
+                    }
+                    if (location.empty())
+                    {
+                        throw error::invalid_external_data{tensor.get_name(), "no location"};
+                    }
+                    if (tensor.get_type() == Tensor::Type::float16)
+                    {
+                        throw error::invalid_external_data{tensor.get_name(),
+                                                           "float16 data is not supported"};
+                    }
+
+                    std::shared_ptr<MappedFile>& file = files[location];
+                    if (file == nullptr)
+                    {
+                        file = std::make_shared<MappedFile>(
+                            file_util::path_join(model_dir, location));
+                    }
+                    const element::Type& type = tensor.get_ng_type();
+                    std::size_t size = shape_size(tensor.get_shape()) * type.size();
+                    if (length != std::numeric_limits<std::size_t>::max() && length != size)
+                    {
+                        throw error::invalid_external_data{
+                            tensor.get_name(), "length does not match the shape and type"};
+                    }
+                    if (offset > file->size() || size > file->size() - offset)
+                    {
+                        throw error::invalid_external_data{tensor.get_name(),
+                                                           "data exceeds " + location};
+                    }
+                    const char* data = file->get_data() + offset;
+                    weights.emplace(tensor.get_name(),
+                                    Weight{type,
+                                           tensor.get_shape(),
+                                           data,
+                                           share ? std::shared_ptr<const void>(file, data)
+                                                 : nullptr});
+                }
+                return weights;
+            }
+
+            std::vector<std::shared_ptr<Function>>
+                convert_model(const onnx::ModelProto& model_proto, const Weights& weights)
+            {
+                std::vector<std::shared_ptr<Function>> output_functions;
+                Model model{model_proto};
+                Graph graph{model_proto.graph(), weights};
+                for (const auto& output : graph.get_outputs())
+                {
+                    output_functions.emplace_back(
+                        std::make_shared<Function>(graph.get_ng_node_from_cache(output.get_name()),
+                                                   graph.get_ng_parameters()));
+                }
+                return output_functions;
+            }
+
+        } // namespace detail
 
         std::vector<std::shared_ptr<Function>> load_onnx_model(std::istream& sin)
         {
@@ -57,15 +174,7 @@ namespace ngraph
             {
                 throw detail::error::stream_parse{sin};
             }
-            std::vector<std::shared_ptr<Function>> output_functions;
-            Model model{model_proto};
-            Graph graph{model_proto.graph()};
-            for (const auto& output : graph.get_outputs())
-            {
-                output_functions.emplace_back(std::make_shared<Function>(
-                    graph.get_ng_node_from_cache(output.get_name()), graph.get_ng_parameters()));
-            }
-            return output_functions;
+            return detail::convert_model(model_proto, {});
         }
 
         std::vector<std::shared_ptr<Function>> load_onnx_model(const std::string& path)
@@ -75,7 +184,62 @@ namespace ngraph
             {
                 throw detail::error::file_open{path};
             }
-            return load_onnx_model(ifs);
+            onnx::ModelProto model_proto;
+            if (!model_proto.ParseFromIstream(&ifs))
+            {
+                throw detail::error::stream_parse{ifs};
+            }
+            // The external data is copied into the Constants, the mappings are released on return
+            detail::MappedFiles files;
+            return detail::convert_model(
+                model_proto, detail::map_external_data(model_proto, path, files, false));
+        }
+
+        std::vector<std::shared_ptr<Function>> load_onnx_model_mapped(const std::string& path)
+        {
+            onnx::ModelProto model_proto;
+            {
+                // Protobuf copies the fields it keeps, so the model file is only needed while
+                // parsing
+                MappedFile file{path};
+                if (file.size() > static_cast<std::size_t>(std::numeric_limits<int>::max()) ||
+                    !model_proto.ParseFromArray(file.get_data(), static_cast<int>(file.size())))
+                {
+                    throw detail::error::file_parse{path};
+                }
+            }
+            detail::MappedFiles files;
+            return detail::convert_model(
+                model_proto, detail::map_external_data(model_proto, path, files, true));
+        }
+
+        ModelFunction import_onnx_model(std::istream& sin, const Weights& weights)
+        {
+            onnx::ModelProto model_proto;
+            if (!model_proto.ParseFromIstream(&sin))
+            {
+                throw detail::error::stream_parse{sin};
+            }
+            Model model{model_proto};
+            Graph graph{model_proto.graph(), weights};
+
+            ModelFunction model_function;
+            NodeVector outputs;
+            for (const auto& output : graph.get_outputs())
+            {
+                outputs.push_back(graph.get_ng_node_from_cache(output.get_name()));
+                model_function.output_names.push_back(output.get_name());
+            }
+            for (const auto& input : graph.get_inputs())
+            {
+                if (graph.get_ng_node_from_cache(input.get_name())->is_parameter())
+                {
+                    model_function.input_names.push_back(input.get_name());
+                }
+            }
+            model_function.function =
+                std::make_shared<Function>(outputs, graph.get_ng_parameters());
+            return model_function;
         }
 
         std::shared_ptr<Function> import_onnx_function(std::istream& sin)
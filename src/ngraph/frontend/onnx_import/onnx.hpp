@@ -17,26 +17,64 @@
 #pragma once
 
 #include <iostream>
+#include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "ngraph/function.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/element_type.hpp"
 
 namespace ngraph
 {
     namespace onnx_import
     {
+        // Data supplied by the caller for a graph input, used instead of an initializer
+        struct Weight
+        {
+            element::Type type;
+            Shape shape;
+            const void* data;
+            // When set, keeps data alive and the Constant is a view of data instead of a copy
+            std::shared_ptr<const void> owner;
+        };
+
+        using Weights = std::map<std::string, Weight>;
+
+        // An ONNX model converted to a single nGraph Function
+        struct ModelFunction
+        {
+            std::shared_ptr<Function> function;
+            // Names of the graph inputs and outputs in the order of the function's
+            // parameters and results
+            std::vector<std::string> input_names;
+            std::vector<std::string> output_names;
+        };
+
         // Convert on ONNX model to a vector of nGraph Functions (input stream)
         std::vector<std::shared_ptr<Function>> load_onnx_model(std::istream&);
 
-        // Convert an ONNX model to a vector of nGraph Functions
+        // Convert an ONNX model to a vector of nGraph Functions. Initializers stored in external
+        // data files are read relative to the directory of the model.
         std::vector<std::shared_ptr<Function>> load_onnx_model(const std::string&);
 
+        // Convert an ONNX model to a vector of nGraph Functions, memory mapping the model and its
+        // external data files. Initializers stored in external data files become read-only
+        // Constants backed by the mapping, which stays alive as long as they do; those files
+        // must not be modified until then.
+        std::vector<std::shared_ptr<Function>> load_onnx_model_mapped(const std::string&);
+
         // Convert the first output of an ONNX model to an nGraph Function (input stream)
         std::shared_ptr<Function> import_onnx_function(std::istream&);
 
         // Convert the first output of an ONNX model to an nGraph Function
         std::shared_ptr<Function> import_onnx_function(const std::string&);
 
+        // Convert an ONNX model to one nGraph Function with a result for each graph output.
+        // Graph inputs named in weights become Constants holding a copy of the weight data.
+        ModelFunction import_onnx_model(std::istream&, const Weights& weights = {});
+
     } // namespace onnx_import
 
 } // namespace ngraph
@@ -47,11 +47,23 @@ namespace ngraph
             }
 
             const std::string& get_type() const { return m_type; }
+            std::shared_ptr<runtime::Tensor> create_tensor(const element::Type& element_type,
+                                                           const Shape& shape,
+                                                           void* memory_pointer) const
+            {
+                return get().create_tensor(element_type, shape, memory_pointer);
+            }
+
             bool compile(const std::shared_ptr<Function>& function) const
             {
                 return get().compile(function);
             }
 
+            void remove_compiled_function(const std::shared_ptr<Function>& function) const
+            {
+                get().remove_compiled_function(function);
+            }
+
             bool call(const std::shared_ptr<Function>& function,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) const
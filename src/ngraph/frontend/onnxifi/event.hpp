@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable> // std::condition_variable
+#include <mutex>              // std::mutex, std::unique_lock
+
+#include <onnxifi.h>
+
+#include "exceptions.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief ONNXIFI event, signalled exactly once. The status tells waiters
+        ///        whether the work the event stands for succeeded.
+        class Event
+        {
+        public:
+            Event(const Event&) = delete;
+            Event& operator=(const Event&) = delete;
+
+            Event(Event&&) = delete;
+            Event& operator=(Event&&) = delete;
+
+            Event() = default;
+
+            void signal(::onnxStatus status = ONNXIFI_STATUS_SUCCESS)
+            {
+                {
+                    std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                    if (m_signalled)
+                    {
+                        throw status::invalid_state{};
+                    }
+                    m_signalled = true;
+                    m_status = status;
+                }
+                m_signal.notify_all();
+            }
+
+            /// \brief Wait for the event and return the status it was signalled with
+            ::onnxStatus wait() const
+            {
+                std::unique_lock<decltype(m_mutex)> lock{m_mutex};
+                m_signal.wait(lock, [&] { return m_signalled; });
+                return m_status;
+            }
+
+            bool is_signalled() const
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                return m_signalled;
+            }
+
+        private:
+            mutable std::mutex m_mutex{};
+            mutable std::condition_variable m_signal{};
+            bool m_signalled{false};
+            ::onnxStatus m_status{ONNXIFI_STATUS_SUCCESS};
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
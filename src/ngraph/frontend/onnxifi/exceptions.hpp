@@ -0,0 +1,220 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <onnxifi.h>
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        namespace status
+        {
+            /// \brief Error reported to the ONNXIFI caller as the given status code
+            struct status_error
+            {
+                explicit status_error(::onnxStatus status)
+                    : m_status{status}
+                {
+                }
+
+                ::onnxStatus get_status() const { return m_status; }
+            private:
+                ::onnxStatus m_status;
+            };
+
+            struct invalid_backend : status_error
+            {
+                invalid_backend()
+                    : status_error{ONNXIFI_STATUS_INVALID_BACKEND}
+                {
+                }
+            };
+
+            struct invalid_graph : status_error
+            {
+                invalid_graph()
+                    : status_error{ONNXIFI_STATUS_INVALID_GRAPH}
+                {
+                }
+            };
+
+            struct invalid_event : status_error
+            {
+                invalid_event()
+                    : status_error{ONNXIFI_STATUS_INVALID_EVENT}
+                {
+                }
+            };
+
+            struct invalid_state : status_error
+            {
+                invalid_state()
+                    : status_error{ONNXIFI_STATUS_INVALID_STATE}
+                {
+                }
+            };
+
+            struct invalid_size : status_error
+            {
+                invalid_size()
+                    : status_error{ONNXIFI_STATUS_INVALID_SIZE}
+                {
+                }
+            };
+
+            struct invalid_pointer : status_error
+            {
+                invalid_pointer()
+                    : status_error{ONNXIFI_STATUS_INVALID_POINTER}
+                {
+                }
+            };
+
+            struct invalid_protobuf : status_error
+            {
+                invalid_protobuf()
+                    : status_error{ONNXIFI_STATUS_INVALID_PROTOBUF}
+                {
+                }
+            };
+
+            struct invalid_model : status_error
+            {
+                invalid_model()
+                    : status_error{ONNXIFI_STATUS_INVALID_MODEL}
+                {
+                }
+            };
+
+            struct invalid_fence_type : status_error
+            {
+                invalid_fence_type()
+                    : status_error{ONNXIFI_STATUS_INVALID_FENCE_TYPE}
+                {
+                }
+            };
+
+            struct invalid_name : status_error
+            {
+                invalid_name()
+                    : status_error{ONNXIFI_STATUS_INVALID_NAME}
+                {
+                }
+            };
+
+            struct invalid_shape : status_error
+            {
+                invalid_shape()
+                    : status_error{ONNXIFI_STATUS_INVALID_SHAPE}
+                {
+                }
+            };
+
+            struct invalid_datatype : status_error
+            {
+                invalid_datatype()
+                    : status_error{ONNXIFI_STATUS_INVALID_DATATYPE}
+                {
+                }
+            };
+
+            struct invalid_memory_type : status_error
+            {
+                invalid_memory_type()
+                    : status_error{ONNXIFI_STATUS_INVALID_MEMORY_TYPE}
+                {
+                }
+            };
+
+            struct invalid_memory_location : status_error
+            {
+                invalid_memory_location()
+                    : status_error{ONNXIFI_STATUS_INVALID_MEMORY_LOCATION}
+                {
+                }
+            };
+
+            struct unsupported_tag : status_error
+            {
+                unsupported_tag()
+                    : status_error{ONNXIFI_STATUS_UNSUPPORTED_TAG}
+                {
+                }
+            };
+
+            struct unsupported_fence_type : status_error
+            {
+                unsupported_fence_type()
+                    : status_error{ONNXIFI_STATUS_UNSUPPORTED_FENCE_TYPE}
+                {
+                }
+            };
+
+            struct unidentified_name : status_error
+            {
+                unidentified_name()
+                    : status_error{ONNXIFI_STATUS_UNIDENTIFIED_NAME}
+                {
+                }
+            };
+
+            struct mismatching_shape : status_error
+            {
+                mismatching_shape()
+                    : status_error{ONNXIFI_STATUS_MISMATCHING_SHAPE}
+                {
+                }
+            };
+
+            struct mismatching_datatype : status_error
+            {
+                mismatching_datatype()
+                    : status_error{ONNXIFI_STATUS_MISMATCHING_DATATYPE}
+                {
+                }
+            };
+
+            struct unsupported_datatype : status_error
+            {
+                unsupported_datatype()
+                    : status_error{ONNXIFI_STATUS_UNSUPPORTED_DATATYPE}
+                {
+                }
+            };
+
+            struct unsupported_operator : status_error
+            {
+                unsupported_operator()
+                    : status_error{ONNXIFI_STATUS_UNSUPPORTED_OPERATOR}
+                {
+                }
+            };
+
+            struct internal_error : status_error
+            {
+                internal_error()
+                    : status_error{ONNXIFI_STATUS_INTERNAL_ERROR}
+                {
+                }
+            };
+
+        } // namespace status
+
+    } // namespace onnxifi
+
+} // namespace ngraph
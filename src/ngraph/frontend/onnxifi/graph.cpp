@@ -0,0 +1,318 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm> // std::find
+#include <istream>   // std::istream
+#include <new>       // std::bad_alloc
+#include <streambuf> // std::streambuf
+
+#include "ngraph/except.hpp"
+#include "ngraph/frontend/onnx_import/onnx.hpp"
+#include "ngraph/log.hpp"
+
+#include "event.hpp"
+#include "exceptions.hpp"
+#include "graph.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        namespace
+        {
+            // Read-only stream over the caller's model buffer, so the model is
+            // parsed without being copied first
+            struct memory_buffer : std::streambuf
+            {
+                memory_buffer(const void* data, std::size_t size)
+                {
+                    char* begin = const_cast<char*>(static_cast<const char*>(data));
+                    setg(begin, begin, begin + size);
+                }
+            };
+
+            const element::Type& get_element_type(::onnxEnum data_type)
+            {
+                switch (data_type)
+                {
+                case ONNXIFI_DATATYPE_FLOAT32: return element::f32;
+                case ONNXIFI_DATATYPE_FLOAT64: return element::f64;
+                case ONNXIFI_DATATYPE_INT8: return element::i8;
+                case ONNXIFI_DATATYPE_INT16: return element::i16;
+                case ONNXIFI_DATATYPE_INT32: return element::i32;
+                case ONNXIFI_DATATYPE_INT64: return element::i64;
+                case ONNXIFI_DATATYPE_UINT8: return element::u8;
+                case ONNXIFI_DATATYPE_UINT16: return element::u16;
+                case ONNXIFI_DATATYPE_UINT32: return element::u32;
+                case ONNXIFI_DATATYPE_UINT64: return element::u64;
+                case ONNXIFI_DATATYPE_UNDEFINED: throw status::invalid_datatype{};
+                default: throw status::unsupported_datatype{};
+                }
+            }
+
+            void check_descriptor(const ::onnxTensorDescriptorV1& descriptor)
+            {
+                if (descriptor.tag != ONNXIFI_TAG_TENSOR_DESCRIPTOR_V1)
+                {
+                    throw status::unsupported_tag{};
+                }
+                if (descriptor.name == nullptr)
+                {
+                    throw status::invalid_name{};
+                }
+                if (descriptor.memoryType != ONNXIFI_MEMORY_TYPE_CPU)
+                {
+                    throw status::invalid_memory_type{};
+                }
+                if (descriptor.buffer == 0)
+                {
+                    throw status::invalid_memory_location{};
+                }
+                if ((descriptor.dimensions != 0) && (descriptor.shape == nullptr))
+                {
+                    throw status::invalid_shape{};
+                }
+            }
+
+            Shape get_shape(const ::onnxTensorDescriptorV1& descriptor)
+            {
+                return {descriptor.shape, descriptor.shape + descriptor.dimensions};
+            }
+
+            Event* get_event(const ::onnxMemoryFenceV1* fence)
+            {
+                if (fence == nullptr)
+                {
+                    throw status::invalid_pointer{};
+                }
+                if (fence->tag != ONNXIFI_TAG_MEMORY_FENCE_V1)
+                {
+                    throw status::unsupported_tag{};
+                }
+                if (fence->type != ONNXIFI_SYNCHRONIZATION_EVENT)
+                {
+                    if (fence->type == ONNXIFI_SYNCHRONIZATION_IMPLICIT)
+                    {
+                        throw status::unsupported_fence_type{};
+                    }
+                    throw status::invalid_fence_type{};
+                }
+                return reinterpret_cast<Event*>(fence->event);
+            }
+        }
+
+        Graph::Graph(const Backend& backend,
+                     const void* onnx_model,
+                     std::size_t onnx_model_size,
+                     std::uint32_t weights_count,
+                     const ::onnxTensorDescriptorV1* weight_descriptors)
+            : m_backend{backend}
+        {
+            onnx_import::Weights weights;
+            for (std::uint32_t i = 0; i < weights_count; ++i)
+            {
+                const auto& descriptor = weight_descriptors[i];
+                check_descriptor(descriptor);
+                weights.emplace(
+                    descriptor.name,
+                    onnx_import::Weight{get_element_type(descriptor.dataType),
+                                        get_shape(descriptor),
+                                        reinterpret_cast<const void*>(descriptor.buffer),
+                                        nullptr});
+            }
+
+            memory_buffer buffer{onnx_model, onnx_model_size};
+            std::istream sin{&buffer};
+            onnx_import::ModelFunction model;
+            try
+            {
+                model = onnx_import::import_onnx_model(sin, weights);
+            }
+            catch (const ngraph_error& e)
+            {
+                NGRAPH_ERR << "ONNXIFI: " << e.what();
+                throw status::invalid_model{};
+            }
+            m_function = model.function;
+            m_input_names = std::move(model.input_names);
+            m_output_names = std::move(model.output_names);
+            if (!m_backend.compile(m_function))
+            {
+                throw status::unsupported_operator{};
+            }
+            m_worker = std::thread{&Graph::process_runs, this};
+        }
+
+        Graph::~Graph()
+        {
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                m_stopping = true;
+            }
+            m_runs_changed.notify_one();
+            m_worker.join();
+            // The backend is shared with the other graphs, only this graph's function is released
+            m_backend.remove_compiled_function(m_function);
+        }
+
+        void Graph::process_runs()
+        {
+            while (true)
+            {
+                Run run;
+                {
+                    std::unique_lock<std::mutex> lock{m_mutex};
+                    m_runs_changed.wait(lock, [&] { return m_stopping || !m_runs.empty(); });
+                    if (m_runs.empty())
+                    {
+                        return;
+                    }
+                    run = std::move(m_runs.front());
+                    m_runs.pop_front();
+                }
+
+                // A failure signalled on the input fence is passed on without running
+                ::onnxStatus status = run.input_event->wait();
+                if (status == ONNXIFI_STATUS_SUCCESS)
+                {
+                    try
+                    {
+                        if (!m_backend.call(m_function, run.outputs, run.inputs))
+                        {
+                            status = ONNXIFI_STATUS_INTERNAL_ERROR;
+                        }
+                    }
+                    catch (const status::status_error& e)
+                    {
+                        status = e.get_status();
+                    }
+                    catch (const std::bad_alloc&)
+                    {
+                        status = ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
+                    }
+                    catch (const std::exception& e)
+                    {
+                        NGRAPH_ERR << "ONNXIFI: " << e.what();
+                        status = ONNXIFI_STATUS_INTERNAL_ERROR;
+                    }
+                }
+                run.output_event->signal(status);
+            }
+        }
+
+        std::vector<std::shared_ptr<runtime::Tensor>>
+            Graph::bind(const std::vector<std::string>& names,
+                        const std::vector<element::Type>& element_types,
+                        const std::vector<Shape>& shapes,
+                        std::uint32_t count,
+                        const ::onnxTensorDescriptorV1* descriptors) const
+        {
+            if (count != names.size())
+            {
+                throw status::invalid_size{};
+            }
+            if ((count != 0) && (descriptors == nullptr))
+            {
+                throw status::invalid_pointer{};
+            }
+            std::vector<std::shared_ptr<runtime::Tensor>> tensors(names.size());
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                const auto& descriptor = descriptors[i];
+                check_descriptor(descriptor);
+                auto it = std::find(std::begin(names), std::end(names), descriptor.name);
+                if (it == std::end(names))
+                {
+                    throw status::unidentified_name{};
+                }
+                auto index = static_cast<std::size_t>(it - std::begin(names));
+                if (tensors[index] != nullptr)
+                {
+                    throw status::invalid_name{};
+                }
+                if (get_element_type(descriptor.dataType) != element_types[index])
+                {
+                    throw status::mismatching_datatype{};
+                }
+                if (get_shape(descriptor) != shapes[index])
+                {
+                    throw status::mismatching_shape{};
+                }
+                void* buffer = reinterpret_cast<void*>(descriptor.buffer);
+                tensors[index] =
+                    m_backend.create_tensor(element_types[index], shapes[index], buffer);
+            }
+            return tensors;
+        }
+
+        void Graph::set_io(std::uint32_t inputs_count,
+                           const ::onnxTensorDescriptorV1* input_descriptors,
+                           std::uint32_t outputs_count,
+                           const ::onnxTensorDescriptorV1* output_descriptors)
+        {
+            std::vector<element::Type> input_types;
+            std::vector<Shape> input_shapes;
+            for (const auto& parameter : m_function->get_parameters())
+            {
+                input_types.push_back(parameter->get_element_type());
+                input_shapes.push_back(parameter->get_shape());
+            }
+            std::vector<element::Type> output_types;
+            std::vector<Shape> output_shapes;
+            for (std::size_t i = 0; i < m_function->get_output_size(); ++i)
+            {
+                output_types.push_back(m_function->get_output_element_type(i));
+                output_shapes.push_back(m_function->get_output_shape(i));
+            }
+
+            // Bind everything before replacing the current binding so that a
+            // failure leaves the graph as it was
+            auto inputs =
+                bind(m_input_names, input_types, input_shapes, inputs_count, input_descriptors);
+            auto outputs = bind(
+                m_output_names, output_types, output_shapes, outputs_count, output_descriptors);
+
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_inputs = std::move(inputs);
+            m_outputs = std::move(outputs);
+            m_io_set = true;
+        }
+
+        void Graph::run(const ::onnxMemoryFenceV1* input_fence, ::onnxMemoryFenceV1* output_fence)
+        {
+            Event* input_event = get_event(input_fence);
+            if (input_event == nullptr)
+            {
+                throw status::invalid_event{};
+            }
+            get_event(output_fence);
+
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                if (!m_io_set)
+                {
+                    throw status::invalid_state{};
+                }
+                Event* output_event = new Event{};
+                output_fence->event = reinterpret_cast<::onnxEvent>(output_event);
+                m_runs.push_back(Run{input_event, output_event, m_inputs, m_outputs});
+            }
+            m_runs_changed.notify_one();
+        }
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable> // std::condition_variable
+#include <cstddef>            // std::size_t
+#include <cstdint>            // std::uint32_t
+#include <deque>              // std::deque
+#include <memory>             // std::shared_ptr
+#include <mutex>              // std::mutex
+#include <string>             // std::string
+#include <thread>             // std::thread
+#include <vector>             // std::vector
+
+#include <onnxifi.h>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+#include "backend.hpp"
+#include "event.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief ONNXIFI graph, an ONNX model compiled for an nGraph backend
+        class Graph
+        {
+        public:
+            Graph(const Graph&) = delete;
+            Graph& operator=(const Graph&) = delete;
+
+            Graph(Graph&&) = delete;
+            Graph& operator=(Graph&&) = delete;
+
+            Graph() = delete;
+
+            /// \brief Import and compile the model. Graph inputs described by
+            ///        weight_descriptors become constants initialized from the
+            ///        caller's buffers, which may be released afterwards.
+            Graph(const Backend& backend,
+                  const void* onnx_model,
+                  std::size_t onnx_model_size,
+                  std::uint32_t weights_count,
+                  const ::onnxTensorDescriptorV1* weight_descriptors);
+
+            /// \brief Waits for the queued runs to finish and releases the compiled
+            ///        function from the backend
+            ~Graph();
+
+            /// \brief Bind the graph inputs and outputs to caller memory. The
+            ///        backend reads and writes the bound buffers directly.
+            void set_io(std::uint32_t inputs_count,
+                        const ::onnxTensorDescriptorV1* input_descriptors,
+                        std::uint32_t outputs_count,
+                        const ::onnxTensorDescriptorV1* output_descriptors);
+
+            /// \brief Queue a run that starts once the input fence is signalled.
+            ///        Runs execute one after another on the worker thread of the
+            ///        graph, with the binding current when they were queued. The
+            ///        output fence receives a new event signalled with the status
+            ///        of the run when the outputs are ready; the call itself does
+            ///        not block.
+            void run(const ::onnxMemoryFenceV1* input_fence, ::onnxMemoryFenceV1* output_fence);
+
+        private:
+            struct Run
+            {
+                Event* input_event;
+                Event* output_event;
+                std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+                std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+            };
+
+            const Backend& m_backend;
+            std::shared_ptr<Function> m_function{nullptr};
+            std::vector<std::string> m_input_names{};
+            std::vector<std::string> m_output_names{};
+            std::vector<std::shared_ptr<runtime::Tensor>> m_inputs{};
+            std::vector<std::shared_ptr<runtime::Tensor>> m_outputs{};
+            bool m_io_set{false};
+            std::deque<Run> m_runs{};
+            bool m_stopping{false};
+            std::mutex m_mutex{};
+            std::condition_variable m_runs_changed{};
+            std::thread m_worker{};
+
+            void process_runs();
+            std::vector<std::shared_ptr<runtime::Tensor>>
+                bind(const std::vector<std::string>& names,
+                     const std::vector<element::Type>& element_types,
+                     const std::vector<Shape>& shapes,
+                     std::uint32_t count,
+                     const ::onnxTensorDescriptorV1* descriptors) const;
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
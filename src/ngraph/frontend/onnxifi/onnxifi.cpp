@@ -20,7 +20,55 @@
 
 #include <onnxifi.h>
 
+#include "backend.hpp"
 #include "backend_manager.hpp"
+#include "event.hpp"
+#include "exceptions.hpp"
+#include "graph.hpp"
+
+namespace
+{
+    // Run an ONNXIFI entry point, translating exceptions into status codes
+    template <typename Function>
+    onnxStatus invoke(Function&& function)
+    {
+        try
+        {
+            function();
+            return ONNXIFI_STATUS_SUCCESS;
+        }
+        catch (const ngraph::onnxifi::status::status_error& e)
+        {
+            return e.get_status();
+        }
+        catch (const std::bad_alloc&)
+        {
+            return ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
+        }
+        catch (...)
+        {
+            return ONNXIFI_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    ngraph::onnxifi::Event* get_event(onnxEvent event)
+    {
+        if (event == nullptr)
+        {
+            throw ngraph::onnxifi::status::invalid_event{};
+        }
+        return reinterpret_cast<ngraph::onnxifi::Event*>(event);
+    }
+
+    ngraph::onnxifi::Graph* get_graph(onnxGraph graph)
+    {
+        if (graph == nullptr)
+        {
+            throw ngraph::onnxifi::status::invalid_graph{};
+        }
+        return reinterpret_cast<ngraph::onnxifi::Graph*>(graph);
+    }
+}
 
 extern "C" {
 
@@ -71,33 +119,70 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxGetBackendCompati
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxInitBackend(
     onnxBackendID backendID, const uint64_t* auxPropertiesList, onnxBackend* backend)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        if (backend == nullptr)
+        {
+            throw ngraph::onnxifi::status::invalid_pointer{};
+        }
+        try
+        {
+            // Backends are owned by the manager, the handle refers to the shared instance
+            const auto& managed = ngraph::onnxifi::BackendManager::get(backendID);
+            *backend = reinterpret_cast<onnxBackend>(
+                const_cast<ngraph::onnxifi::Backend*>(&managed));
+        }
+        catch (const std::out_of_range&)
+        {
+            throw ngraph::onnxifi::status::invalid_backend{};
+        }
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseBackend(onnxBackend backend)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return invoke([&] {
+        if (backend == nullptr)
+        {
+            throw ngraph::onnxifi::status::invalid_backend{};
+        }
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxInitEvent(onnxBackend backend,
                                                                          onnxEvent* event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        if (backend == nullptr)
+        {
+            throw ngraph::onnxifi::status::invalid_backend{};
+        }
+        if (event == nullptr)
+        {
+            throw ngraph::onnxifi::status::invalid_pointer{};
+        }
+        *event = reinterpret_cast<onnxEvent>(new ngraph::onnxifi::Event{});
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxSignalEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] { get_event(event)->signal(); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxWaitEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        auto status = get_event(event)->wait();
+        if (status != ONNXIFI_STATUS_SUCCESS)
+        {
+            throw ngraph::onnxifi::status::status_error{status};
+        }
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return invoke([&] { delete get_event(event); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
@@ -109,7 +194,27 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
                   const onnxTensorDescriptorV1* weightDescriptors,
                   onnxGraph* graph)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        if (backend == nullptr)
+        {
+            throw ngraph::onnxifi::status::invalid_backend{};
+        }
+        if ((onnxModel == nullptr) || (graph == nullptr) ||
+            ((weightsCount != 0) && (weightDescriptors == nullptr)))
+        {
+            throw ngraph::onnxifi::status::invalid_pointer{};
+        }
+        if (onnxModelSize == 0)
+        {
+            throw ngraph::onnxifi::status::invalid_size{};
+        }
+        *graph = reinterpret_cast<onnxGraph>(
+            new ngraph::onnxifi::Graph{*reinterpret_cast<ngraph::onnxifi::Backend*>(backend),
+                                       onnxModel,
+                                       onnxModelSize,
+                                       weightsCount,
+                                       weightDescriptors});
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
@@ -119,18 +224,20 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
                    std::uint32_t outputsCount,
                    const onnxTensorDescriptorV1* outputDescriptors)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        get_graph(graph)->set_io(inputsCount, inputDescriptors, outputsCount, outputDescriptors);
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxRunGraph(
     onnxGraph graph, const onnxMemoryFenceV1* inputFence, onnxMemoryFenceV1* outputFence)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] { get_graph(graph)->run(inputFence, outputFence); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseGraph(onnxGraph graph)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return invoke([&] { delete get_graph(graph); });
 }
 
 } /* extern "C" */
@@ -166,6 +166,77 @@ void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> re
     }
 }
 
+static thread_local ModifiedNodeTracker* s_modified_node_tracker = nullptr;
+
+ModifiedNodeTracker::ModifiedNodeTracker()
+    : m_outer(s_modified_node_tracker)
+{
+    s_modified_node_tracker = this;
+}
+
+ModifiedNodeTracker::~ModifiedNodeTracker()
+{
+    s_modified_node_tracker = m_outer;
+    if (m_outer)
+    {
+        for (auto& p : m_nodes)
+        {
+            m_outer->m_nodes[p.first] = p.second;
+        }
+    }
+}
+
+void ModifiedNodeTracker::record(Node* node, const shared_ptr<Node>& source)
+{
+    if (s_modified_node_tracker)
+    {
+        s_modified_node_tracker->m_nodes[node->get_instance_id()] = source;
+    }
+}
+
+NodeVector ModifiedNodeTracker::get_modified_nodes() const
+{
+    NodeVector nodes;
+    for (auto& p : m_nodes)
+    {
+        // A node that is gone, or was reconnected elsewhere since, is not a user of the source
+        if (auto source = p.second.lock())
+        {
+            for (auto& user : source->get_users())
+            {
+                if (user->get_instance_id() == p.first)
+                {
+                    nodes.push_back(user);
+                    break;
+                }
+            }
+        }
+    }
+    return nodes;
+}
+
+void ngraph::validate_downstream_nodes_and_infer_types(const NodeVector& nodes)
+{
+    unordered_set<shared_ptr<Node>> downstream(nodes.begin(), nodes.end());
+    deque<shared_ptr<Node>> stack(nodes.begin(), nodes.end());
+    while (!stack.empty())
+    {
+        auto node = stack.front();
+        stack.pop_front();
+        for (auto user : node->get_users())
+        {
+            if (downstream.insert(user).second)
+            {
+                stack.push_back(user);
+            }
+        }
+    }
+    for (auto node : subgraph_topological_sort(downstream))
+    {
+        node->delayed_validate_and_infer_types();
+    }
+}
+
 // Check if all paths from X to a result go through Y
 bool ngraph::is_post_dominated(Node* X, Node* Y)
 {
@@ -216,6 +216,35 @@ namespace ngraph
         }
     }
 
+    // Collects the nodes on the current thread whose inputs are reconnected
+    // to a different output while the tracker is alive. Trackers nest, an
+    // inner tracker hands what it saw to the enclosing one when destroyed.
+    class ModifiedNodeTracker
+    {
+    public:
+        ModifiedNodeTracker();
+        ~ModifiedNodeTracker();
+        ModifiedNodeTracker(const ModifiedNodeTracker&) = delete;
+        ModifiedNodeTracker& operator=(const ModifiedNodeTracker&) = delete;
+
+        // Called whenever one of node's inputs is reconnected to an output of source
+        static void record(Node* node, const std::shared_ptr<Node>& source);
+
+        bool empty() const { return m_nodes.empty(); }
+        void clear() { m_nodes.clear(); }
+        // The recorded nodes that are still alive
+        NodeVector get_modified_nodes() const;
+
+    private:
+        // The node may still be under construction when it is recorded, so it is
+        // kept by instance id and found again among the users of its new source
+        std::unordered_map<size_t, std::weak_ptr<Node>> m_nodes;
+        ModifiedNodeTracker* m_outer;
+    };
+
+    // Revalidate nodes and everything that depends on them
+    void validate_downstream_nodes_and_infer_types(const NodeVector& nodes);
+
     // Check if all paths from X to a result go through Y
     bool is_post_dominated(Node* X, Node* Y);
 
@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace ngraph
+{
+    /// \brief A read-only memory mapping of a whole file.
+    ///
+    /// The mapping is shared, so every process mapping the same file uses the same physical
+    /// pages. The file must not be truncated or rewritten while it is mapped.
+    class MappedFile
+    {
+    public:
+        /// \brief Maps the file at path into memory.
+        /// \param path The path of the file to map.
+        /// \throws ngraph_error if the file cannot be opened or mapped.
+        MappedFile(const std::string& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const std::string& get_path() const { return m_path; }
+        const char* get_data() const { return m_data; }
+        size_t size() const { return m_size; }
+    private:
+        std::string m_path;
+        const char* m_data{nullptr};
+        size_t m_size{0};
+#ifdef WIN32
+        void* m_file{nullptr};
+        void* m_mapping{nullptr};
+#endif
+    };
+}
@@ -41,3 +41,67 @@ shared_ptr<Node> op::AllReduce::copy_with_new_args(const NodeVector& new_args) c
     check_new_args_count(this, new_args);
     return make_shared<AllReduce>(new_args.at(0));
 }
+
+op::AllReduceStart::AllReduceStart(const NodeVector& args)
+    : Op("AllReduceStart", check_single_output_args(args))
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::AllReduceStart::validate_and_infer_types()
+{
+    NODE_VALIDATION_ASSERT(this, get_input_size() > 0) << "At least one argument is required.";
+
+    const element::Type& element_type = get_input_element_type(0);
+    NODE_VALIDATION_ASSERT(this, element_type == element::f32 || element_type == element::f64)
+        << "Only element types f32 and f64 are supported (argument element type: "
+        << element_type << ").";
+
+    size_t element_count = 0;
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_ASSERT(this, get_input_element_type(i) == element_type)
+            << "Argument " << i << " element type " << get_input_element_type(i)
+            << " differs from argument 0 element type " << element_type << ".";
+        element_count += shape_size(get_input_shape(i));
+    }
+
+    set_output_type(0, element_type, Shape{element_count});
+}
+
+shared_ptr<Node> op::AllReduceStart::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<AllReduceStart>(new_args);
+}
+
+op::AllReduceWait::AllReduceWait(const shared_ptr<Node>& start, const vector<Shape>& shapes)
+    : Op("AllReduceWait", check_single_output_args({start}))
+    , m_shapes(shapes)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::AllReduceWait::validate_and_infer_types()
+{
+    size_t element_count = 0;
+    for (const Shape& shape : m_shapes)
+    {
+        element_count += shape_size(shape);
+    }
+    NODE_VALIDATION_ASSERT(this, get_input_shape(0) == Shape{element_count})
+        << "Argument shape " << get_input_shape(0) << " does not hold the " << element_count
+        << " elements of the output shapes.";
+
+    set_output_size(m_shapes.size());
+    for (size_t i = 0; i < m_shapes.size(); i++)
+    {
+        set_output_type(i, get_input_element_type(0), m_shapes[i]);
+    }
+}
+
+shared_ptr<Node> op::AllReduceWait::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<AllReduceWait>(new_args.at(0), m_shapes);
+}
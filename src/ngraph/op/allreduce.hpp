@@ -33,5 +33,41 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
         };
+
+        /// \brief Starts summing its arguments over all processes without blocking.
+        ///
+        /// The arguments, which must share an element type, are packed one after another into
+        /// the flat output buffer, which is then reduced in place in the background. The buffer
+        /// only holds the sums once the AllReduceWait consuming it has executed.
+        class AllReduceStart : public Op
+        {
+        public:
+            AllReduceStart(const NodeVector& args);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+        };
+
+        /// \brief Waits for the reduction started by an AllReduceStart and unpacks its flat
+        ///        buffer into one output per argument of the start.
+        class AllReduceWait : public Op
+        {
+        public:
+            /// \param start The AllReduceStart whose buffer is unpacked.
+            /// \param shapes The shapes of the outputs, which are the shapes of the arguments of
+            ///        the start in order.
+            AllReduceWait(const std::shared_ptr<Node>& start, const std::vector<Shape>& shapes);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const std::vector<Shape>& get_shapes() const { return m_shapes; }
+        private:
+            std::vector<Shape> m_shapes;
+        };
     }
 }
@@ -104,6 +104,33 @@ namespace ngraph
                 constructor_validate_and_infer_types();
             }
 
+            /// \brief Constructs a tensor constant that uses existing data without copying it.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data The constant data, aligned to the element size. It must stay valid
+            ///        and unchanged for as long as data_owner is alive.
+            /// \param data_owner Keeps the memory behind data alive. It is shared with copies of
+            ///        this constant.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const void* data,
+                     const std::shared_ptr<const void>& data_owner)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_data(const_cast<void*>(data))
+                , m_data_owner(data_owner)
+            {
+                NODE_VALIDATION_ASSERT(this, data_owner != nullptr)
+                    << "A constant viewing external data requires an owner for that data.";
+                NODE_VALIDATION_ASSERT(
+                    this, reinterpret_cast<uintptr_t>(data) % m_element_type.size() == 0)
+                    << "Constant data at " << data << " is not aligned to the element size ("
+                    << m_element_type.size() << ").";
+                constructor_validate_and_infer_types();
+            }
+
             virtual ~Constant() override;
 
             void validate_and_infer_types() override
@@ -210,6 +237,10 @@ namespace ngraph
                 {
                     write_buffer<char, T>(target, source, target_element_count);
                 }
+                else if (target_type == element::bf16)
+                {
+                    write_buffer<bfloat16, T>(target, source, target_element_count);
+                }
                 else if (target_type == element::f32)
                 {
                     write_buffer<float, T>(target, source, target_element_count);
@@ -259,6 +290,8 @@ namespace ngraph
             element::Type m_element_type;
             Shape m_shape{};
             void* m_data{nullptr};
+            // Set when m_data is a read-only view of memory owned elsewhere
+            std::shared_ptr<const void> m_data_owner;
             Constant(const Constant&) = delete;
             Constant(Constant&&) = delete;
             Constant operator=(const Constant*) = delete;
@@ -49,6 +49,8 @@ NGRAPH_OP(Abs, ngraph::op)
 NGRAPH_OP(Acos, ngraph::op)
 NGRAPH_OP(Add, ngraph::op)
 NGRAPH_OP(AllReduce, ngraph::op)
+NGRAPH_OP(AllReduceStart, ngraph::op)
+NGRAPH_OP(AllReduceWait, ngraph::op)
 NGRAPH_OP(And, ngraph::op)
 NGRAPH_OP(ArgMax, ngraph::op)
 NGRAPH_OP(ArgMin, ngraph::op)
@@ -63,6 +63,8 @@ namespace ngraph
             return m_rank_is_determined ? Rank(m_dimensions.size()) : Rank::undetermined();
         }
 
+        /// \brief Returns the dimension of axis i. The rank of the shape must be determined.
+        const Dimension& operator[](size_t i) const { return m_dimensions[i]; }
         /// \brief Appends another shape to this shape.
         ///
         ///        If "this" and "other" both have determined rank, returns a new shape two shape
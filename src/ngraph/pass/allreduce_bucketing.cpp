@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Returns true if node depends on any of targets through its arguments or control dependencies
+static bool depends_on_any(const shared_ptr<Node>& node, const unordered_set<Node*>& targets)
+{
+    unordered_set<Node*> visited;
+    vector<shared_ptr<Node>> stack{node};
+    while (!stack.empty())
+    {
+        shared_ptr<Node> current = stack.back();
+        stack.pop_back();
+        if (targets.count(current.get()) != 0)
+        {
+            return true;
+        }
+        if (!visited.insert(current.get()).second)
+        {
+            continue;
+        }
+        for (auto& arg : current->get_arguments())
+        {
+            stack.push_back(arg);
+        }
+        for (auto& dep : current->get_control_dependencies())
+        {
+            stack.push_back(dep);
+        }
+    }
+    return false;
+}
+
+static bool depends_on(const shared_ptr<Node>& node, const shared_ptr<Node>& target)
+{
+    return depends_on_any(node, unordered_set<Node*>{target.get()});
+}
+
+bool pass::AllReduceBucketing::run_on_function(shared_ptr<Function> function)
+{
+    struct Bucket
+    {
+        vector<shared_ptr<op::AllReduce>> allreduces;
+        unordered_set<Node*> members;
+        size_t size = 0;
+    };
+
+    vector<Bucket> buckets;
+    // Index in buckets of the bucket being filled for each element type
+    map<element::Type, size_t> open_buckets;
+    size_t allreduce_count = 0;
+    for (auto node : function->get_ordered_ops())
+    {
+        auto allreduce = dynamic_pointer_cast<op::AllReduce>(node);
+        if (!allreduce)
+        {
+            continue;
+        }
+        allreduce_count++;
+        const element::Type& element_type = allreduce->get_element_type();
+        size_t size = shape_size(allreduce->get_shape()) * element_type.size();
+        // An AllReduce that consumes the result of another one in the open bucket can't be
+        // started together with it, that would make the bucket wait for itself
+        auto it = open_buckets.find(element_type);
+        if (it == open_buckets.end() || buckets[it->second].size + size > m_bucket_size ||
+            depends_on_any(allreduce->get_argument(0), buckets[it->second].members))
+        {
+            buckets.emplace_back();
+            open_buckets[element_type] = buckets.size() - 1;
+        }
+        Bucket& bucket = buckets[open_buckets[element_type]];
+        bucket.allreduces.push_back(allreduce);
+        bucket.members.insert(allreduce.get());
+        bucket.size += size;
+    }
+    // A single reduction has nothing to overlap with
+    if (allreduce_count < 2)
+    {
+        return false;
+    }
+
+    NodeVector starts;
+    NodeVector waits;
+    for (const Bucket& bucket : buckets)
+    {
+        NodeVector args;
+        vector<Shape> shapes;
+        for (auto& allreduce : bucket.allreduces)
+        {
+            args.push_back(allreduce->get_argument(0));
+            shapes.push_back(allreduce->get_shape());
+        }
+        auto start = make_shared<op::AllReduceStart>(args);
+        auto wait = make_shared<op::AllReduceWait>(start, shapes);
+        for (size_t i = 0; i < bucket.allreduces.size(); i++)
+        {
+            replace_node(bucket.allreduces[i], make_shared<op::GetOutputElement>(wait, i));
+        }
+        starts.push_back(start);
+        waits.push_back(wait);
+    }
+
+    // Buckets are ordered by their first AllReduce, order them by when they can start instead
+    // so each wait is placed after the start that follows it
+    auto order = function->get_ordered_ops();
+    unordered_map<Node*, size_t> position;
+    size_t index = 0;
+    for (auto& node : order)
+    {
+        position[node.get()] = index++;
+    }
+    vector<size_t> bucket_order(starts.size());
+    for (size_t i = 0; i < bucket_order.size(); i++)
+    {
+        bucket_order[i] = i;
+    }
+    sort(bucket_order.begin(), bucket_order.end(), [&](size_t a, size_t b) {
+        return position[starts[a].get()] < position[starts[b].get()];
+    });
+    for (size_t i = 0; i + 1 < bucket_order.size(); i++)
+    {
+        auto& wait = waits[bucket_order[i]];
+        auto& next_start = starts[bucket_order[i + 1]];
+        if (!depends_on(next_start, wait))
+        {
+            wait->add_control_dependency(next_start);
+        }
+    }
+    return true;
+}
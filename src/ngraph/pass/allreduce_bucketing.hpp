@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Fuses AllReduce ops into buckets that are reduced with non-blocking
+        ///        collectives.
+        ///
+        /// AllReduce ops of the same element type are packed, in the order they are executed,
+        /// into buckets of at most bucket_size bytes; an AllReduce larger than that gets a bucket
+        /// of its own, and an AllReduce that depends on one in the open bucket starts a new
+        /// one. Each bucket becomes an AllReduceStart, which launches the reduction as
+        /// soon as the last of its arguments is computed, and an AllReduceWait whose outputs
+        /// replace the AllReduce ops. A wait is ordered after the start of the next bucket, so
+        /// the communication of a bucket overlaps the computation of the next one.
+        class AllReduceBucketing : public FunctionPass
+        {
+        public:
+            AllReduceBucketing(size_t bucket_size = 25 * 1024 * 1024)
+                : m_bucket_size(bucket_size)
+            {
+            }
+
+            bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+        private:
+            size_t m_bucket_size;
+        };
+    }
+}
@@ -0,0 +1,163 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/pass/bf16_conversion.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+// Ops that have bfloat16 kernels on both the INTERPRETER and CPU backends. The Convolution and
+// Dot kernels accumulate bfloat16 inputs in float and round each output element once.
+static const unordered_set<type_index> s_bf16_ops{TI(op::Abs),
+                                                  TI(op::Add),
+                                                  TI(op::Convolution),
+                                                  TI(op::Divide),
+                                                  TI(op::Dot),
+                                                  TI(op::MaxPool),
+                                                  TI(op::Maximum),
+                                                  TI(op::Minimum),
+                                                  TI(op::Multiply),
+                                                  TI(op::Negative),
+                                                  TI(op::Relu),
+                                                  TI(op::Subtract),
+                                                  TI(op::Tanh)};
+
+bool pass::BF16Conversion::is_convertible(const shared_ptr<Node>& node) const
+{
+    const Node& n = *node;
+    if (s_bf16_ops.count(TI(n)) == 0 || node->get_output_size() != 1 ||
+        node->get_element_type() != element::f32)
+    {
+        return false;
+    }
+    for (auto& arg : node->get_arguments())
+    {
+        if (arg->get_output_size() != 1 || arg->get_element_type() != element::f32)
+        {
+            return false;
+        }
+    }
+    return !m_predicate || m_predicate(node);
+}
+
+bool pass::BF16Conversion::run_on_function(shared_ptr<Function> function)
+{
+    m_converted_count = 0;
+
+    list<shared_ptr<Node>> ops = function->get_ordered_ops();
+    unordered_set<shared_ptr<Node>> convertible;
+    for (auto& node : ops)
+    {
+        if (is_convertible(node))
+        {
+            convertible.insert(node);
+        }
+    }
+
+    // Keep the connected subgraphs that are large enough to be worth converting
+    unordered_set<shared_ptr<Node>> selected;
+    unordered_set<shared_ptr<Node>> visited;
+    for (auto& node : ops)
+    {
+        if (convertible.count(node) == 0 || !visited.insert(node).second)
+        {
+            continue;
+        }
+        vector<shared_ptr<Node>> subgraph;
+        vector<shared_ptr<Node>> stack{node};
+        while (!stack.empty())
+        {
+            shared_ptr<Node> current = stack.back();
+            stack.pop_back();
+            subgraph.push_back(current);
+            NodeVector neighbours = current->get_arguments();
+            NodeVector users = current->get_users();
+            neighbours.insert(neighbours.end(), users.begin(), users.end());
+            for (auto& neighbour : neighbours)
+            {
+                if (convertible.count(neighbour) != 0 && visited.insert(neighbour).second)
+                {
+                    stack.push_back(neighbour);
+                }
+            }
+        }
+        if (subgraph.size() >= m_min_subgraph_size)
+        {
+            selected.insert(subgraph.begin(), subgraph.end());
+        }
+    }
+
+    // Every converted op is replaced by a Convert of its bf16 copy back to f32, which is what
+    // its f32 users see. Converted users take the bf16 copy instead, so the Converts between
+    // converted ops are left without users and drop out of the function.
+    unordered_map<shared_ptr<Node>, shared_ptr<Node>> bf16_values;
+    for (auto& node : ops)
+    {
+        if (selected.count(node) == 0)
+        {
+            continue;
+        }
+        NodeVector new_args;
+        for (auto& arg : node->get_arguments())
+        {
+            auto it = bf16_values.find(arg);
+            if (it == bf16_values.end())
+            {
+                shared_ptr<Node> value;
+                if (auto constant = dynamic_pointer_cast<op::Constant>(arg))
+                {
+                    value = make_shared<op::Constant>(
+                        element::bf16, constant->get_shape(), constant->get_vector<float>());
+                }
+                else
+                {
+                    value = make_shared<op::Convert>(arg, element::bf16);
+                }
+                it = bf16_values.insert({arg, value}).first;
+            }
+            new_args.push_back(it->second);
+        }
+        auto bf16_node = node->copy_with_new_args(new_args);
+        auto f32_node = make_shared<op::Convert>(bf16_node, element::f32);
+        replace_node(node, f32_node);
+        bf16_values[f32_node] = bf16_node;
+        m_converted_count++;
+    }
+    return m_converted_count > 0;
+}
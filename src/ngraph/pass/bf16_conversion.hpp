@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Runs connected subgraphs of f32 ops in bf16.
+        ///
+        /// Elementwise arithmetic, Relu, Tanh, MaxPool, Dot and Convolution are converted. The
+        /// bf16 Dot and Convolution kernels accumulate in f32 and round each result once, so
+        /// only their inputs and outputs lose precision. Other reductions, such as AvgPool and
+        /// Sum, stay in f32. Arguments coming from outside a subgraph are
+        /// converted to bf16 on entry (f32 constants are converted in place) and values leaving
+        /// a subgraph are converted back to f32, so the element types of the function's
+        /// parameters and results do not change.
+        class BF16Conversion : public FunctionPass
+        {
+        public:
+            using Predicate = std::function<bool(const std::shared_ptr<Node>&)>;
+
+            /// \param min_subgraph_size Connected subgraphs with fewer ops are left in f32,
+            ///        since the conversions at their boundary would cost more than they save.
+            /// \param predicate If set, only ops for which it returns true are converted.
+            BF16Conversion(size_t min_subgraph_size = 2, Predicate predicate = nullptr)
+                : m_min_subgraph_size(min_subgraph_size)
+                , m_predicate(predicate)
+            {
+            }
+
+            bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+            /// \brief Returns the number of ops converted to bf16 by the last run
+            size_t get_converted_count() const { return m_converted_count; }
+        private:
+            bool is_convertible(const std::shared_ptr<Node>& node) const;
+
+            size_t m_min_subgraph_size;
+            Predicate m_predicate;
+            size_t m_converted_count{0};
+        };
+    }
+}
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <memory>
 #include <set>
 #include <typeinfo>
@@ -63,6 +64,43 @@ using namespace ngraph;
 
 #define TI(x) std::type_index(typeid(x))
 
+// MurmurHash64A over the raw bytes of a constant, read eight bytes at a time
+static size_t hash_constant_data(const op::Constant& constant)
+{
+    const uint64_t m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
+
+    size_t size = shape_size(constant.get_shape()) * constant.get_element_type().size();
+    auto data = static_cast<const uint8_t*>(constant.get_data_ptr());
+    uint64_t h = 0x8445d61a4e774912ULL ^ (size * m);
+
+    const uint8_t* end = data + (size / sizeof(uint64_t)) * sizeof(uint64_t);
+    for (; data != end; data += sizeof(uint64_t))
+    {
+        uint64_t k;
+        std::memcpy(&k, data, sizeof(uint64_t));
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+
+    size_t tail = size % sizeof(uint64_t);
+    if (tail)
+    {
+        uint64_t k = 0;
+        std::memcpy(&k, data, tail);
+        h ^= k;
+        h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return static_cast<size_t>(h);
+}
+
 static bool cse_constant(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
 {
     NGRAPH_DEBUG << "In cse_constant for " << a->get_name() << " and " << b->get_name();
@@ -177,16 +215,19 @@ class NodeKey
 public:
     NodeKey(std::shared_ptr<Node> n)
         : m_node(n)
+        , m_hash(compute_hash(*n))
     {
     }
 
     std::shared_ptr<Node> get_node() const { return m_node; }
+    size_t get_hash() const { return m_hash; }
     bool operator==(const NodeKey& other) const
     {
         Node& p_this = *m_node.get();
         Node& p_other = *other.get_node().get();
 
-        if (TI(p_this) != TI(p_other))
+        // Saves comparing the contents of constants that cannot be equal
+        if (m_hash != other.get_hash() || TI(p_this) != TI(p_other))
         {
             return false;
         }
@@ -201,50 +242,66 @@ public:
     }
 
 private:
-    std::shared_ptr<Node> m_node;
-};
-
-namespace std
-{
-    template <>
-    struct hash<NodeKey>
+    static size_t compute_hash(Node& node)
     {
-        std::size_t operator()(const NodeKey& k) const
-        {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            std::hash<std::type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
+        std::hash<std::type_index> type_hash_compute{};
+        auto type_hash = type_hash_compute(TI(node));
 
-            std::vector<size_t> arg_ids;
+        std::vector<size_t> arg_ids;
 
-            arg_ids.push_back(type_hash);
+        arg_ids.push_back(type_hash);
 
-            auto cargs = k.get_node()->get_arguments();
-
-            // TODO: Do we need another map, so we could
-            // specify how to compute hash for each op?
-            if (p_this.is_commutative())
+        if (auto constant = dynamic_cast<op::Constant*>(&node))
+        {
+            // Constants have no arguments, so they are told apart by their values
+            arg_ids.push_back(constant->get_element_type().hash());
+            for (auto dim : constant->get_shape())
             {
-                std::sort(begin(cargs), end(cargs));
+                arg_ids.push_back(dim);
             }
+            arg_ids.push_back(hash_constant_data(*constant));
+            return ngraph::hash_combine(arg_ids);
+        }
 
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg->get_instance_id());
-            }
+        auto cargs = node.get_arguments();
 
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
+        // TODO: Do we need another map, so we could
+        // specify how to compute hash for each op?
+        if (node.is_commutative())
+        {
+            std::sort(begin(cargs), end(cargs));
         }
+
+        for (auto arg : cargs)
+        {
+            arg_ids.push_back(arg->get_instance_id());
+        }
+
+        return ngraph::hash_combine(arg_ids);
+    }
+
+    std::shared_ptr<Node> m_node;
+    size_t m_hash;
+};
+
+namespace std
+{
+    template <>
+    struct hash<NodeKey>
+    {
+        std::size_t operator()(const NodeKey& k) const { return k.get_hash(); }
     };
 }
 
-bool ngraph::pass::CommonSubexpressionElimination::run_on_function(
-    std::shared_ptr<ngraph::Function> f)
+// Constants are shared across functions by data, not by node: a function that repeats a
+// constant of an earlier function gets its own Constant viewing the earlier one's buffer, so
+// the node sets of the functions stay disjoint.
+static bool eliminate_common_subexpressions(
+    const std::shared_ptr<ngraph::Function>& f,
+    std::unordered_map<NodeKey, std::shared_ptr<Node>>& module_constants)
 {
     bool replaced = false;
+    std::unordered_map<NodeKey, std::shared_ptr<Node>> constants{};
     std::unordered_map<NodeKey, std::shared_ptr<Node>> expressions{};
 
     for (auto n : f->get_ordered_ops())
@@ -254,17 +311,66 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(
             continue;
         }
 
+        auto& table = n->is_constant() ? constants : expressions;
         NodeKey n_key{n};
-        if (expressions.count(n_key))
+        auto it = table.find(n_key);
+        if (it != table.end())
         {
-            ngraph::replace_node(n, expressions.at(n_key));
-            replaced = true;
+            if (it->second != n)
+            {
+                ngraph::replace_node(n, it->second);
+                replaced = true;
+            }
+            continue;
+        }
+        table.insert(std::make_pair(n_key, n));
+
+        auto constant = std::dynamic_pointer_cast<op::Constant>(n);
+        if (!constant)
+        {
+            continue;
+        }
+        auto module_it = module_constants.find(n_key);
+        if (module_it == module_constants.end())
+        {
+            module_constants.insert(std::make_pair(n_key, n));
+            continue;
         }
-        else
+        auto survivor = std::static_pointer_cast<op::Constant>(module_it->second);
+        if (survivor->get_data_ptr() != constant->get_data_ptr())
         {
-            expressions.insert(std::make_pair(n_key, n));
+            // The view keeps the surviving constant, and with it the buffer, alive
+            auto view = std::make_shared<op::Constant>(constant->get_element_type(),
+                                                       constant->get_shape(),
+                                                       survivor->get_data_ptr(),
+                                                       survivor);
+            ngraph::replace_node(n, view);
+            table.erase(n_key);
+            table.insert(std::make_pair(NodeKey{view}, view));
+            replaced = true;
         }
     }
 
     return replaced;
 }
+
+bool ngraph::pass::CommonSubexpressionElimination::run_on_module(
+    std::vector<std::shared_ptr<ngraph::Function>>& functions)
+{
+    bool replaced = false;
+    std::unordered_map<NodeKey, std::shared_ptr<Node>> module_constants{};
+
+    for (auto& f : functions)
+    {
+        replaced |= eliminate_common_subexpressions(f, module_constants);
+    }
+
+    return replaced;
+}
+
+bool ngraph::pass::CommonSubexpressionElimination::run_on_function(
+    std::shared_ptr<ngraph::Function> f)
+{
+    std::unordered_map<NodeKey, std::shared_ptr<Node>> module_constants{};
+    return eliminate_common_subexpressions(f, module_constants);
+}
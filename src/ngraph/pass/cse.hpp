@@ -26,13 +26,21 @@ namespace ngraph
     }
 }
 
-class ngraph::pass::CommonSubexpressionElimination : public FunctionPass
+/// \brief Replaces nodes that compute the same value as an earlier node with that node.
+///
+/// Constants with equal element type, shape and contents are deduplicated across all the
+/// functions of the module, callees included, so replicated weights are kept only once. Within
+/// a function the duplicates are replaced by the first constant; in later functions they are
+/// replaced by a Constant of their own that views the first constant's data, so no node belongs
+/// to two functions. Other expressions are only reused within the function that computes them.
+class ngraph::pass::CommonSubexpressionElimination : public ModulePass
 {
 public:
     CommonSubexpressionElimination()
-        : FunctionPass()
+        : ModulePass()
     {
     }
 
-    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+    virtual bool run_on_module(std::vector<std::shared_ptr<ngraph::Function>>& functions) override;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f);
 };
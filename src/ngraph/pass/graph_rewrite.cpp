@@ -15,12 +15,75 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
+#include <typeindex>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "graph_rewrite.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // A matcher can only match nodes of the same type as the root of its
+    // pattern, unless the root is a Label, Any or Skip. Index matchers by
+    // root type so each node only runs the matchers that can apply to it,
+    // in the order they were added.
+    template <typename MatcherType>
+    class MatcherIndex
+    {
+    public:
+        MatcherIndex(const vector<shared_ptr<MatcherType>>& matchers)
+        {
+            for (auto matcher : matchers)
+            {
+                auto root = matcher->get_pattern();
+                if (dynamic_pointer_cast<pattern::op::Pattern>(root))
+                {
+                    m_untyped_matchers.push_back(matcher);
+                    for (auto& p : m_typed_matchers)
+                    {
+                        p.second.push_back(matcher);
+                    }
+                }
+                else
+                {
+                    auto it = m_typed_matchers.find(type_index(typeid(*root)));
+                    if (it == m_typed_matchers.end())
+                    {
+                        it = m_typed_matchers
+                                 .insert(make_pair(type_index(typeid(*root)), m_untyped_matchers))
+                                 .first;
+                    }
+                    it->second.push_back(matcher);
+                }
+            }
+        }
+
+        const vector<shared_ptr<MatcherType>>& get_matchers(const Node& node) const
+        {
+            auto it = m_typed_matchers.find(type_index(typeid(node)));
+            return it == m_typed_matchers.end() ? m_untyped_matchers : it->second;
+        }
+
+    private:
+        unordered_map<type_index, vector<shared_ptr<MatcherType>>> m_typed_matchers;
+        vector<shared_ptr<MatcherType>> m_untyped_matchers;
+    };
+
+    // Nodes an earlier rewrite replaced are no longer worth matching
+    bool is_replaced(const shared_ptr<Node>& node)
+    {
+        return !node->is_output() && !node->is_parameter() && node->get_users().empty();
+    }
+}
 
 bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
     const std::list<std::shared_ptr<ngraph::Node>>& nodes,
@@ -28,9 +91,14 @@ bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
     std::shared_ptr<ngraph::Function> f)
 {
     bool rewritten = false;
+    MatcherIndex<pattern::Matcher> index(matchers);
     for (auto node : nodes)
     {
-        for (auto matcher : matchers)
+        if (is_replaced(node))
+        {
+            continue;
+        }
+        for (auto matcher : index.get_matchers(*node))
         {
             NGRAPH_DEBUG << "Running matcher " << matcher->get_name() << "("
                          << matcher->get_pattern()->get_name() << ") on " << node->get_name();
@@ -57,27 +125,60 @@ bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Functio
 bool ngraph::pass::RecurrentGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool changed = false;
-    size_t i = 0;
-    do
+    size_t num_rewrites = 0;
+    MatcherIndex<pattern::RecurrentMatcher> index(m_matchers);
+
+    auto ops = f->get_ops();
+    deque<shared_ptr<Node>> worklist(ops.begin(), ops.end());
+    unordered_set<Node*> queued;
+    for (auto node : ops)
     {
-        for (auto node : f->get_ops())
+        queued.insert(node.get());
+    }
+    auto enqueue = [&](shared_ptr<Node> node) {
+        if (queued.insert(node.get()).second)
         {
-            for (auto matcher : m_matchers)
+            worklist.push_front(node);
+        }
+    };
+
+    // Each successful rewrite counts as an iteration, the limit guards
+    // against callbacks that keep rewriting the same nodes
+    while (!worklist.empty() && num_rewrites < m_num_iters)
+    {
+        auto node = worklist.front();
+        worklist.pop_front();
+        queued.erase(node.get());
+        if (is_replaced(node))
+        {
+            continue;
+        }
+        for (auto matcher : index.get_matchers(*node))
+        {
+            NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node->get_name();
+            if (matcher->match(node))
             {
-                NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node->get_name();
-                if (matcher->match(node))
+                NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node->get_name();
+                ModifiedNodeTracker modified_nodes;
+                if (matcher->process_match())
                 {
-                    NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node->get_name();
-                    if (matcher->process_match())
+                    changed = true;
+                    num_rewrites++;
+                    // New matches can only involve the reconnected users and
+                    // the nodes that now feed them, instead of rescanning the
+                    // whole function look at those next
+                    for (auto modified : modified_nodes.get_modified_nodes())
                     {
-                        changed = true;
-                        goto next_fusion;
+                        for (auto arg : modified->get_arguments())
+                        {
+                            enqueue(arg);
+                        }
+                        enqueue(modified);
                     }
+                    break;
                 }
             }
         }
-    next_fusion:
-        i++;
-    } while (changed && i < m_num_iters);
+    }
     return changed;
 }
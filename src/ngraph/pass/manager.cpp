@@ -80,9 +80,12 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
     stopwatch pass_timer;
     stopwatch overall_timer;
     overall_timer.start();
+    ModifiedNodeTracker modified_nodes;
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
         pass_timer.start();
+        modified_nodes.clear();
+        bool changed = false;
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
         auto function_pass = dynamic_pointer_cast<FunctionPass>(pass);
@@ -94,13 +97,13 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
             {
                 vt_pass->set_ops_to_details(get_state().get_visualize_tree_ops_map());
             }
-            module_pass->run_on_module(fs);
+            changed |= module_pass->run_on_module(fs);
         }
         else if (function_pass)
         {
             for (shared_ptr<Function> f : fs)
             {
-                function_pass->run_on_function(f);
+                changed |= function_pass->run_on_function(f);
             }
         }
         else if (node_pass)
@@ -109,7 +112,7 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
             {
                 for (shared_ptr<Node> n : f->get_ops())
                 {
-                    node_pass->run_on_node(n);
+                    changed |= node_pass->run_on_node(n);
                 }
             }
         }
@@ -117,14 +120,25 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
         {
             for (shared_ptr<Function> f : fs)
             {
-                call_graph_pass->run_on_call_graph(f->get_ordered_ops());
+                changed |= call_graph_pass->run_on_call_graph(f->get_ordered_ops());
             }
         }
 
-        // Better to do this in node replacement but this will do for now
-        for (auto f : fs)
+        // New nodes are validated when they are constructed, so only the
+        // nodes downstream of a reconnected input can have stale types. A
+        // pass that reports a change without reconnecting anything edited
+        // nodes in place, through set_output_type or an attribute, and those
+        // edits are not tracked, so everything is revalidated.
+        if (!modified_nodes.empty())
         {
-            f->validate_nodes_and_infer_types();
+            validate_downstream_nodes_and_infer_types(modified_nodes.get_modified_nodes());
+        }
+        else if (changed)
+        {
+            for (shared_ptr<Function> f : fs)
+            {
+                f->validate_nodes_and_infer_types();
+            }
         }
 
         if (m_visualize || m_serialize)
@@ -42,7 +42,7 @@ public:
     void initialize_default_passes();
 
     template <typename T, class... Args>
-    void register_pass(Args&&... args)
+    std::shared_ptr<T> register_pass(Args&&... args)
     {
         static_assert(std::is_base_of<pass::PassBase, T>::value, "pass not derived from pass base");
         auto pass = std::make_shared<T>(std::forward<Args>(args)...);
@@ -52,6 +52,7 @@ public:
         {
             m_pass_names.push_back(typeid(T).name());
         }
+        return pass;
     }
 
     void run_passes(std::shared_ptr<Function>, bool transitive = true);
@@ -14,8 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <map>
+#include <numeric>
 #include <sstream>
+#include <unordered_map>
 
 #include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
@@ -27,14 +31,21 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing, bool plan_offline)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_plan_offline(plan_offline)
 {
 }
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
 {
+    if (m_plan_offline && !m_disable_memory_sharing)
+    {
+        plan_offline(function);
+        return false;
+    }
+
     MemoryManager mm(m_alignment, m_disable_memory_sharing);
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
@@ -86,6 +97,62 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
     return false;
 }
 
+void pass::MemoryLayout::plan_offline(shared_ptr<ngraph::Function> function)
+{
+    MemoryPlanner planner(m_alignment);
+    unordered_map<descriptor::Tensor*, size_t> tensor_buffers;
+    size_t op_index = 0;
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
+        std::set<const descriptor::Tensor*> reused_inputs;
+
+        if (auto op = std::dynamic_pointer_cast<op::Op>(node))
+        {
+            if (auto op_annotations = op->get_op_annotations())
+            {
+                for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
+                {
+                    auto output = &node->get_outputs().at(oi_pair.output).get_tensor();
+                    auto input = &node->get_inputs().at(oi_pair.input).get_tensor();
+
+                    // an input tensor can be reused if this is the last use
+                    if (node->liveness_free_list.count(input) != 0 &&
+                        node->liveness_new_list.count(output) != 0)
+                    {
+                        in_place_outputs.insert({output, input});
+                        reused_inputs.insert(input);
+                    }
+                }
+            }
+        }
+
+        // An in-place output continues the lifetime of the buffer it reuses
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            tensor_buffers[tensor] = in_place_outputs.count(tensor)
+                                         ? tensor_buffers.at(in_place_outputs.at(tensor))
+                                         : planner.add_buffer(tensor->size(), op_index);
+        }
+
+        for (descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            if (reused_inputs.count(tensor) == 0)
+            {
+                planner.set_last_use(tensor_buffers.at(tensor), op_index);
+            }
+        }
+        op_index++;
+    }
+
+    planner.plan();
+    for (auto& tensor_buffer : tensor_buffers)
+    {
+        tensor_buffer.first->set_pool_offset(planner.get_offset(tensor_buffer.second));
+    }
+    function->set_temporary_pool_size(planner.max_allocated());
+}
+
 pass::MemoryManager::node::node(size_t size, block_state state)
     : m_size{size}
     , m_state{state}
@@ -93,8 +160,15 @@ pass::MemoryManager::node::node(size_t size, block_state state)
 }
 
 pass::MemoryManager::MemoryManager(size_t alignment, bool disable_memory_reuse)
+    : MemoryManager(alignment,
+                    disable_memory_reuse ? allocation_scheme::NO_REUSE
+                                         : allocation_scheme::FIRST_FIT)
+{
+}
+
+pass::MemoryManager::MemoryManager(size_t alignment, allocation_scheme scheme)
     : m_alignment{alignment}
-    , m_scheme{disable_memory_reuse ? allocation_scheme::NO_REUSE : allocation_scheme::FIRST_FIT}
+    , m_scheme{scheme}
     , m_max_allocated{0}
 {
     if (m_alignment == 0)
@@ -102,6 +176,8 @@ pass::MemoryManager::MemoryManager(size_t alignment, bool disable_memory_reuse)
         throw invalid_argument("Memory alignment must be > 0");
     }
     m_node_list.emplace_back(numeric_limits<size_t>::max(), block_state::FREE);
+    m_offset_index[0] = m_node_list.begin();
+    m_free_index.insert({numeric_limits<size_t>::max(), 0});
 }
 
 size_t pass::MemoryManager::allocate(size_t size)
@@ -126,41 +202,15 @@ size_t pass::MemoryManager::no_reuse_allocator(size_t size)
 size_t pass::MemoryManager::best_fit(size_t size)
 {
     size = align(size, m_alignment);
-    size_t offset = 0;
-    size_t min_delta = numeric_limits<size_t>::max();
-    auto best_fit = m_node_list.end();
-    size_t best_offset = offset;
-    for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
-    {
-        if (it->m_state == block_state::FREE && it->m_size >= size)
-        {
-            size_t delta = it->m_size - size;
-            if (delta < min_delta)
-            {
-                min_delta = delta;
-                best_fit = it;
-                best_offset = offset;
-            }
-        }
-        offset += it->m_size;
-    }
 
-    if (best_fit == m_node_list.end())
+    // Smallest free block that fits, lowest offset first among equal sizes
+    auto best_fit = m_free_index.lower_bound({size, 0});
+    if (best_fit == m_free_index.end())
     {
         throw bad_alloc();
     }
-
-    if (min_delta == 0)
-    {
-        // exact fit
-        best_fit->m_state = block_state::ALLOCATED;
-    }
-    else
-    {
-        m_node_list.insert(best_fit, node{size, block_state::ALLOCATED});
-        best_fit->m_size -= size;
-    }
-    m_max_allocated = max(m_max_allocated, best_offset + size);
+    size_t best_offset = best_fit->second;
+    allocate_block(m_offset_index.at(best_offset), best_offset, size);
 
     return best_offset;
 }
@@ -174,17 +224,7 @@ size_t pass::MemoryManager::first_fit(size_t size)
     {
         if (it->m_state == block_state::FREE && it->m_size >= size)
         {
-            if (it->m_size > size)
-            {
-                m_node_list.insert(it, node{size, block_state::ALLOCATED});
-                it->m_size -= size;
-            }
-            else
-            {
-                // exact fit
-                it->m_state = block_state::ALLOCATED;
-            }
-
+            allocate_block(it, offset, size);
             found = true;
             break;
         }
@@ -194,51 +234,68 @@ size_t pass::MemoryManager::first_fit(size_t size)
     {
         throw bad_alloc();
     }
-    m_max_allocated = max(m_max_allocated, offset + size);
 
     return offset;
 }
 
+void pass::MemoryManager::allocate_block(list<node>::iterator it, size_t offset, size_t size)
+{
+    m_free_index.erase({it->m_size, offset});
+    if (it->m_size > size)
+    {
+        auto allocated = m_node_list.insert(it, node{size, block_state::ALLOCATED});
+        it->m_size -= size;
+        m_offset_index[offset] = allocated;
+        m_offset_index[offset + size] = it;
+        m_free_index.insert({it->m_size, offset + size});
+    }
+    else
+    {
+        // exact fit
+        it->m_state = block_state::ALLOCATED;
+    }
+    m_max_allocated = max(m_max_allocated, offset + size);
+}
+
 void pass::MemoryManager::free(size_t offset)
 {
-    size_t search_offset = 0;
-    bool found = false;
-    for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
+    auto found = m_offset_index.find(offset);
+    if (found == m_offset_index.end())
     {
-        if (offset == search_offset)
+        throw runtime_error("bad free");
+    }
+    list<node>::iterator it = found->second;
+    if (it->is_free())
+    {
+        m_free_index.erase({it->m_size, offset});
+    }
+    if (it != m_node_list.begin())
+    {
+        // node has predecessor
+        list<node>::iterator it_prev = prev(it);
+        if (it_prev->m_state == block_state::FREE)
         {
-            list<node>::iterator it_next = next(it);
-            if (it == m_node_list.begin())
-            {
-                // free the first node in the list
-                it->m_state = block_state::FREE;
-            }
-            else
-            {
-                // node has predecessor
-                list<node>::iterator it_prev = prev(it);
-                if (it_prev->m_state == block_state::FREE)
-                {
-                    it->m_size += it_prev->m_size;
-                    m_node_list.erase(it_prev);
-                }
-            }
-            if (it_next != m_node_list.end() && it_next->m_state == block_state::FREE)
-            {
-                // join this node with next
-                it->m_size += it_next->m_size;
-                m_node_list.erase(it_next);
-            }
-            it->m_state = block_state::FREE;
-            found = true;
-            break;
+            size_t prev_offset = offset - it_prev->m_size;
+            m_free_index.erase({it_prev->m_size, prev_offset});
+            m_offset_index.erase(offset);
+            it->m_size += it_prev->m_size;
+            m_node_list.erase(it_prev);
+            m_offset_index[prev_offset] = it;
+            offset = prev_offset;
         }
-        search_offset += it->m_size;
     }
-    if (!found)
+    list<node>::iterator it_next = next(it);
+    if (it_next != m_node_list.end() && it_next->m_state == block_state::FREE)
     {
-        throw runtime_error("bad free");
+        // join this node with next
+        size_t next_offset = offset + it->m_size;
+        m_free_index.erase({it_next->m_size, next_offset});
+        m_offset_index.erase(next_offset);
+        it->m_size += it_next->m_size;
+        m_node_list.erase(it_next);
     }
+    it->m_state = block_state::FREE;
+    m_free_index.insert({it->m_size, offset});
 }
 
 void pass::MemoryManager::dump(ostream& out)
@@ -267,3 +324,100 @@ size_t pass::MemoryManager::align(size_t size, size_t alignment)
     }
     return size;
 }
+
+pass::MemoryPlanner::MemoryPlanner(size_t alignment)
+    : m_alignment{alignment}
+    , m_max_allocated{0}
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+}
+
+size_t pass::MemoryPlanner::add_buffer(size_t size, size_t first_use, size_t last_use)
+{
+    m_buffers.push_back({MemoryManager::align(size, m_alignment), first_use, last_use, 0});
+    return m_buffers.size() - 1;
+}
+
+void pass::MemoryPlanner::set_last_use(size_t buffer, size_t last_use)
+{
+    m_buffers.at(buffer).m_last_use = last_use;
+}
+
+void pass::MemoryPlanner::plan()
+{
+    size_t buffer_count = m_buffers.size();
+
+    // Sweep over the lifetimes in order of first use to find the buffers whose lifetimes
+    // intersect each buffer's own. Only those constrain where a buffer can go.
+    vector<size_t> by_first_use(buffer_count);
+    iota(by_first_use.begin(), by_first_use.end(), 0);
+    stable_sort(by_first_use.begin(), by_first_use.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].m_first_use < m_buffers[b].m_first_use;
+    });
+    vector<vector<size_t>> conflicts(buffer_count);
+    // Buffers that started earlier, by last use
+    multimap<size_t, size_t> live;
+    for (size_t id : by_first_use)
+    {
+        const buffer& current = m_buffers[id];
+        live.erase(live.begin(), live.lower_bound(current.m_first_use));
+        for (auto& other : live)
+        {
+            conflicts[id].push_back(other.second);
+            conflicts[other.second].push_back(id);
+        }
+        live.insert({current.m_last_use, id});
+    }
+
+    vector<size_t> order(buffer_count);
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].m_size > m_buffers[b].m_size;
+    });
+
+    vector<bool> placed(buffer_count, false);
+    // Offset and end of the placed buffers that conflict with the current one
+    vector<pair<size_t, size_t>> intervals;
+    m_max_allocated = 0;
+    for (size_t id : order)
+    {
+        buffer& current = m_buffers[id];
+        intervals.clear();
+        for (size_t other : conflicts[id])
+        {
+            if (placed[other])
+            {
+                const buffer& b = m_buffers[other];
+                intervals.push_back({b.m_offset, b.m_offset + b.m_size});
+            }
+        }
+        sort(intervals.begin(), intervals.end());
+
+        size_t best_offset = numeric_limits<size_t>::max();
+        size_t best_gap = numeric_limits<size_t>::max();
+        size_t prev_end = 0;
+        for (auto& interval : intervals)
+        {
+            if (interval.first >= prev_end)
+            {
+                size_t gap = interval.first - prev_end;
+                if (gap >= current.m_size && gap < best_gap)
+                {
+                    best_gap = gap;
+                    best_offset = prev_end;
+                }
+            }
+            prev_end = max(prev_end, interval.second);
+        }
+        if (best_offset == numeric_limits<size_t>::max())
+        {
+            best_offset = prev_end;
+        }
+        current.m_offset = best_offset;
+        placed[id] = true;
+        m_max_allocated = max(m_max_allocated, best_offset + current.m_size);
+    }
+}
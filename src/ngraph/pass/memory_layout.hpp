@@ -18,7 +18,10 @@
 
 #include <limits>
 #include <list>
+#include <map>
+#include <set>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -29,18 +32,26 @@ namespace ngraph
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class MemoryPlanner;
     }
 }
 
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    /// \param plan_offline Place all intermediates at once with MemoryPlanner instead of
+    ///                     allocating and freeing them in execution order
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 bool plan_offline = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
 private:
+    void plan_offline(std::shared_ptr<ngraph::Function> function);
+
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    bool m_plan_offline;
 };
 
 class ngraph::pass::MemoryManager
@@ -70,6 +81,7 @@ public:
     };
 
     MemoryManager(size_t alignment = 1, bool disable_reuse = false);
+    MemoryManager(size_t alignment, allocation_scheme scheme);
     // memory_manager& alignment(size_t a);
 
     size_t allocate(size_t size);
@@ -89,9 +101,50 @@ private:
     size_t first_fit(size_t size);
     size_t best_fit(size_t size);
     size_t no_reuse_allocator(size_t size);
+    void allocate_block(std::list<node>::iterator it, size_t offset, size_t size);
 
     std::list<node> m_node_list;
+    // Blocks by offset, and free blocks by (size, offset), so that free and
+    // best fit do not have to walk the block list
+    std::map<size_t, std::list<node>::iterator> m_offset_index;
+    std::set<std::pair<size_t, size_t>> m_free_index;
     size_t m_alignment;
     allocation_scheme m_scheme;
     size_t m_max_allocated;
 };
+
+/// \brief Offline memory planner for buffers whose lifetimes are all known up front.
+///
+/// Lifetimes are inclusive ranges of op indices. plan() places the buffers in order of
+/// decreasing size, each into the smallest gap left between placed buffers with an
+/// intersecting lifetime, or above them when no gap is large enough. The intersecting
+/// lifetimes are found up front by a sweep over first uses, so placing a buffer only looks at
+/// the buffers live alongside it rather than at every placed buffer.
+class ngraph::pass::MemoryPlanner
+{
+public:
+    MemoryPlanner(size_t alignment = 1);
+
+    /// \return The id of the new buffer
+    size_t add_buffer(size_t size,
+                      size_t first_use,
+                      size_t last_use = std::numeric_limits<size_t>::max());
+    void set_last_use(size_t buffer, size_t last_use);
+
+    void plan();
+
+    size_t get_offset(size_t buffer) const { return m_buffers.at(buffer).m_offset; }
+    size_t max_allocated() const { return m_max_allocated; }
+private:
+    struct buffer
+    {
+        size_t m_size;
+        size_t m_first_use;
+        size_t m_last_use;
+        size_t m_offset;
+    };
+
+    std::vector<buffer> m_buffers;
+    size_t m_alignment;
+    size_t m_max_allocated;
+};
@@ -35,6 +35,8 @@ runtime::AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment)
 
 void runtime::AlignedBuffer::initialize(size_t byte_size, size_t alignment)
 {
+    m_allocated_buffer = nullptr;
+    m_aligned_buffer = nullptr;
     m_byte_size = byte_size;
     if (m_byte_size > 0)
     {
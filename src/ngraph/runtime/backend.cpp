@@ -43,6 +43,11 @@ void runtime::Backend::remove_compiled_function(shared_ptr<Function> func)
 {
 }
 
+bool runtime::Backend::is_supported(const Node& node) const
+{
+    return true;
+}
+
 vector<ngraph::runtime::PerformanceCounter>
     runtime::Backend::get_performance_data(shared_ptr<Function> func) const
 {
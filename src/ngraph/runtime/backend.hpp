@@ -102,6 +102,11 @@ public:
         return call(func, outputs, inputs);
     }
 
+    /// \brief Test if the backend can execute an op.
+    /// \param node The node to test
+    /// \returns true if the backend has a kernel for the op of node
+    virtual bool is_supported(const Node& node) const;
+
     /// \brief Compiled functions may be cached. This function removes a compiled function
     ///     from the cache.
     /// \param func The function to execute
@@ -15,9 +15,12 @@
 //*****************************************************************************
 #ifdef NGRAPH_DISTRIBUTED
 
+#include <cstring>
+
 #include "ngraph/op/allreduce.hpp"
 #include <mpi.h>
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/reference/allreduce.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -33,8 +36,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 auto count = static_cast<int>(out[0].get_size());
                 auto data_type = MPI_FLOAT;
 
@@ -47,15 +50,98 @@ namespace ngraph
                     data_type = MPI_DOUBLE;
                 }
 
-                auto functor = [&, count, data_type](CPURuntimeContext* ctx) {
-                    MPI_Allreduce(
-                        arg_tensor, out_tensor, count, data_type, MPI_SUM, MPI_COMM_WORLD);
+                auto functor = [&, count, data_type, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx) {
+                    MPI_Allreduce(ctx->buffer_data[arg_buffer_index],
+                                  ctx->buffer_data[out_buffer_index],
+                                  count,
+                                  data_type,
+                                  MPI_SUM,
+                                  MPI_COMM_WORLD);
+                };
+
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AllReduceStart)
+            {
+                auto& functors = external_function->get_functors();
+
+                vector<size_t> arg_buffer_indices;
+                vector<size_t> arg_sizes;
+                for (auto& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                    arg_sizes.push_back(arg.get_size() * arg.get_element_type().size());
+                }
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = static_cast<int>(out[0].get_size());
+                auto data_type = reference::get_mpi_data_type(out[0].get_element_type());
+                auto request_index =
+                    external_function->get_allreduce_request_index(node->get_name());
+
+                auto functor = [&,
+                                arg_buffer_indices,
+                                arg_sizes,
+                                out_buffer_index,
+                                count,
+                                data_type,
+                                request_index](CPURuntimeContext* ctx) {
+                    char* buffer = static_cast<char*>(ctx->buffer_data[out_buffer_index]);
+                    for (size_t i = 0; i < arg_buffer_indices.size(); i++)
+                    {
+                        memcpy(buffer, ctx->buffer_data[arg_buffer_indices[i]], arg_sizes[i]);
+                        buffer += arg_sizes[i];
+                    }
+                    MPI_Iallreduce(MPI_IN_PLACE,
+                                   ctx->buffer_data[out_buffer_index],
+                                   count,
+                                   data_type,
+                                   MPI_SUM,
+                                   MPI_COMM_WORLD,
+                                   &ctx->allreduce_requests[request_index]);
+                };
+
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AllReduceWait)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                vector<size_t> out_buffer_indices;
+                vector<size_t> out_sizes;
+                for (auto& output : out)
+                {
+                    out_buffer_indices.push_back(
+                        external_function->get_buffer_index(output.get_name()));
+                    out_sizes.push_back(output.get_size() * output.get_element_type().size());
+                }
+                auto request_index = external_function->get_allreduce_request_index(
+                    node->get_argument(0)->get_name());
+
+                auto functor = [&, arg_buffer_index, out_buffer_indices, out_sizes, request_index](
+                    CPURuntimeContext* ctx) {
+                    MPI_Wait(&ctx->allreduce_requests[request_index], MPI_STATUS_IGNORE);
+                    const char* buffer =
+                        static_cast<const char*>(ctx->buffer_data[arg_buffer_index]);
+                    for (size_t i = 0; i < out_buffer_indices.size(); i++)
+                    {
+                        memcpy(ctx->buffer_data[out_buffer_indices[i]], buffer, out_sizes[i]);
+                        buffer += out_sizes[i];
+                    }
                 };
 
                 functors.emplace_back(functor);
             }
 
             REGISTER_OP_BUILDER(AllReduce);
+            REGISTER_OP_BUILDER(AllReduceStart);
+            REGISTER_OP_BUILDER(AllReduceWait);
         }
     }
 }
@@ -33,13 +33,12 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::ArgMax)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
                 const ngraph::op::ArgMax* argmax = static_cast<const ngraph::op::ArgMax*>(node);
                 function<void(CPURuntimeContext*)> functor;
 
-                auto& arg_tensor = tensor_data[args[0].get_name()];
-                auto& out_tensor = tensor_data[out[0].get_name()];
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 if (out[0].get_element_type() != element::i64 &&
                     out[0].get_element_type() != element::i32)
                 {
@@ -55,10 +54,15 @@ namespace ngraph
                 {
                     if (is_int64)
                     {
-                        functor = [&, in_shape, out_shape, axis](CPURuntimeContext* ctx) {
+                        functor = [&,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx) {
                             ngraph::runtime::reference::argmax<float, int64_t>(
-                                static_cast<float*>(arg_tensor),
-                                static_cast<int64_t*>(out_tensor),
+                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<int64_t*>(ctx->buffer_data[out_buffer_index]),
                                 in_shape,
                                 out_shape,
                                 axis);
@@ -66,10 +70,15 @@ namespace ngraph
                     }
                     else
                     {
-                        functor = [&, in_shape, out_shape, axis](CPURuntimeContext* ctx) {
+                        functor = [&,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx) {
                             ngraph::runtime::reference::argmax<float, int32_t>(
-                                static_cast<float*>(arg_tensor),
-                                static_cast<int*>(out_tensor),
+                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
                                 in_shape,
                                 out_shape,
                                 axis);
@@ -80,10 +89,15 @@ namespace ngraph
                 {
                     if (is_int64)
                     {
-                        functor = [&, in_shape, out_shape, axis](CPURuntimeContext* ctx) {
+                        functor = [&,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx) {
                             ngraph::runtime::reference::argmax<double, int64_t>(
-                                static_cast<double*>(arg_tensor),
-                                static_cast<int64_t*>(out_tensor),
+                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<int64_t*>(ctx->buffer_data[out_buffer_index]),
                                 in_shape,
                                 out_shape,
                                 axis);
@@ -91,10 +105,15 @@ namespace ngraph
                     }
                     else
                     {
-                        functor = [&, in_shape, out_shape, axis](CPURuntimeContext* ctx) {
+                        functor = [&,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx) {
                             ngraph::runtime::reference::argmax<double, int32_t>(
-                                static_cast<double*>(arg_tensor),
-                                static_cast<int*>(out_tensor),
+                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
                                 in_shape,
                                 out_shape,
                                 axis);
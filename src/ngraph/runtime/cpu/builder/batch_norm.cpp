@@ -42,10 +42,10 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
-                auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 const OP* batchnorm = static_cast<const OP*>(node);
 
@@ -74,8 +74,8 @@ namespace ngraph
 
                 if (batchnorm->get_training_flag() && args.size() == 3)
                 {
-                    auto& out1_tensor = external_function->get_tensor_data(out[1].get_name());
-                    auto& out2_tensor = external_function->get_tensor_data(out[2].get_name());
+                    auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
+                    auto out2_buffer_index = external_function->get_buffer_index(out[2].get_name());
 
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                     auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 2);
@@ -98,17 +98,32 @@ namespace ngraph
                                                                 ops);
 
                     auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
-                    auto functor = [&, batchnorm_index, stacked_weights, weight_sizes](
-                        CPURuntimeContext* ctx) {
-                        memcpy(stacked_weights.get(), arg0_tensor, weight_sizes[0]);
-                        memcpy(
-                            stacked_weights.get() + weight_sizes[0], arg1_tensor, weight_sizes[1]);
-
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg2_tensor);
+                    auto functor = [&,
+                                    batchnorm_index,
+                                    stacked_weights,
+                                    weight_sizes,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    arg2_buffer_index,
+                                    out0_buffer_index,
+                                    out1_buffer_index,
+                                    out2_buffer_index](CPURuntimeContext* ctx) {
+                        memcpy(stacked_weights.get(),
+                               ctx->buffer_data[arg0_buffer_index],
+                               weight_sizes[0]);
+                        memcpy(stacked_weights.get() + weight_sizes[0],
+                               ctx->buffer_data[arg1_buffer_index],
+                               weight_sizes[1]);
+
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg2_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], stacked_weights.get());
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[3], out1_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[4], out2_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[2], ctx->buffer_data[out0_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[3], ctx->buffer_data[out1_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[4], ctx->buffer_data[out2_buffer_index]);
 
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, batchnorm_index);
                     };
@@ -116,8 +131,10 @@ namespace ngraph
                 }
                 else
                 {
-                    auto& arg3_tensor = external_function->get_tensor_data(args[3].get_name());
-                    auto& arg4_tensor = external_function->get_tensor_data(args[4].get_name());
+                    auto arg3_buffer_index =
+                        external_function->get_buffer_index(args[3].get_name());
+                    auto arg4_buffer_index =
+                        external_function->get_buffer_index(args[4].get_name());
 
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                     auto weights_shape = Shape{2, args[0].get_size()};
@@ -141,17 +158,32 @@ namespace ngraph
 
                     auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
 
-                    auto functor = [&, batchnorm_index, stacked_weights, weight_sizes](
-                        CPURuntimeContext* ctx) {
-                        memcpy(stacked_weights.get(), arg0_tensor, weight_sizes[0]);
-                        memcpy(
-                            stacked_weights.get() + weight_sizes[0], arg1_tensor, weight_sizes[1]);
-
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg2_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg3_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], arg4_tensor);
+                    auto functor = [&,
+                                    batchnorm_index,
+                                    stacked_weights,
+                                    weight_sizes,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    arg2_buffer_index,
+                                    arg3_buffer_index,
+                                    arg4_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        memcpy(stacked_weights.get(),
+                               ctx->buffer_data[arg0_buffer_index],
+                               weight_sizes[0]);
+                        memcpy(stacked_weights.get() + weight_sizes[0],
+                               ctx->buffer_data[arg1_buffer_index],
+                               weight_sizes[1]);
+
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg2_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[arg3_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[2], ctx->buffer_data[arg4_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(ctx, deps[3], stacked_weights.get());
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[4], out0_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[4], ctx->buffer_data[out0_buffer_index]);
 
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, batchnorm_index);
                     };
@@ -180,23 +212,38 @@ namespace ngraph
                                       runtime::cpu::kernel::batch_norm_three_outputs);
 
                         auto arg2_shape = args[2].get_shape();
-                        auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                        auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                        auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
-
-                        auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-                        auto& out1_tensor = external_function->get_tensor_data(out[1].get_name());
-                        auto& out2_tensor = external_function->get_tensor_data(out[2].get_name());
+                        auto arg0_buffer_index =
+                            external_function->get_buffer_index(args[0].get_name());
+                        auto arg1_buffer_index =
+                            external_function->get_buffer_index(args[1].get_name());
+                        auto arg2_buffer_index =
+                            external_function->get_buffer_index(args[2].get_name());
+
+                        auto out0_buffer_index =
+                            external_function->get_buffer_index(out[0].get_name());
+                        auto out1_buffer_index =
+                            external_function->get_buffer_index(out[1].get_name());
+                        auto out2_buffer_index =
+                            external_function->get_buffer_index(out[2].get_name());
                         auto eps = batchnorm->get_eps_value();
 
-                        auto functor = [&, kernel, arg2_shape, eps](CPURuntimeContext* ctx) {
+                        auto functor = [&,
+                                        kernel,
+                                        arg2_shape,
+                                        eps,
+                                        arg0_buffer_index,
+                                        arg1_buffer_index,
+                                        arg2_buffer_index,
+                                        out0_buffer_index,
+                                        out1_buffer_index,
+                                        out2_buffer_index](CPURuntimeContext* ctx) {
                             kernel(eps,
-                                   arg0_tensor,
-                                   arg1_tensor,
-                                   arg2_tensor,
-                                   out0_tensor,
-                                   out1_tensor,
-                                   out2_tensor,
+                                   ctx->buffer_data[arg0_buffer_index],
+                                   ctx->buffer_data[arg1_buffer_index],
+                                   ctx->buffer_data[arg2_buffer_index],
+                                   ctx->buffer_data[out0_buffer_index],
+                                   ctx->buffer_data[out1_buffer_index],
+                                   ctx->buffer_data[out2_buffer_index],
                                    arg2_shape);
                         };
                         functors.emplace_back(functor);
@@ -213,23 +260,38 @@ namespace ngraph
                                       runtime::cpu::kernel::batch_norm_one_output);
 
                         auto arg2_shape = args[2].get_shape();
-                        auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                        auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                        auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
-                        auto& arg3_tensor = external_function->get_tensor_data(args[3].get_name());
-                        auto& arg4_tensor = external_function->get_tensor_data(args[4].get_name());
-
-                        auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
+                        auto arg0_buffer_index =
+                            external_function->get_buffer_index(args[0].get_name());
+                        auto arg1_buffer_index =
+                            external_function->get_buffer_index(args[1].get_name());
+                        auto arg2_buffer_index =
+                            external_function->get_buffer_index(args[2].get_name());
+                        auto arg3_buffer_index =
+                            external_function->get_buffer_index(args[3].get_name());
+                        auto arg4_buffer_index =
+                            external_function->get_buffer_index(args[4].get_name());
+
+                        auto out0_buffer_index =
+                            external_function->get_buffer_index(out[0].get_name());
                         auto eps = batchnorm->get_eps_value();
 
-                        auto functor = [&, kernel, arg2_shape, eps](CPURuntimeContext* ctx) {
+                        auto functor = [&,
+                                        kernel,
+                                        arg2_shape,
+                                        eps,
+                                        arg0_buffer_index,
+                                        arg1_buffer_index,
+                                        arg2_buffer_index,
+                                        arg3_buffer_index,
+                                        arg4_buffer_index,
+                                        out0_buffer_index](CPURuntimeContext* ctx) {
                             kernel(eps,
-                                   arg0_tensor,
-                                   arg1_tensor,
-                                   arg2_tensor,
-                                   arg3_tensor,
-                                   arg4_tensor,
-                                   out0_tensor,
+                                   ctx->buffer_data[arg0_buffer_index],
+                                   ctx->buffer_data[arg1_buffer_index],
+                                   ctx->buffer_data[arg2_buffer_index],
+                                   ctx->buffer_data[arg3_buffer_index],
+                                   ctx->buffer_data[arg4_buffer_index],
+                                   ctx->buffer_data[out0_buffer_index],
                                    arg2_shape);
                         };
                         functors.emplace_back(functor);
@@ -250,16 +312,16 @@ namespace ngraph
 
                 auto& functors = external_function->get_functors();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
-                auto& arg3_tensor = external_function->get_tensor_data(args[3].get_name());
-                auto& arg4_tensor = external_function->get_tensor_data(args[4].get_name());
-                auto& arg5_tensor = external_function->get_tensor_data(args[5].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto arg3_buffer_index = external_function->get_buffer_index(args[3].get_name());
+                auto arg4_buffer_index = external_function->get_buffer_index(args[4].get_name());
+                auto arg5_buffer_index = external_function->get_buffer_index(args[5].get_name());
 
-                auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-                auto& out1_tensor = external_function->get_tensor_data(out[1].get_name());
-                auto& out2_tensor = external_function->get_tensor_data(out[2].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
+                auto out2_buffer_index = external_function->get_buffer_index(out[2].get_name());
 
 // Kill clang diagnostics bug
 #pragma clang diagnostic push
@@ -302,22 +364,44 @@ namespace ngraph
                                 batchnorm_index,
                                 stacked_weights,
                                 stacked_dweights,
-                                weight_sizes](CPURuntimeContext* ctx) {
-                    memcpy(stacked_weights.get(), arg0_tensor, weight_sizes[0]);
-                    memcpy(stacked_weights.get() + weight_sizes[0], arg1_tensor, weight_sizes[1]);
+                                weight_sizes,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                arg3_buffer_index,
+                                arg4_buffer_index,
+                                arg5_buffer_index,
+                                out0_buffer_index,
+                                out1_buffer_index,
+                                out2_buffer_index](CPURuntimeContext* ctx) {
+                    memcpy(stacked_weights.get(),
+                           ctx->buffer_data[arg0_buffer_index],
+                           weight_sizes[0]);
+                    memcpy(stacked_weights.get() + weight_sizes[0],
+                           ctx->buffer_data[arg1_buffer_index],
+                           weight_sizes[1]);
 
                     cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], stacked_weights.get());
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg2_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], arg3_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[3], arg4_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[4], arg5_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[5], out0_tensor);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[1], ctx->buffer_data[arg2_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[2], ctx->buffer_data[arg3_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[3], ctx->buffer_data[arg4_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[4], ctx->buffer_data[arg5_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[5], ctx->buffer_data[out0_buffer_index]);
                     cpu::mkldnn_utils::set_memory_ptr(ctx, deps[6], stacked_dweights.get());
 
                     cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, batchnorm_index);
 
-                    memcpy(out1_tensor, stacked_dweights.get(), weight_sizes[0]);
-                    memcpy(out2_tensor, stacked_dweights.get() + weight_sizes[0], weight_sizes[1]);
+                    memcpy(ctx->buffer_data[out1_buffer_index],
+                           stacked_dweights.get(),
+                           weight_sizes[0]);
+                    memcpy(ctx->buffer_data[out2_buffer_index],
+                           stacked_dweights.get() + weight_sizes[0],
+                           weight_sizes[1]);
                 };
                 functors.emplace_back(functor);
             }
@@ -37,8 +37,8 @@ namespace ngraph
                 auto broadcast = static_cast<const ngraph::op::Broadcast*>(node);
                 auto broadcast_axes = broadcast->get_broadcast_axes();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto arg_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
@@ -129,8 +129,11 @@ namespace ngraph
                 if (broadcast_axes.empty())
                 {
                     size_t size = out[0].get_size() * out[0].get_element_type().size();
-                    auto functor = [&, size](CPURuntimeContext* ctx) {
-                        memcpy(out_tensor, arg_tensor, size);
+                    auto functor = [&, size, out_buffer_index, arg_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        memcpy(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[arg_buffer_index],
+                               size);
                     };
                     functors.emplace_back(functor);
                     return;
@@ -165,10 +168,17 @@ namespace ngraph
                 SELECT_KERNEL_BY_RANK(
                     kernel, args[0].get_element_type(), out_rank, runtime::cpu::kernel::broadcast);
 
-                auto functor =
-                    [&, kernel, expanded_input_shape, out_shape](CPURuntimeContext* ctx) {
-                        kernel(arg_tensor, out_tensor, expanded_input_shape, out_shape);
-                    };
+                auto functor = [&,
+                                kernel,
+                                expanded_input_shape,
+                                out_shape,
+                                arg_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           expanded_input_shape,
+                           out_shape);
+                };
                 functors.emplace_back(functor);
             }
 
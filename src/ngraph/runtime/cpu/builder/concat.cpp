@@ -37,19 +37,19 @@ namespace ngraph
 
                 auto& functors = external_function->get_functors();
 
-                vector<reference_wrapper<void*>> arg_tensors;
+                vector<size_t> arg_buffer_indices;
                 vector<Shape> arg_shapes;
                 for (auto& arg : args)
                 {
                     if (shape_size(arg.get_shape()))
                     {
-                        arg_tensors.emplace_back(
-                            external_function->get_tensor_data(arg.get_name()));
+                        arg_buffer_indices.emplace_back(
+                            external_function->get_buffer_index(arg.get_name()));
                         arg_shapes.emplace_back(arg.get_shape());
                     }
                 }
 
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 auto out_shape = out[0].get_shape();
 
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
@@ -70,12 +70,15 @@ namespace ngraph
                         mkldnn_emitter->build_concat(inputs_data_desc, result_desc, concat_dim);
                     auto& deps = mkldnn_emitter->get_primitive_deps(concat_index);
 
-                    auto functor = [&, arg_tensors, nargs, concat_index](CPURuntimeContext* ctx) {
+                    auto functor = [&, arg_buffer_indices, nargs, concat_index, out_buffer_index](
+                        CPURuntimeContext* ctx) {
                         for (size_t i = 0; i < nargs; i++)
                         {
-                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[i], arg_tensors[i]);
+                            cpu::mkldnn_utils::set_memory_ptr(
+                                ctx, deps[i], ctx->buffer_data[arg_buffer_indices[i]]);
                         }
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[nargs], out_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[nargs], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, concat_index);
                     };
 
@@ -90,9 +93,23 @@ namespace ngraph
                                           out[0].get_shape().size(),
                                           runtime::cpu::kernel::concat);
 
-                    auto functor = [&, kernel, arg_tensors, arg_shapes, out_shape, axis](
-                        CPURuntimeContext* ctx) {
-                        kernel(arg_tensors, arg_shapes, out_tensor, out_shape, axis);
+                    auto functor = [&,
+                                    kernel,
+                                    arg_buffer_indices,
+                                    arg_shapes,
+                                    out_shape,
+                                    axis,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        vector<void*> arg_tensors;
+                        for (auto index : arg_buffer_indices)
+                        {
+                            arg_tensors.push_back(ctx->buffer_data[index]);
+                        }
+                        kernel(arg_tensors,
+                               arg_shapes,
+                               ctx->buffer_data[out_buffer_index],
+                               out_shape,
+                               axis);
                     };
                     functors.emplace_back(functor);
                 }
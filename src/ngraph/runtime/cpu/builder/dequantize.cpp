@@ -36,8 +36,8 @@ namespace ngraph
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
                     auto& functors = external_function->get_functors();
-                    auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                    auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                    auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
 
                     auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
@@ -47,9 +47,12 @@ namespace ngraph
                         mkldnn_emitter->build_dequantization(node, input_desc, result_desc);
 
                     auto& deps = mkldnn_emitter->get_primitive_deps(dequantize_index);
-                    auto functor = [&, dequantize_index](CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    auto functor = [&, dequantize_index, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, dequantize_index);
                     };
                     functors.emplace_back(functor);
@@ -42,9 +42,9 @@ namespace ngraph
                 auto arg1_shape = args[1].get_shape();
                 auto result_shape = out[0].get_shape();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto reduction_axes_count = dot->get_reduction_axes_count();
 
@@ -58,20 +58,25 @@ namespace ngraph
                 if (!shape_size(arg0_shape) || !shape_size(arg1_shape))
                 {
                     auto size = shape_size(result_shape) * out[0].get_element_type().size();
-                    auto functor = [&, size](CPURuntimeContext* ctx) {
-                        memset(out_tensor, 0, size);
+                    auto functor = [&, size, out_buffer_index](CPURuntimeContext* ctx) {
+                        memset(ctx->buffer_data[out_buffer_index], 0, size);
                     };
                     functors.emplace_back(functor);
                     return;
                 }
 
-                if (arg0_shape.empty() || arg1_shape.empty())
+                // The Eigen and MKL kernels below would accumulate bfloat16 dots in bfloat16,
+                // so those go to the reference kernel, which accumulates in float
+                bool is_bf16 = out[0].get_element_type() == element::bf16;
+
+                if (!is_bf16 && (arg0_shape.empty() || arg1_shape.empty()))
                 {
                     auto first = (arg0_shape.empty() ? args[0] : args[1]);
                     auto second = (arg0_shape.empty() ? args[1] : args[0]);
 
-                    auto& first_tensor = external_function->get_tensor_data(first.get_name());
-                    auto& second_tensor = external_function->get_tensor_data(second.get_name());
+                    auto first_buffer_index = external_function->get_buffer_index(first.get_name());
+                    auto second_buffer_index =
+                        external_function->get_buffer_index(second.get_name());
 
                     std::function<decltype(runtime::cpu::kernel::dot_scalar<float>)> kernel;
 
@@ -80,14 +85,22 @@ namespace ngraph
 
                     auto element_count = shape_size(second.get_shape());
 
-                    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {
-                        kernel(first_tensor, second_tensor, out_tensor, element_count);
+                    auto functor = [&,
+                                    kernel,
+                                    element_count,
+                                    first_buffer_index,
+                                    second_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[first_buffer_index],
+                               ctx->buffer_data[second_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               element_count);
                     };
                     functors.emplace_back(functor);
                     return;
                 }
 
-                if ((arg0_shape.size() == 1) && (arg1_shape.size() == 1) &&
+                if (!is_bf16 && (arg0_shape.size() == 1) && (arg1_shape.size() == 1) &&
                     reduction_axes_count == 1)
                 {
                     std::function<decltype(runtime::cpu::kernel::dot_1d_1d_1rd<float>)> kernel;
@@ -95,20 +108,26 @@ namespace ngraph
                     SELECT_KERNEL(
                         kernel, out[0].get_element_type(), runtime::cpu::kernel::dot_1d_1d_1rd);
 
-                    auto functor =
-                        [&, kernel, arg0_shape, arg1_shape, result_shape](CPURuntimeContext* ctx) {
-                            kernel(arg0_tensor,
-                                   arg1_tensor,
-                                   out_tensor,
-                                   arg0_shape,
-                                   arg1_shape,
-                                   result_shape);
-                        };
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    result_shape,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg0_shape,
+                               arg1_shape,
+                               result_shape);
+                    };
                     functors.emplace_back(functor);
                     return;
                 }
 
-                if ((arg0_shape.size() == 2) && (arg1_shape.size() == 1) &&
+                if (!is_bf16 && (arg0_shape.size() == 2) && (arg1_shape.size() == 1) &&
                     reduction_axes_count == 1)
                 {
                     std::function<decltype(runtime::cpu::kernel::dot_2d_1d_1rd<float>)> kernel;
@@ -116,20 +135,26 @@ namespace ngraph
                     SELECT_KERNEL(
                         kernel, out[0].get_element_type(), runtime::cpu::kernel::dot_2d_1d_1rd);
 
-                    auto functor =
-                        [&, kernel, arg0_shape, arg1_shape, result_shape](CPURuntimeContext* ctx) {
-                            kernel(arg0_tensor,
-                                   arg1_tensor,
-                                   out_tensor,
-                                   arg0_shape,
-                                   arg1_shape,
-                                   result_shape);
-                        };
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    result_shape,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg0_shape,
+                               arg1_shape,
+                               result_shape);
+                    };
                     functors.emplace_back(functor);
                     return;
                 }
 
-                if ((arg0_shape.size() == 3) && (arg1_shape.size() == 3) &&
+                if (!is_bf16 && (arg0_shape.size() == 3) && (arg1_shape.size() == 3) &&
                     reduction_axes_count == 1)
                 {
                     std::function<decltype(runtime::cpu::kernel::dot_3d_3d_1rd<float>)> kernel;
@@ -137,20 +162,26 @@ namespace ngraph
                     SELECT_KERNEL(
                         kernel, out[0].get_element_type(), runtime::cpu::kernel::dot_3d_3d_1rd);
 
-                    auto functor =
-                        [&, kernel, arg0_shape, arg1_shape, result_shape](CPURuntimeContext* ctx) {
-                            kernel(arg0_tensor,
-                                   arg1_tensor,
-                                   out_tensor,
-                                   arg0_shape,
-                                   arg1_shape,
-                                   result_shape);
-                        };
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    result_shape,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg0_shape,
+                               arg1_shape,
+                               result_shape);
+                    };
                     functors.emplace_back(functor);
                     return;
                 }
 
-                if ((arg0_shape.size() == 3) && (arg1_shape.size() == 2) &&
+                if (!is_bf16 && (arg0_shape.size() == 3) && (arg1_shape.size() == 2) &&
                     reduction_axes_count == 1)
                 {
                     if (args[0].get_element_type() == element::f32)
@@ -171,56 +202,68 @@ namespace ngraph
                         const int64_t group_count = 1;
                         const int64_t group_size = shape_a[0];
 
-                        auto functor =
-                            [&, offset_a, offset_b, offset_c, m, n, k, group_size, group_count](
-                                CPURuntimeContext* ctx) {
-                                cblas::Transpose transpose = cblas::Transpose::None;
-                                float alpha = 1.0f;
-
-                                vector<const float*> a;
-                                for (size_t i = 0; i < group_size; i++)
-                                {
-                                    a.emplace_back(static_cast<const float*>(arg0_tensor) +
-                                                   i * offset_a);
-                                }
-                                const float** a_array = a.data();
-                                int64_t lda_array = std::max(int64_t(1), k);
-
-                                vector<const float*> b;
-                                for (size_t i = 0; i < group_size; i++)
-                                {
-                                    b.emplace_back(static_cast<const float*>(arg1_tensor) +
-                                                   i * offset_b);
-                                }
-                                const float** b_array = b.data();
-                                const int64_t ldb_array = std::max(int64_t(1), n);
-                                float beta = 0.0f;
-
-                                vector<float*> c;
-                                for (size_t i = 0; i < group_size; i++)
-                                {
-                                    c.emplace_back(static_cast<float*>(out_tensor) + i * offset_c);
-                                }
-                                float** c_array = c.data();
-                                const int64_t ldc_array = std::max(int64_t(1), n);
-
-                                cblas_sgemm_batch(cblas::Layout::RowMajor,
-                                                  &transpose,
-                                                  &transpose,
-                                                  &m,
-                                                  &n,
-                                                  &k,
-                                                  &alpha,
-                                                  a_array,
-                                                  &lda_array,
-                                                  b_array,
-                                                  &ldb_array,
-                                                  &beta,
-                                                  c_array,
-                                                  &ldc_array,
-                                                  group_count,
-                                                  &group_size);
-                            };
+                        auto functor = [&,
+                                        offset_a,
+                                        offset_b,
+                                        offset_c,
+                                        m,
+                                        n,
+                                        k,
+                                        group_size,
+                                        group_count,
+                                        arg0_buffer_index,
+                                        arg1_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx) {
+                            cblas::Transpose transpose = cblas::Transpose::None;
+                            float alpha = 1.0f;
+
+                            vector<const float*> a;
+                            auto a_base =
+                                static_cast<const float*>(ctx->buffer_data[arg0_buffer_index]);
+                            for (size_t i = 0; i < group_size; i++)
+                            {
+                                a.emplace_back(a_base + i * offset_a);
+                            }
+                            const float** a_array = a.data();
+                            int64_t lda_array = std::max(int64_t(1), k);
+
+                            vector<const float*> b;
+                            auto b_base =
+                                static_cast<const float*>(ctx->buffer_data[arg1_buffer_index]);
+                            for (size_t i = 0; i < group_size; i++)
+                            {
+                                b.emplace_back(b_base + i * offset_b);
+                            }
+                            const float** b_array = b.data();
+                            const int64_t ldb_array = std::max(int64_t(1), n);
+                            float beta = 0.0f;
+
+                            vector<float*> c;
+                            auto c_base = static_cast<float*>(ctx->buffer_data[out_buffer_index]);
+                            for (size_t i = 0; i < group_size; i++)
+                            {
+                                c.emplace_back(c_base + i * offset_c);
+                            }
+                            float** c_array = c.data();
+                            const int64_t ldc_array = std::max(int64_t(1), n);
+
+                            cblas_sgemm_batch(cblas::Layout::RowMajor,
+                                              &transpose,
+                                              &transpose,
+                                              &m,
+                                              &n,
+                                              &k,
+                                              &alpha,
+                                              a_array,
+                                              &lda_array,
+                                              b_array,
+                                              &ldb_array,
+                                              &beta,
+                                              c_array,
+                                              &ldc_array,
+                                              group_count,
+                                              &group_size);
+                        };
                         functors.emplace_back(functor);
                         return;
                     }
@@ -231,11 +274,17 @@ namespace ngraph
                         SELECT_KERNEL(
                             kernel, out[0].get_element_type(), runtime::cpu::kernel::dot_3d_2d_1rd);
 
-                        auto functor = [&, kernel, arg0_shape, arg1_shape, result_shape](
-                            CPURuntimeContext* ctx) {
-                            kernel(arg0_tensor,
-                                   arg1_tensor,
-                                   out_tensor,
+                        auto functor = [&,
+                                        kernel,
+                                        arg0_shape,
+                                        arg1_shape,
+                                        result_shape,
+                                        arg0_buffer_index,
+                                        arg1_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx) {
+                            kernel(ctx->buffer_data[arg0_buffer_index],
+                                   ctx->buffer_data[arg1_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
                                    arg0_shape,
                                    arg1_shape,
                                    result_shape);
@@ -247,19 +296,26 @@ namespace ngraph
 
                 std::function<decltype(runtime::cpu::kernel::dot<float>)> kernel;
 
-                SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::dot);
-
-                auto functor =
-                    [&, kernel, arg0_shape, arg1_shape, result_shape, reduction_axes_count](
-                        CPURuntimeContext* ctx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
-                               arg0_shape,
-                               arg1_shape,
-                               result_shape,
-                               reduction_axes_count);
-                    };
+                SELECT_KERNEL_WITH_BF16(
+                    kernel, out[0].get_element_type(), runtime::cpu::kernel::dot);
+
+                auto functor = [&,
+                                kernel,
+                                arg0_shape,
+                                arg1_shape,
+                                result_shape,
+                                reduction_axes_count,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           arg0_shape,
+                           arg1_shape,
+                           result_shape,
+                           reduction_axes_count);
+                };
                 functors.emplace_back(functor);
             }
 
@@ -15,9 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/op/function_call.hpp"
-#include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/tensor.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -33,28 +31,20 @@ namespace ngraph
             {
                 auto function_call = static_cast<const ngraph::op::FunctionCall*>(node);
                 auto function = function_call->get_functions()[0];
-                auto backend = runtime::Backend::create("CPU");
 
                 auto& functors = external_function->get_functors();
                 auto& callees = external_function->get_callees();
 
-                // Note: We bypass the completely broken ngraph "backend" API here
-                vector<reference_wrapper<void *>> arg_tensors, out_tensors;
-                vector<Shape> arg_shapes, out_shapes;
-                vector<element::Type> arg_types, out_types;
-
+                vector<size_t> arg_buffer_indices, out_buffer_indices;
                 for (const auto& arg : args)
                 {
-                    arg_shapes.emplace_back(arg.get_shape());
-                    arg_types.emplace_back(arg.get_element_type());
-                    arg_tensors.emplace_back(external_function->get_tensor_data(arg.get_name()));
+                    arg_buffer_indices.emplace_back(
+                        external_function->get_buffer_index(arg.get_name()));
                 }
-
                 for (const auto& result : out)
                 {
-                    out_shapes.emplace_back(result.get_shape());
-                    out_types.emplace_back(result.get_element_type());
-                    out_tensors.emplace_back(external_function->get_tensor_data(result.get_name()));
+                    out_buffer_indices.emplace_back(
+                        external_function->get_buffer_index(result.get_name()));
                 }
 
                 if (!callees.count(function->get_name()))
@@ -62,29 +52,24 @@ namespace ngraph
                     callees[function->get_name()] = make_shared<CPU_ExternalFunction>(function);
                 }
 
-                auto& callee_external_function = callees[function->get_name()];
+                // Every call frame of the caller owns a call frame of the callee that lives
+                // in its temporary pool, so a call allocates nothing
+                auto callee_frame_index =
+                    external_function->add_callee_frame(callees[function->get_name()]);
 
-                auto functor = [&,
-                                backend,
-                                arg_shapes,
-                                arg_types,
-                                arg_tensors,
-                                out_shapes,
-                                out_types,
-                                out_tensors](CPURuntimeContext* ctx) {
-                    TensorViewPtrs inputs, outputs;
-                    for (int i = 0; i < arg_shapes.size(); i++)
+                auto functor = [arg_buffer_indices, out_buffer_indices, callee_frame_index](
+                    CPURuntimeContext* ctx) {
+                    auto call_frame = ctx->callee_frames[callee_frame_index];
+                    auto& inputs = call_frame->get_input_buffers();
+                    auto& outputs = call_frame->get_output_buffers();
+                    for (size_t i = 0; i < arg_buffer_indices.size(); i++)
                     {
-                        inputs.emplace_back(
-                            backend->create_tensor(arg_types[i], arg_shapes[i], arg_tensors[i]));
+                        inputs[i] = ctx->buffer_data[arg_buffer_indices[i]];
                     }
-                    for (int i = 0; i < out_shapes.size(); i++)
+                    for (size_t i = 0; i < out_buffer_indices.size(); i++)
                     {
-                        outputs.emplace_back(
-                            backend->create_tensor(out_types[i], out_shapes[i], out_tensors[i]));
+                        outputs[i] = ctx->buffer_data[out_buffer_indices[i]];
                     }
-
-                    auto call_frame = callee_external_function->make_call_frame();
                     call_frame->call(outputs, inputs);
                 };
                 functors.emplace_back(functor);
@@ -0,0 +1,176 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/acos.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/asin.hpp"
+#include "ngraph/op/atan.hpp"
+#include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/cos.hpp"
+#include "ngraph/op/cosh.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/floor.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sign.hpp"
+#include "ngraph/op/sin.hpp"
+#include "ngraph/op/sinh.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tan.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/loop_kernel.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
+
+#define TI(x) type_index(typeid(x))
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            static kernel::LoopKernelOpcode get_loop_kernel_opcode(const Node& node)
+            {
+                using kernel::LoopKernelOpcode;
+                static const unordered_map<type_index, LoopKernelOpcode> opcodes{
+                    {TI(ngraph::op::Abs), LoopKernelOpcode::Abs},
+                    {TI(ngraph::op::Acos), LoopKernelOpcode::Acos},
+                    {TI(ngraph::op::Add), LoopKernelOpcode::Add},
+                    {TI(ngraph::op::Asin), LoopKernelOpcode::Asin},
+                    {TI(ngraph::op::Atan), LoopKernelOpcode::Atan},
+                    {TI(ngraph::op::Ceiling), LoopKernelOpcode::Ceiling},
+                    {TI(ngraph::op::Cos), LoopKernelOpcode::Cos},
+                    {TI(ngraph::op::Cosh), LoopKernelOpcode::Cosh},
+                    {TI(ngraph::op::Divide), LoopKernelOpcode::Divide},
+                    {TI(ngraph::op::Exp), LoopKernelOpcode::Exp},
+                    {TI(ngraph::op::Floor), LoopKernelOpcode::Floor},
+                    {TI(ngraph::op::Log), LoopKernelOpcode::Log},
+                    {TI(ngraph::op::Maximum), LoopKernelOpcode::Maximum},
+                    {TI(ngraph::op::Minimum), LoopKernelOpcode::Minimum},
+                    {TI(ngraph::op::Multiply), LoopKernelOpcode::Multiply},
+                    {TI(ngraph::op::Negative), LoopKernelOpcode::Negative},
+                    {TI(ngraph::op::Power), LoopKernelOpcode::Power},
+                    {TI(ngraph::op::Relu), LoopKernelOpcode::Relu},
+                    {TI(ngraph::op::Sigmoid), LoopKernelOpcode::Sigmoid},
+                    {TI(ngraph::op::Sign), LoopKernelOpcode::Sign},
+                    {TI(ngraph::op::Sin), LoopKernelOpcode::Sin},
+                    {TI(ngraph::op::Sinh), LoopKernelOpcode::Sinh},
+                    {TI(ngraph::op::Sqrt), LoopKernelOpcode::Sqrt},
+                    {TI(ngraph::op::Subtract), LoopKernelOpcode::Subtract},
+                    {TI(ngraph::op::Tan), LoopKernelOpcode::Tan},
+                    {TI(ngraph::op::Tanh), LoopKernelOpcode::Tanh}};
+
+                auto it = opcodes.find(TI(node));
+                if (it == opcodes.end())
+                {
+                    throw ngraph_error("Unsupported op '" + node.description() +
+                                       "' in a LoopKernel");
+                }
+                return it->second;
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::runtime::cpu::op::LoopKernel)
+            {
+                auto& functors = external_function->get_functors();
+                auto loop_kernel = static_cast<const ngraph::runtime::cpu::op::LoopKernel*>(node);
+                auto& node_list = loop_kernel->get_node_list();
+                auto& kernel_outputs = loop_kernel->get_kernel_outputs();
+                auto& input_sources = loop_kernel->get_input_sources();
+
+                // Inputs and outputs of the kernel live in tensors, every other
+                // node in node_list gets a temporary slot
+                kernel::LoopKernelProgram program;
+                for (auto& arg : args)
+                {
+                    program.buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                }
+                vector<size_t> node_slots(node_list.size(), numeric_limits<size_t>::max());
+                for (size_t i = 0; i < out.size(); i++)
+                {
+                    auto member = find(node_list.begin(), node_list.end(), kernel_outputs.at(i));
+                    node_slots.at(member - node_list.begin()) = program.buffer_indices.size();
+                    program.buffer_indices.push_back(
+                        external_function->get_buffer_index(out[i].get_name()));
+                }
+                program.slot_count = program.buffer_indices.size();
+                for (auto& slot : node_slots)
+                {
+                    if (slot == numeric_limits<size_t>::max())
+                    {
+                        slot = program.slot_count++;
+                    }
+                }
+
+                auto source_slot = [&](size_t source) {
+                    return source < args.size() ? source : node_slots.at(source - args.size());
+                };
+                for (size_t i = 0; i < node_list.size(); i++)
+                {
+                    auto& sources = input_sources.at(i);
+                    kernel::LoopKernelStep step;
+                    step.opcode = get_loop_kernel_opcode(*node_list.at(i));
+                    step.arg0_slot = source_slot(sources.at(0));
+                    step.arg1_slot =
+                        source_slot(sources.size() > 1 ? sources.at(1) : sources.at(0));
+                    step.out_slot = node_slots.at(i);
+                    program.steps.push_back(step);
+                }
+
+                std::function<void(const kernel::LoopKernelProgram&,
+                                   void**,
+                                   size_t,
+                                   const Eigen::ThreadPoolDevice&)>
+                    kernel;
+                SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::loop_kernel);
+
+                auto element_count = out[0].get_size();
+                // The fused loop is split across threads as soon as any of its
+                // nodes would be on its own
+                const Eigen::ThreadPoolDevice* device = &eigen::global_serial_device;
+                for (auto& n : node_list)
+                {
+                    auto& candidate =
+                        Builder::get_eigen_device(external_function, n.get(), element_count);
+                    if (&candidate != &eigen::global_serial_device)
+                    {
+                        device = &candidate;
+                    }
+                }
+
+                auto functor = [&, kernel, program, element_count, device](CPURuntimeContext* ctx) {
+                    kernel(program, ctx->buffer_data, element_count, *device);
+                };
+                functors.emplace_back(functor);
+            }
+        }
+    }
+}
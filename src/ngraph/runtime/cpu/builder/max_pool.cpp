@@ -40,8 +40,8 @@ namespace ngraph
                 auto arg0_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto window_shape = max_pool->get_window_shape();
                 auto window_movement_strides = max_pool->get_window_movement_strides();
@@ -65,9 +65,12 @@ namespace ngraph
 
                     auto& deps = mkldnn_emitter->get_primitive_deps(max_pool_index);
 
-                    auto functor = [&, max_pool_index](CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    auto functor = [&, max_pool_index, arg0_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, max_pool_index);
                     };
                     functors.emplace_back(functor);
@@ -76,7 +79,7 @@ namespace ngraph
                 {
                     std::function<decltype(runtime::cpu::kernel::max_pool<float>)> kernel;
 
-                    SELECT_KERNEL(
+                    SELECT_KERNEL_WITH_BF16(
                         kernel, out[0].get_element_type(), runtime::cpu::kernel::max_pool);
 
                     auto functor = [&,
@@ -86,9 +89,11 @@ namespace ngraph
                                     window_shape,
                                     window_movement_strides,
                                     padding_below,
-                                    padding_above](CPURuntimeContext* ctx) {
-                        kernel(arg0_tensor,
-                               out_tensor,
+                                    padding_above,
+                                    arg0_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg0_shape,
                                out_shape,
                                window_shape,
@@ -110,9 +115,9 @@ namespace ngraph
                 auto delta_shape = args[1].get_shape();
                 auto out_shape = out[0].get_shape();
 
-                auto& arg_fwd_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& delta_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_fwd_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto delta_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto window_shape = mpb->get_window_shape();
                 auto window_movement_strides = mpb->get_window_movement_strides();
@@ -137,19 +142,27 @@ namespace ngraph
                         mpb->get_padding_above());
 
                     auto& fdeps = mkldnn_emitter->get_primitive_deps(max_pool_index - 1);
-                    auto functor_fprop = [&, max_pool_index](CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, fdeps[0], arg_fwd_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, fdeps[1], out_tensor);
+                    auto functor_fprop = [&,
+                                          max_pool_index,
+                                          arg_fwd_buffer_index,
+                                          out_buffer_index](CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, fdeps[0], ctx->buffer_data[arg_fwd_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, fdeps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, fdeps[2], ctx->mkldnn_workspaces[fdeps[3]]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, max_pool_index - 1);
                     };
                     auto& bdeps = mkldnn_emitter->get_primitive_deps(max_pool_index);
-                    auto functor_bprop = [&, max_pool_index](CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, bdeps[0], delta_tensor);
+                    auto functor_bprop = [&, max_pool_index, delta_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, bdeps[0], ctx->buffer_data[delta_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, bdeps[1], ctx->mkldnn_workspaces[bdeps[3]]);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, bdeps[2], out_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, bdeps[2], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, max_pool_index);
                     };
                     auto functor = [&, functor_fprop, functor_bprop](CPURuntimeContext* ctx) {
@@ -173,10 +186,13 @@ namespace ngraph
                                     window_shape,
                                     window_movement_strides,
                                     padding_below,
-                                    padding_above](CPURuntimeContext* ctx) {
-                        kernel(arg_fwd_tensor,
-                               delta_tensor,
-                               out_tensor,
+                                    padding_above,
+                                    arg_fwd_buffer_index,
+                                    delta_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg_fwd_buffer_index],
+                               ctx->buffer_data[delta_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                delta_shape,
                                arg_fwd_shape,
                                window_shape,
@@ -200,9 +216,9 @@ namespace ngraph
 
                 auto& functors = external_function->get_functors();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-                auto& out1_tensor = external_function->get_tensor_data(out[1].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
 
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                 auto input_desc = runtime::cpu::mkldnn_utils::get_input_mkldnn_md(node, 0);
@@ -219,10 +235,17 @@ namespace ngraph
 
                 auto& deps = mkldnn_emitter->get_primitive_deps(max_pool_index);
 
-                auto functor = [&, max_pool_index](CPURuntimeContext* ctx) {
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out0_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out1_tensor);
+                auto functor = [&,
+                                max_pool_index,
+                                arg0_buffer_index,
+                                out0_buffer_index,
+                                out1_buffer_index](CPURuntimeContext* ctx) {
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[1], ctx->buffer_data[out0_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[2], ctx->buffer_data[out1_buffer_index]);
                     cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, max_pool_index);
                 };
                 functors.emplace_back(functor);
@@ -238,9 +261,9 @@ namespace ngraph
 
                 auto& functors = external_function->get_functors();
 
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto mpb = static_cast<const ngraph::op::MaxPoolWithIndicesBackprop*>(node);
 
@@ -259,10 +282,17 @@ namespace ngraph
 
                 auto& deps = mkldnn_emitter->get_primitive_deps(max_pool_index);
 
-                auto functor = [&, max_pool_index](CPURuntimeContext* ctx) {
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg1_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg2_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out_tensor);
+                auto functor = [&,
+                                max_pool_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[0], ctx->buffer_data[arg1_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[1], ctx->buffer_data[arg2_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[2], ctx->buffer_data[out_buffer_index]);
                     cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, max_pool_index);
                 };
                 functors.emplace_back(functor);
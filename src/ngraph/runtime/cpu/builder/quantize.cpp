@@ -35,10 +35,10 @@ namespace ngraph
                 {
                     auto quantize = static_cast<const ngraph::op::QuantizeCPU*>(node);
                     auto& functors = external_function->get_functors();
-                    auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                    auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
-                    auto& out1_tensor = external_function->get_tensor_data(out[1].get_name());
-                    auto& out2_tensor = external_function->get_tensor_data(out[2].get_name());
+                    auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                    auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
+                    auto out2_buffer_index = external_function->get_buffer_index(out[2].get_name());
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                     auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
                     auto result_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
@@ -54,11 +54,19 @@ namespace ngraph
                     size_t quantize_index =
                         mkldnn_emitter->build_quantize_reorder(input_desc, result_desc, scales);
                     auto& deps = mkldnn_emitter->get_primitive_deps(quantize_index);
-                    auto functor = [&, quantize_index, quant_util](CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
-                        *(static_cast<float*>(out1_tensor)) = quant_util[0];
-                        *(static_cast<float*>(out2_tensor)) = quant_util[1];
+                    auto functor = [&,
+                                    quantize_index,
+                                    quant_util,
+                                    arg_buffer_index,
+                                    out_buffer_index,
+                                    out1_buffer_index,
+                                    out2_buffer_index](CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
+                        *(static_cast<float*>(ctx->buffer_data[out1_buffer_index])) = quant_util[0];
+                        *(static_cast<float*>(ctx->buffer_data[out2_buffer_index])) = quant_util[1];
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, quantize_index);
                     };
                     functors.emplace_back(functor);
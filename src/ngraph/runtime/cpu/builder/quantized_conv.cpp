@@ -38,11 +38,13 @@ namespace ngraph
                 {
                     auto qconvolution = static_cast<const ngraph::op::QuantizedConvolution*>(node);
                     auto& functors = external_function->get_functors();
-                    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                    auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                    auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-                    auto& out1_tensor = external_function->get_tensor_data(out[1].get_name());
-                    auto& out2_tensor = external_function->get_tensor_data(out[2].get_name());
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                    auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
+                    auto out2_buffer_index = external_function->get_buffer_index(out[2].get_name());
 
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
 
@@ -53,13 +55,25 @@ namespace ngraph
                     float min_freezed_output = qconvolution->get_freezed_output_min();
                     float max_freezed_output = qconvolution->get_freezed_output_max();
 
-                    auto functor = [&, conv_index, min_freezed_output, max_freezed_output](
-                        CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out0_tensor);
-                        *(static_cast<float*>(out1_tensor)) = min_freezed_output;
-                        *(static_cast<float*>(out2_tensor)) = max_freezed_output;
+                    auto functor = [&,
+                                    conv_index,
+                                    min_freezed_output,
+                                    max_freezed_output,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out0_buffer_index,
+                                    out1_buffer_index,
+                                    out2_buffer_index](CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[arg1_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[2], ctx->buffer_data[out0_buffer_index]);
+                        *(static_cast<float*>(ctx->buffer_data[out1_buffer_index])) =
+                            min_freezed_output;
+                        *(static_cast<float*>(ctx->buffer_data[out2_buffer_index])) =
+                            max_freezed_output;
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
                     };
                     functors.emplace_back(functor);
@@ -78,11 +92,13 @@ namespace ngraph
                     auto qconvolution_relu =
                         static_cast<const ngraph::op::QuantizedConvolutionRelu*>(node);
                     auto& functors = external_function->get_functors();
-                    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                    auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                    auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-                    auto& out1_tensor = external_function->get_tensor_data(out[1].get_name());
-                    auto& out2_tensor = external_function->get_tensor_data(out[2].get_name());
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                    auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
+                    auto out2_buffer_index = external_function->get_buffer_index(out[2].get_name());
 
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
 
@@ -93,13 +109,25 @@ namespace ngraph
                     float min_freezed_output = qconvolution_relu->get_freezed_output_min();
                     float max_freezed_output = qconvolution_relu->get_freezed_output_max();
 
-                    auto functor = [&, conv_index, min_freezed_output, max_freezed_output](
-                        CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out0_tensor);
-                        *(static_cast<float*>(out1_tensor)) = min_freezed_output;
-                        *(static_cast<float*>(out2_tensor)) = max_freezed_output;
+                    auto functor = [&,
+                                    conv_index,
+                                    min_freezed_output,
+                                    max_freezed_output,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out0_buffer_index,
+                                    out1_buffer_index,
+                                    out2_buffer_index](CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[arg1_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[2], ctx->buffer_data[out0_buffer_index]);
+                        *(static_cast<float*>(ctx->buffer_data[out1_buffer_index])) =
+                            min_freezed_output;
+                        *(static_cast<float*>(ctx->buffer_data[out2_buffer_index])) =
+                            max_freezed_output;
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
                     };
                     functors.emplace_back(functor);
@@ -119,12 +147,15 @@ namespace ngraph
                     auto qconvolution_bias =
                         static_cast<const ngraph::op::QuantizedConvolutionBias*>(node);
                     auto& functors = external_function->get_functors();
-                    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                    auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                    auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
-                    auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-                    auto& out1_tensor = external_function->get_tensor_data(out[1].get_name());
-                    auto& out2_tensor = external_function->get_tensor_data(out[2].get_name());
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto arg2_buffer_index =
+                        external_function->get_buffer_index(args[2].get_name());
+                    auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                    auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
+                    auto out2_buffer_index = external_function->get_buffer_index(out[2].get_name());
 
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
 
@@ -135,14 +166,28 @@ namespace ngraph
                     float min_freezed_output = qconvolution_bias->get_freezed_output_min();
                     float max_freezed_output = qconvolution_bias->get_freezed_output_max();
 
-                    auto functor = [&, conv_index, min_freezed_output, max_freezed_output](
-                        CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], arg2_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[3], out0_tensor);
-                        *(static_cast<float*>(out1_tensor)) = min_freezed_output;
-                        *(static_cast<float*>(out2_tensor)) = max_freezed_output;
+                    auto functor = [&,
+                                    conv_index,
+                                    min_freezed_output,
+                                    max_freezed_output,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    arg2_buffer_index,
+                                    out0_buffer_index,
+                                    out1_buffer_index,
+                                    out2_buffer_index](CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[arg1_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[2], ctx->buffer_data[arg2_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[3], ctx->buffer_data[out0_buffer_index]);
+                        *(static_cast<float*>(ctx->buffer_data[out1_buffer_index])) =
+                            min_freezed_output;
+                        *(static_cast<float*>(ctx->buffer_data[out2_buffer_index])) =
+                            max_freezed_output;
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
                     };
                     functors.emplace_back(functor);
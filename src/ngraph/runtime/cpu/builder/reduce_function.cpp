@@ -16,10 +16,9 @@
 
 #include "ngraph/runtime/cpu/kernel/reduce_function.hpp"
 #include "ngraph/op/reduce.hpp"
-#include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
-#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/cpu/kernel/scalar_function.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -45,20 +44,24 @@ namespace ngraph
                 }
                 auto& reducer_external_function = callees[function->get_name()];
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto arg0_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
 
                 auto reduction_axes = reduce->get_reduction_axes();
+                auto scalar_op = runtime::cpu::kernel::get_scalar_op(function);
 
                 if (reduction_axes.empty())
                 {
                     size_t size = args[0].get_size() * args[0].get_element_type().size();
-                    auto functor = [&, size](CPURuntimeContext* ctx) {
-                        memcpy(out_tensor, arg0_tensor, size);
+                    auto functor = [&, size, out_buffer_index, arg0_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        memcpy(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[arg0_buffer_index],
+                               size);
                     };
                     functors.emplace_back(functor);
                 }
@@ -72,16 +75,24 @@ namespace ngraph
                                           arg0_shape.size(),
                                           runtime::cpu::kernel::reduce_function_1rd);
 
-                    auto functor =
-                        [&, kernel, arg0_shape, out_shape, reduction_axes](CPURuntimeContext* ctx) {
-                            kernel(arg0_tensor,
-                                   arg1_tensor,
-                                   out_tensor,
-                                   arg0_shape,
-                                   out_shape,
-                                   reduction_axes,
-                                   reducer_external_function);
-                        };
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    reduction_axes,
+                                    scalar_op,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg0_shape,
+                               out_shape,
+                               reduction_axes,
+                               scalar_op,
+                               reducer_external_function);
+                    };
                     functors.emplace_back(functor);
                 }
                 else if (arg0_shape.size() == 2 && reduction_axes.size() == 2)
@@ -93,16 +104,24 @@ namespace ngraph
                                   args[0].get_element_type(),
                                   runtime::cpu::kernel::reduce_function_2d_2rd);
 
-                    auto functor =
-                        [&, kernel, arg0_shape, out_shape, reduction_axes](CPURuntimeContext* ctx) {
-                            kernel(arg0_tensor,
-                                   arg1_tensor,
-                                   out_tensor,
-                                   arg0_shape,
-                                   out_shape,
-                                   reduction_axes,
-                                   reducer_external_function);
-                        };
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    reduction_axes,
+                                    scalar_op,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg0_shape,
+                               out_shape,
+                               reduction_axes,
+                               scalar_op,
+                               reducer_external_function);
+                    };
                     functors.emplace_back(functor);
                 }
                 else if (arg0_shape.size() == 3 && reduction_axes.size() == 2)
@@ -114,16 +133,24 @@ namespace ngraph
                                   args[0].get_element_type(),
                                   runtime::cpu::kernel::reduce_function_3d_2rd);
 
-                    auto functor =
-                        [&, kernel, arg0_shape, out_shape, reduction_axes](CPURuntimeContext* ctx) {
-                            kernel(arg0_tensor,
-                                   arg1_tensor,
-                                   out_tensor,
-                                   arg0_shape,
-                                   out_shape,
-                                   reduction_axes,
-                                   reducer_external_function);
-                        };
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    reduction_axes,
+                                    scalar_op,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg0_shape,
+                               out_shape,
+                               reduction_axes,
+                               scalar_op,
+                               reducer_external_function);
+                    };
                     functors.emplace_back(functor);
                 }
                 else
@@ -18,7 +18,7 @@
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
-#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/cpu/kernel/scalar_function.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -44,15 +44,16 @@ namespace ngraph
                 }
                 auto& reducer_external_function = callees[function->get_name()];
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto arg0_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
 
                 auto window_shape = reduce_window->get_window_shape();
                 auto window_movement_strides = reduce_window->get_window_movement_strides();
+                auto scalar_op = runtime::cpu::kernel::get_scalar_op(function);
 
                 std::function<decltype(runtime::cpu::kernel::reduce_function_window<float>)> kernel;
 
@@ -60,18 +61,26 @@ namespace ngraph
                               args[0].get_element_type(),
                               runtime::cpu::kernel::reduce_function_window);
 
-                auto functor =
-                    [&, kernel, arg0_shape, out_shape, window_shape, window_movement_strides](
-                        CPURuntimeContext* ctx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
-                               arg0_shape,
-                               out_shape,
-                               window_shape,
-                               window_movement_strides,
-                               reducer_external_function);
-                    };
+                auto functor = [&,
+                                kernel,
+                                arg0_shape,
+                                out_shape,
+                                window_shape,
+                                window_movement_strides,
+                                scalar_op,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           arg0_shape,
+                           out_shape,
+                           window_shape,
+                           window_movement_strides,
+                           scalar_op,
+                           reducer_external_function);
+                };
                 functors.emplace_back(functor);
             }
 
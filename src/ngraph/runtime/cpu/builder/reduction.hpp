@@ -17,8 +17,8 @@
 #define BUILD_REDUCTION_FUNCTOR(OP, K)                                                             \
     auto& functors = external_function->get_functors();                                            \
                                                                                                    \
-    auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());                     \
-    auto& out_tensor = external_function->get_tensor_data(out[0].get_name());                      \
+    auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());               \
+    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());                \
                                                                                                    \
     auto op = static_cast<const ngraph::op::OP*>(node);                                            \
                                                                                                    \
@@ -33,8 +33,8 @@
     if (reduction_axes.empty())                                                                    \
     {                                                                                              \
         size_t size = out[0].get_size() * out[0].get_element_type().size();                        \
-        auto functor = [&, size](CPURuntimeContext* ctx) {                                         \
-            memcpy(out_tensor, arg_tensor, size);                                                  \
+        auto functor = [&, size, out_buffer_index, arg_buffer_index](CPURuntimeContext* ctx) {     \
+            memcpy(ctx->buffer_data[out_buffer_index], ctx->buffer_data[arg_buffer_index], size);  \
         };                                                                                         \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -45,8 +45,12 @@
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_all<float, 2>)> kernel;          \
         SELECT_KERNEL_BY_RANK(                                                                     \
             kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_all);        \
-        auto functor = [&, kernel, arg_shape, result_shape](CPURuntimeContext* ctx) {              \
-            kernel(arg_tensor, out_tensor, arg_shape, result_shape);                               \
+        auto functor = [&, kernel, arg_shape, result_shape, arg_buffer_index, out_buffer_index](   \
+            CPURuntimeContext* ctx) {                                                              \
+            kernel(ctx->buffer_data[arg_buffer_index],                                             \
+                   ctx->buffer_data[out_buffer_index],                                             \
+                   arg_shape,                                                                      \
+                   result_shape);                                                                  \
         };                                                                                         \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -62,8 +66,16 @@
                                   result_element_type,                                             \
                                   arg_rank,                                                        \
                                   runtime::cpu::kernel::reduce_##K##_innermost_1rd);               \
-            auto functor = [&, kernel, arg_shape, result_shape](CPURuntimeContext* ctx) {          \
-                kernel(arg_tensor, out_tensor, arg_shape, result_shape);                           \
+            auto functor = [&,                                                                     \
+                            kernel,                                                                \
+                            arg_shape,                                                             \
+                            result_shape,                                                          \
+                            arg_buffer_index,                                                      \
+                            out_buffer_index](CPURuntimeContext* ctx) {                            \
+                kernel(ctx->buffer_data[arg_buffer_index],                                         \
+                       ctx->buffer_data[out_buffer_index],                                         \
+                       arg_shape,                                                                  \
+                       result_shape);                                                              \
             };                                                                                     \
             functors.emplace_back(functor);                                                        \
             return;                                                                                \
@@ -73,8 +85,18 @@
         SELECT_KERNEL_BY_RANK(                                                                     \
             kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_1rd);        \
         auto functor =                                                                             \
-            [&, kernel, arg_shape, result_shape, reduction_axes](CPURuntimeContext* ctx) {         \
-                kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes);           \
+            [&,                                                                                    \
+             kernel,                                                                               \
+             arg_shape,                                                                            \
+             result_shape,                                                                         \
+             reduction_axes,                                                                       \
+             arg_buffer_index,                                                                     \
+             out_buffer_index](CPURuntimeContext* ctx) {                                           \
+                kernel(ctx->buffer_data[arg_buffer_index],                                         \
+                       ctx->buffer_data[out_buffer_index],                                         \
+                       arg_shape,                                                                  \
+                       result_shape,                                                               \
+                       reduction_axes);                                                            \
             };                                                                                     \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -85,8 +107,18 @@
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_3d_2rd<float>)> kernel;          \
         SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_3d_2rd);     \
         auto functor =                                                                             \
-            [&, kernel, arg_shape, result_shape, reduction_axes](CPURuntimeContext* ctx) {         \
-                kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes);           \
+            [&,                                                                                    \
+             kernel,                                                                               \
+             arg_shape,                                                                            \
+             result_shape,                                                                         \
+             reduction_axes,                                                                       \
+             arg_buffer_index,                                                                     \
+             out_buffer_index](CPURuntimeContext* ctx) {                                           \
+                kernel(ctx->buffer_data[arg_buffer_index],                                         \
+                       ctx->buffer_data[out_buffer_index],                                         \
+                       arg_shape,                                                                  \
+                       result_shape,                                                               \
+                       reduction_axes);                                                            \
             };                                                                                     \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -97,8 +129,18 @@
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_4d_2rd<float>)> kernel;          \
         SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_4d_2rd);     \
         auto functor =                                                                             \
-            [&, kernel, arg_shape, result_shape, reduction_axes](CPURuntimeContext* ctx) {         \
-                kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes);           \
+            [&,                                                                                    \
+             kernel,                                                                               \
+             arg_shape,                                                                            \
+             result_shape,                                                                         \
+             reduction_axes,                                                                       \
+             arg_buffer_index,                                                                     \
+             out_buffer_index](CPURuntimeContext* ctx) {                                           \
+                kernel(ctx->buffer_data[arg_buffer_index],                                         \
+                       ctx->buffer_data[out_buffer_index],                                         \
+                       arg_shape,                                                                  \
+                       result_shape,                                                               \
+                       reduction_axes);                                                            \
             };                                                                                     \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -109,8 +151,18 @@
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_5d_2rd<float>)> kernel;          \
         SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_5d_2rd);     \
         auto functor =                                                                             \
-            [&, kernel, arg_shape, result_shape, reduction_axes](CPURuntimeContext* ctx) {         \
-                kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes);           \
+            [&,                                                                                    \
+             kernel,                                                                               \
+             arg_shape,                                                                            \
+             result_shape,                                                                         \
+             reduction_axes,                                                                       \
+             arg_buffer_index,                                                                     \
+             out_buffer_index](CPURuntimeContext* ctx) {                                           \
+                kernel(ctx->buffer_data[arg_buffer_index],                                         \
+                       ctx->buffer_data[out_buffer_index],                                         \
+                       arg_shape,                                                                  \
+                       result_shape,                                                               \
+                       reduction_axes);                                                            \
             };                                                                                     \
         functors.emplace_back(functor);                                                            \
         return;                                                                                    \
@@ -121,7 +173,17 @@
     SELECT_KERNEL(ref_kernel, result_element_type, runtime::cpu::kernel::K);                       \
                                                                                                    \
     auto functor =                                                                                 \
-        [&, ref_kernel, arg_shape, result_shape, reduction_axes](CPURuntimeContext* ctx) {         \
-            ref_kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes);           \
+        [&,                                                                                        \
+         ref_kernel,                                                                               \
+         arg_shape,                                                                                \
+         result_shape,                                                                             \
+         reduction_axes,                                                                           \
+         arg_buffer_index,                                                                         \
+         out_buffer_index](CPURuntimeContext* ctx) {                                               \
+            ref_kernel(ctx->buffer_data[arg_buffer_index],                                         \
+                       ctx->buffer_data[out_buffer_index],                                         \
+                       arg_shape,                                                                  \
+                       result_shape,                                                               \
+                       reduction_axes);                                                            \
         };                                                                                         \
     functors.emplace_back(functor);
@@ -14,11 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <memory>
+
 #include "ngraph/op/select_and_scatter.hpp"
-#include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/scalar_function.hpp"
 #include "ngraph/runtime/reference/select_and_scatter.hpp"
-#include "ngraph/runtime/tensor.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -36,8 +37,6 @@ namespace ngraph
                 auto select_function = select_and_scatter->get_functions()[0];
                 auto scatter_function = select_and_scatter->get_functions()[1];
 
-                auto backend = runtime::Backend::create("CPU");
-
                 auto& functors = external_function->get_functors();
                 auto& callees = external_function->get_callees();
 
@@ -52,13 +51,13 @@ namespace ngraph
                 }
 
                 auto arg0_shape = args[0].get_shape();
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto arg1_shape = args[1].get_shape();
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
 
                 auto out_shape = out[0].get_shape();
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto window_shape = select_and_scatter->get_window_shape();
                 auto window_movement_strides = select_and_scatter->get_window_movement_strides();
@@ -77,47 +76,57 @@ namespace ngraph
                 auto& select_external_function = callees[select_function->get_name()];
                 auto& scatter_external_function = callees[scatter_function->get_name()];
 
-                auto select = [&, backend](float x, float y) {
-                    TensorViewPtrs inputs, outputs;
-                    char output;
-                    inputs.emplace_back(backend->create_tensor(element::f32, Shape{}, &x));
-                    inputs.emplace_back(backend->create_tensor(element::f32, Shape{}, &y));
-                    outputs.emplace_back(
-                        backend->create_tensor(element::boolean, Shape{}, &output));
-                    select_external_function->make_call_frame()->call(outputs, inputs);
-                    return output;
-                };
-
-                auto scatter = [&, backend](float x, float y) {
-                    TensorViewPtrs inputs, outputs;
-                    float output;
-                    inputs.emplace_back(backend->create_tensor(element::f32, Shape{}, &x));
-                    inputs.emplace_back(backend->create_tensor(element::f32, Shape{}, &y));
-                    outputs.emplace_back(backend->create_tensor(element::f32, Shape{}, &output));
-                    scatter_external_function->make_call_frame()->call(outputs, inputs);
-                    return output;
-                };
+                auto select_op = runtime::cpu::kernel::get_scalar_op(select_function);
+                auto scatter_op = runtime::cpu::kernel::get_scalar_op(scatter_function);
 
                 auto functor = [&,
-                                backend,
-                                select,
-                                scatter,
+                                select_op,
+                                scatter_op,
                                 arg0_shape,
                                 arg1_shape,
                                 out_shape,
                                 window_shape,
-                                window_movement_strides](CPURuntimeContext* ctx) {
-                    reference::select_and_scatter<float>(static_cast<float*>(arg0_tensor),
-                                                         static_cast<float*>(arg1_tensor),
-                                                         static_cast<float*>(arg2_tensor),
-                                                         static_cast<float*>(out_tensor),
-                                                         arg0_shape,
-                                                         arg1_shape,
-                                                         out_shape,
-                                                         select,
-                                                         scatter,
-                                                         window_shape,
-                                                         window_movement_strides);
+                                window_movement_strides,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    // Functions that are a single op are evaluated directly, others on call
+                    // frames that are set up once per call rather than once per element
+                    auto select = runtime::cpu::kernel::get_scalar_comparison<float>(select_op);
+                    std::unique_ptr<runtime::cpu::kernel::ScalarFunction<float, char>>
+                        select_callee;
+                    if (!select)
+                    {
+                        select_callee.reset(new runtime::cpu::kernel::ScalarFunction<float, char>(
+                            select_external_function));
+                        select = [&select_callee](float x, float y) {
+                            return (*select_callee)(x, y);
+                        };
+                    }
+                    auto scatter = runtime::cpu::kernel::get_scalar_combiner<float>(scatter_op);
+                    std::unique_ptr<runtime::cpu::kernel::ScalarFunction<float>> scatter_callee;
+                    if (!scatter)
+                    {
+                        scatter_callee.reset(new runtime::cpu::kernel::ScalarFunction<float>(
+                            scatter_external_function));
+                        scatter = [&scatter_callee](float x, float y) {
+                            return (*scatter_callee)(x, y);
+                        };
+                    }
+
+                    reference::select_and_scatter<float>(
+                        static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[arg2_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        arg0_shape,
+                        arg1_shape,
+                        out_shape,
+                        select,
+                        scatter,
+                        window_shape,
+                        window_movement_strides);
                 };
                 functors.emplace_back(functor);
             }
@@ -36,8 +36,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 const ngraph::op::Slice* slice = static_cast<const ngraph::op::Slice*>(node);
 
@@ -58,9 +58,12 @@ namespace ngraph
                         input_desc, result_desc, lower_bounds, out_shape);
                     auto& deps = mkldnn_emitter->get_primitive_deps(slice_index);
 
-                    auto functor = [&, slice_index](CPURuntimeContext* ctx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    auto functor = [&, slice_index, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, slice_index);
                     };
 
@@ -78,17 +81,23 @@ namespace ngraph
                                               arg_shape.size(),
                                               runtime::cpu::kernel::strided_slice);
 
-                        auto functor =
-                            [&, kernel, arg_shape, out_shape, lower_bounds, upper_bounds, strides](
-                                CPURuntimeContext* ctx) {
-                                kernel(arg_tensor,
-                                       out_tensor,
-                                       arg_shape,
-                                       out_shape,
-                                       lower_bounds,
-                                       upper_bounds,
-                                       strides);
-                            };
+                        auto functor = [&,
+                                        kernel,
+                                        arg_shape,
+                                        out_shape,
+                                        lower_bounds,
+                                        upper_bounds,
+                                        strides,
+                                        arg_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   arg_shape,
+                                   out_shape,
+                                   lower_bounds,
+                                   upper_bounds,
+                                   strides);
+                        };
                         functors.emplace_back(functor);
                     }
                     else
@@ -100,9 +109,18 @@ namespace ngraph
                                               arg_shape.size(),
                                               runtime::cpu::kernel::slice);
 
-                        auto functor = [&, kernel, arg_shape, out_shape, lower_bounds](
-                            CPURuntimeContext* ctx) {
-                            kernel(arg_tensor, out_tensor, arg_shape, out_shape, lower_bounds);
+                        auto functor = [&,
+                                        kernel,
+                                        arg_shape,
+                                        out_shape,
+                                        lower_bounds,
+                                        arg_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   arg_shape,
+                                   out_shape,
+                                   lower_bounds);
                         };
                         functors.emplace_back(functor);
                     }
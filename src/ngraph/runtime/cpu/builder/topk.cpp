@@ -33,14 +33,15 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::TopK)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
                 const ngraph::op::TopK* topk = static_cast<const ngraph::op::TopK*>(node);
                 function<void(CPURuntimeContext*)> functor;
 
-                auto& arg_tensor = tensor_data[args[0].get_name()];
-                auto& out_indices_tensor = tensor_data[out[0].get_name()];
-                auto& out_values_tensor = tensor_data[out[1].get_name()];
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_indices_buffer_index =
+                    external_function->get_buffer_index(out[0].get_name());
+                auto out_values_buffer_index =
+                    external_function->get_buffer_index(out[1].get_name());
                 if (out[0].get_element_type() != element::i64 &&
                     out[0].get_element_type() != element::i32)
                 {
@@ -58,66 +59,94 @@ namespace ngraph
                 {
                     if (is_int64)
                     {
-                        functor =
-                            [&, in_shape, out_shape, axis, k, compute_max](CPURuntimeContext* ctx) {
-                                ngraph::runtime::reference::topk<float, int64_t>(
-                                    static_cast<float*>(arg_tensor),
-                                    static_cast<int64_t*>(out_indices_tensor),
-                                    static_cast<float*>(out_values_tensor),
-                                    in_shape,
-                                    out_shape,
-                                    axis,
-                                    k,
-                                    compute_max);
-                            };
+                        functor = [&,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   k,
+                                   compute_max,
+                                   arg_buffer_index,
+                                   out_indices_buffer_index,
+                                   out_values_buffer_index](CPURuntimeContext* ctx) {
+                            ngraph::runtime::reference::topk<float, int64_t>(
+                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
+                                static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
+                                in_shape,
+                                out_shape,
+                                axis,
+                                k,
+                                compute_max);
+                        };
                     }
                     else
                     {
-                        functor =
-                            [&, in_shape, out_shape, axis, k, compute_max](CPURuntimeContext* ctx) {
-                                ngraph::runtime::reference::topk<float, int32_t>(
-                                    static_cast<float*>(arg_tensor),
-                                    static_cast<int32_t*>(out_indices_tensor),
-                                    static_cast<float*>(out_values_tensor),
-                                    in_shape,
-                                    out_shape,
-                                    axis,
-                                    k,
-                                    compute_max);
-                            };
+                        functor = [&,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   k,
+                                   compute_max,
+                                   arg_buffer_index,
+                                   out_indices_buffer_index,
+                                   out_values_buffer_index](CPURuntimeContext* ctx) {
+                            ngraph::runtime::reference::topk<float, int32_t>(
+                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
+                                static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
+                                in_shape,
+                                out_shape,
+                                axis,
+                                k,
+                                compute_max);
+                        };
                     }
                 }
                 else if (element_type == element::f64)
                 {
                     if (is_int64)
                     {
-                        functor =
-                            [&, in_shape, out_shape, axis, k, compute_max](CPURuntimeContext* ctx) {
-                                ngraph::runtime::reference::topk<double, int64_t>(
-                                    static_cast<double*>(arg_tensor),
-                                    static_cast<int64_t*>(out_indices_tensor),
-                                    static_cast<double*>(out_values_tensor),
-                                    in_shape,
-                                    out_shape,
-                                    axis,
-                                    k,
-                                    compute_max);
-                            };
+                        functor = [&,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   k,
+                                   compute_max,
+                                   arg_buffer_index,
+                                   out_indices_buffer_index,
+                                   out_values_buffer_index](CPURuntimeContext* ctx) {
+                            ngraph::runtime::reference::topk<double, int64_t>(
+                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
+                                static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
+                                in_shape,
+                                out_shape,
+                                axis,
+                                k,
+                                compute_max);
+                        };
                     }
                     else
                     {
-                        functor =
-                            [&, in_shape, out_shape, axis, k, compute_max](CPURuntimeContext* ctx) {
-                                ngraph::runtime::reference::topk<double, int32_t>(
-                                    static_cast<double*>(arg_tensor),
-                                    static_cast<int32_t*>(out_indices_tensor),
-                                    static_cast<double*>(out_values_tensor),
-                                    in_shape,
-                                    out_shape,
-                                    axis,
-                                    k,
-                                    compute_max);
-                            };
+                        functor = [&,
+                                   in_shape,
+                                   out_shape,
+                                   axis,
+                                   k,
+                                   compute_max,
+                                   arg_buffer_index,
+                                   out_indices_buffer_index,
+                                   out_values_buffer_index](CPURuntimeContext* ctx) {
+                            ngraph::runtime::reference::topk<double, int32_t>(
+                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
+                                static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
+                                in_shape,
+                                out_shape,
+                                axis,
+                                k,
+                                compute_max);
+                        };
                     }
                 }
                 else
@@ -19,9 +19,11 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -74,15 +76,15 @@ shared_ptr<runtime::Tensor> runtime::cpu::CPU_Backend::create_tensor(
 
 bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     if (instance.m_external_function == nullptr)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
-#if !defined(NGRAPH_DEX_ONLY)
         instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
-#endif
+        instance.m_external_function->m_thread_pool = m_thread_pool;
         auto cf = instance.m_external_function->make_call_frame();
-        instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        instance.m_idle_call_frames.push_back(dynamic_pointer_cast<CPU_CallFrame>(cf));
     }
     return true;
 }
@@ -93,26 +95,76 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
 {
     bool rc = true;
 
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    FunctionInstance* instance;
+    shared_ptr<CPU_ExternalFunction> external_function;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        instance = &m_function_map[func];
+        external_function = instance->m_external_function;
+    }
+    if (external_function == nullptr)
     {
         rc = compile(func);
+        lock_guard<mutex> lock(m_function_map_mutex);
+        external_function = instance->m_external_function;
+    }
+
+    if (!external_function->is_direct_execution())
+    {
+        // Generated code keeps its runtime state in globals so codegen
+        // functions are executed one call at a time
+        lock_guard<mutex> lock(instance->m_call_frame_mutex);
+        instance->m_idle_call_frames.front()->call(outputs, inputs);
+        return rc;
     }
 
-    instance.m_call_frame->call(outputs, inputs);
+    shared_ptr<CPU_CallFrame> call_frame;
+    {
+        lock_guard<mutex> lock(instance->m_call_frame_mutex);
+        if (!instance->m_idle_call_frames.empty())
+        {
+            call_frame = instance->m_idle_call_frames.back();
+            instance->m_idle_call_frames.pop_back();
+        }
+    }
+    if (call_frame == nullptr)
+    {
+        call_frame = external_function->make_call_frame();
+    }
+
+    call_frame->call(outputs, inputs);
+
+    lock_guard<mutex> lock(instance->m_call_frame_mutex);
+    instance->m_idle_call_frames.push_back(call_frame);
 
     return rc;
 }
 
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     m_function_map.erase(func);
 }
 
-#if !defined(NGRAPH_DEX_ONLY)
+bool runtime::cpu::CPU_Backend::is_supported(const Node& node) const
+{
+    // Ops without a DEX builder would fail to compile
+    return GetGlobalBuildDispatcher().count(type_index(typeid(node))) != 0;
+}
+
+void runtime::cpu::CPU_Backend::set_intra_op_parallelism(size_t num_threads)
+{
+    if (num_threads == 0)
+    {
+        throw runtime_error("Intra-op parallelism must be at least one thread");
+    }
+    lock_guard<mutex> lock(m_function_map_mutex);
+    m_thread_pool = make_shared<eigen::LocalThreadPool>(static_cast<int>(num_threads));
+}
 
 void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> func, bool enable)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     if (instance.m_external_function != nullptr)
     {
@@ -125,13 +177,25 @@ vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
-    auto it = m_function_map.find(func);
-    if (it != m_function_map.end())
+    shared_ptr<CPU_ExternalFunction> external_function;
     {
-        const FunctionInstance& instance = it->second;
-        if (instance.m_external_function != nullptr)
+        lock_guard<mutex> lock(m_function_map_mutex);
+        auto it = m_function_map.find(func);
+        if (it != m_function_map.end())
         {
-            auto* engine = instance.m_external_function->m_execution_engine.get();
+            external_function = it->second.m_external_function;
+        }
+    }
+    if (external_function != nullptr)
+    {
+        if (external_function->is_direct_execution())
+        {
+            rc = external_function->get_performance_data();
+        }
+#if !defined(NGRAPH_DEX_ONLY)
+        else
+        {
+            auto* engine = external_function->m_execution_engine.get();
             if (engine)
             {
                 auto get_count = engine->find_function<size_t()>("get_debug_timer_count");
@@ -151,8 +215,7 @@ vector<runtime::PerformanceCounter>
                 }
             }
         }
+#endif
     }
     return rc;
 }
-
-#endif
@@ -18,6 +18,8 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "ngraph/runtime/backend.hpp"
 
@@ -30,6 +32,11 @@ namespace ngraph
             class CPU_ExternalFunction;
             class CPU_CallFrame;
 
+            namespace eigen
+            {
+                class LocalThreadPool;
+            }
+
             class CPU_Backend : public runtime::Backend
             {
             public:
@@ -53,22 +60,35 @@ namespace ngraph
 
                 void remove_compiled_function(std::shared_ptr<Function> func) override;
 
-#if !defined(NGRAPH_DEX_ONLY)
+                bool is_supported(const Node& node) const override;
+
                 void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
                 std::vector<PerformanceCounter>
                     get_performance_data(std::shared_ptr<Function> func) const override;
-#endif
+
+                // Run the elementwise Eigen kernels (unary and binary
+                // arithmetic, comparison and logical ops) of functions compiled
+                // after this call on a pool of num_threads threads owned by this
+                // backend. Other Eigen kernels, such as broadcast, dot, reshape,
+                // slice and the reductions, still use the process-wide pool, and
+                // MKLDNN primitives use their own OpenMP threads.
+                void set_intra_op_parallelism(size_t num_threads);
 
             private:
                 class FunctionInstance
                 {
                 public:
                     std::shared_ptr<CPU_ExternalFunction> m_external_function;
-                    std::shared_ptr<CPU_CallFrame> m_call_frame;
                     bool m_performance_counters_enabled = false;
+                    // Call frames that are not executing. Concurrent calls of
+                    // the same function each take a frame of their own.
+                    std::vector<std::shared_ptr<CPU_CallFrame>> m_idle_call_frames;
+                    std::mutex m_call_frame_mutex;
                 };
 
                 std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+                mutable std::mutex m_function_map_mutex;
+                std::shared_ptr<eigen::LocalThreadPool> m_thread_pool;
             };
         }
     }
@@ -22,6 +22,7 @@
 #include <string>
 #include <typeindex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include "ngraph/node.hpp"
 #include "ngraph/op/abs.hpp"
@@ -73,6 +74,7 @@
 #include "ngraph/runtime/cpu/kernel/cos.hpp"
 #include "ngraph/runtime/cpu/kernel/cosh.hpp"
 #include "ngraph/runtime/cpu/kernel/cwise_pow.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
 #include "ngraph/runtime/cpu/kernel/divide.hpp"
 #include "ngraph/runtime/cpu/kernel/equal.hpp"
 #include "ngraph/runtime/cpu/kernel/exp.hpp"
@@ -98,6 +100,7 @@
 #include "ngraph/runtime/cpu/kernel/tan.hpp"
 #include "ngraph/runtime/cpu/kernel/tanh.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
@@ -118,19 +121,19 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Subtract)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::subtract);
+                BUILD_BINARY_ELEMWISE_BF16_FUNCTOR(runtime::cpu::kernel::subtract);
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Multiply)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::multiply);
+                BUILD_BINARY_ELEMWISE_BF16_FUNCTOR(runtime::cpu::kernel::multiply);
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Divide)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::divide);
+                BUILD_BINARY_ELEMWISE_BF16_FUNCTOR(runtime::cpu::kernel::divide);
             }
 
             template <>
@@ -175,13 +178,22 @@ namespace ngraph
                 auto& functors = external_function->get_functors();
 
                 auto element_count = out[0].get_size();
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-
-                auto functor = [&, element_count](CPURuntimeContext* ctx) {
-                    runtime::cpu::kernel::logical_and(
-                        arg0_tensor, arg1_tensor, out0_tensor, element_count);
+                auto device = &Builder::get_eigen_device(external_function, node, element_count);
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                element_count,
+                                device,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::cpu::kernel::logical_and(ctx->buffer_data[arg0_buffer_index],
+                                                      ctx->buffer_data[arg1_buffer_index],
+                                                      ctx->buffer_data[out0_buffer_index],
+                                                      element_count,
+                                                      *device);
                 };
                 functors.emplace_back(functor);
             }
@@ -192,13 +204,22 @@ namespace ngraph
                 auto& functors = external_function->get_functors();
 
                 auto element_count = out[0].get_size();
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-
-                auto functor = [&, element_count](CPURuntimeContext* ctx) {
-                    runtime::cpu::kernel::logical_or(
-                        arg0_tensor, arg1_tensor, out0_tensor, element_count);
+                auto device = &Builder::get_eigen_device(external_function, node, element_count);
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                element_count,
+                                device,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::cpu::kernel::logical_or(ctx->buffer_data[arg0_buffer_index],
+                                                     ctx->buffer_data[arg1_buffer_index],
+                                                     ctx->buffer_data[out0_buffer_index],
+                                                     element_count,
+                                                     *device);
                 };
                 functors.emplace_back(functor);
             }
@@ -206,12 +227,12 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Maximum)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::maximum);
+                BUILD_BINARY_ELEMWISE_BF16_FUNCTOR(runtime::cpu::kernel::maximum);
             }
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Minimum)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::minimum);
+                BUILD_BINARY_ELEMWISE_BF16_FUNCTOR(runtime::cpu::kernel::minimum);
             }
 
             template <>
@@ -223,7 +244,7 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Abs)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::abs);
+                BUILD_UNARY_ELEMWISE_BF16_FUNCTOR(runtime::cpu::kernel::abs);
             }
 
             template <>
@@ -271,7 +292,7 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Negative)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::negative);
+                BUILD_UNARY_ELEMWISE_BF16_FUNCTOR(runtime::cpu::kernel::negative);
             }
 
             template <>
@@ -283,7 +304,7 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Result)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::result);
+                BUILD_UNARY_ELEMWISE_BF16_FUNCTOR(runtime::cpu::kernel::result);
             }
 
             template <>
@@ -331,7 +352,7 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Tanh)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::tanh);
+                BUILD_UNARY_ELEMWISE_BF16_FUNCTOR(runtime::cpu::kernel::tanh);
             }
 
             template <>
@@ -339,22 +360,22 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                vector<void**> dest;
+                vector<size_t> dest_indices;
                 for (auto& result : external_function->get_function()->get_results())
                 {
                     if (result.get() == node)
                     {
-                        dest.push_back(&external_function->get_tensor_data(
+                        dest_indices.push_back(external_function->get_buffer_index(
                             result->get_output_tensor(0).get_name()));
                     }
                 }
-                auto& src =
-                    external_function->get_tensor_data(node->get_output_tensor(0).get_name());
+                auto src_index =
+                    external_function->get_buffer_index(node->get_output_tensor(0).get_name());
                 auto size = node->get_output_tensor(0).size();
-                auto functor = [&, dest, src, size](CPURuntimeContext* ctx) {
-                    for (auto p : dest)
+                auto functor = [&, dest_indices, src_index, size](CPURuntimeContext* ctx) {
+                    for (auto p : dest_indices)
                     {
-                        memcpy(*p, src, size);
+                        memcpy(ctx->buffer_data[p], ctx->buffer_data[src_index], size);
                     }
                 };
                 functors.emplace_back(functor);
@@ -362,12 +383,44 @@ namespace ngraph
 
 #define TI(x) type_index(typeid(x))
 
+            const Eigen::ThreadPoolDevice&
+                Builder::get_eigen_device(CPU_ExternalFunction* external_function,
+                                          const ngraph::Node* node,
+                                          size_t element_count)
+            {
+                // Elementwise ops that spend tens of cycles on each element and
+                // so are worth splitting across threads at smaller sizes
+                static const unordered_set<type_index> expensive_ops{TI(ngraph::op::Acos),
+                                                                     TI(ngraph::op::Asin),
+                                                                     TI(ngraph::op::Atan),
+                                                                     TI(ngraph::op::Cos),
+                                                                     TI(ngraph::op::Cosh),
+                                                                     TI(ngraph::op::Divide),
+                                                                     TI(ngraph::op::Exp),
+                                                                     TI(ngraph::op::Log),
+                                                                     TI(ngraph::op::Power),
+                                                                     TI(ngraph::op::Sin),
+                                                                     TI(ngraph::op::Sinh),
+                                                                     TI(ngraph::op::Sqrt),
+                                                                     TI(ngraph::op::Tan),
+                                                                     TI(ngraph::op::Tanh)};
+                const Node& n = *node;
+                size_t serial_threshold = expensive_ops.count(TI(n)) ? (1 << 12) : (1 << 16);
+                if (element_count < serial_threshold)
+                {
+                    return eigen::global_serial_device;
+                }
+                return external_function->get_eigen_device();
+            }
+
             BuildOpMap& GetGlobalBuildDispatcher()
             {
                 static BuildOpMap build_dispatcher{
                     {TI(ngraph::op::Parameter), &runtime::cpu::Builder::nop},
                     {TI(ngraph::runtime::cpu::op::ConvertLayout),
-                     &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::ConvertLayout>}};
+                     &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::ConvertLayout>},
+                    {TI(ngraph::runtime::cpu::op::LoopKernel),
+                     &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::LoopKernel>}};
 
                 return build_dispatcher;
             }
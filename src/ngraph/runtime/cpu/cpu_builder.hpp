@@ -76,6 +76,14 @@
         KV = K<uint64_t>;                                                                          \
     }
 
+// Per-type kernel macro for kernels that are also instantiated for bfloat16
+#define SELECT_KERNEL_WITH_BF16(KV, ET, K)                                                         \
+    if (ET == element::bf16)                                                                       \
+    {                                                                                              \
+        KV = K<bfloat16>;                                                                          \
+    }                                                                                              \
+    else SELECT_KERNEL(KV, ET, K)
+
 #define SELECT_RANK(KV, ET, R, K)                                                                  \
     if (R == 1)                                                                                    \
         KV = K<ET, 1>;                                                                             \
@@ -188,37 +196,62 @@
         throw ngraph_error("Unsupported element type " + ET.c_type_string() + " for kernel " #K);  \
     }
 
-#define BUILD_UNARY_ELEMWISE_FUNCTOR(OP)                                                           \
+#define BUILD_UNARY_ELEMWISE_FUNCTOR_SELECT(SELECT, OP)                                            \
     auto& functors = external_function->get_functors();                                            \
-    std::function<void(void*, void*, size_t)> kernel;                                              \
+    std::function<void(void*, void*, size_t, const Eigen::ThreadPoolDevice&)> kernel;              \
                                                                                                    \
-    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
+    SELECT(kernel, args[0].get_element_type(), OP);                                                \
                                                                                                    \
     auto element_count = out[0].get_size();                                                        \
-    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());                    \
-    auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());                     \
+    auto device = &Builder::get_eigen_device(external_function, node, element_count);              \
+    auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
+    auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());               \
                                                                                                    \
-    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {                            \
-        kernel(arg0_tensor, out0_tensor, element_count);                                           \
+    auto functor = [&, kernel, element_count, device, arg0_buffer_index, out0_buffer_index](       \
+        CPURuntimeContext* ctx) {                                                                  \
+        kernel(ctx->buffer_data[arg0_buffer_index],                                                \
+               ctx->buffer_data[out0_buffer_index],                                                \
+               element_count,                                                                      \
+               *device);                                                                           \
     };                                                                                             \
     functors.emplace_back(functor);
 
-#define BUILD_BINARY_ELEMWISE_FUNCTOR(OP)                                                          \
+#define BUILD_BINARY_ELEMWISE_FUNCTOR_SELECT(SELECT, OP)                                           \
     auto& functors = external_function->get_functors();                                            \
-    std::function<void(void*, void*, void*, size_t)> kernel;                                       \
+    std::function<void(void*, void*, void*, size_t, const Eigen::ThreadPoolDevice&)> kernel;       \
                                                                                                    \
-    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
+    SELECT(kernel, args[0].get_element_type(), OP);                                                \
                                                                                                    \
     auto element_count = out[0].get_size();                                                        \
-    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());                    \
-    auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());                    \
-    auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());                     \
+    auto device = &Builder::get_eigen_device(external_function, node, element_count);              \
+    auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
+    auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());              \
+    auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());               \
                                                                                                    \
-    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {                            \
-        kernel(arg0_tensor, arg1_tensor, out0_tensor, element_count);                              \
+    auto functor = [&,                                                                             \
+                    kernel,                                                                        \
+                    element_count,                                                                 \
+                    device,                                                                        \
+                    arg0_buffer_index,                                                             \
+                    arg1_buffer_index,                                                             \
+                    out0_buffer_index](CPURuntimeContext* ctx) {                                   \
+        kernel(ctx->buffer_data[arg0_buffer_index],                                                \
+               ctx->buffer_data[arg1_buffer_index],                                                \
+               ctx->buffer_data[out0_buffer_index],                                                \
+               element_count,                                                                      \
+               *device);                                                                           \
     };                                                                                             \
     functors.emplace_back(functor);
 
+#define BUILD_UNARY_ELEMWISE_FUNCTOR(OP) BUILD_UNARY_ELEMWISE_FUNCTOR_SELECT(SELECT_KERNEL, OP)
+#define BUILD_BINARY_ELEMWISE_FUNCTOR(OP) BUILD_BINARY_ELEMWISE_FUNCTOR_SELECT(SELECT_KERNEL, OP)
+
+// Elementwise functors for kernels that also run on bfloat16
+#define BUILD_UNARY_ELEMWISE_BF16_FUNCTOR(OP)                                                      \
+    BUILD_UNARY_ELEMWISE_FUNCTOR_SELECT(SELECT_KERNEL_WITH_BF16, OP)
+#define BUILD_BINARY_ELEMWISE_BF16_FUNCTOR(OP)                                                     \
+    BUILD_BINARY_ELEMWISE_FUNCTOR_SELECT(SELECT_KERNEL_WITH_BF16, OP)
+
 #define REGISTER_OP_BUILDER(OP)                                                                    \
     static struct __register_##OP##_builder                                                        \
     {                                                                                              \
@@ -264,6 +297,14 @@ namespace ngraph
                                 const std::vector<TensorViewWrapper>& out)
                 {
                 }
+
+                // Device an elementwise kernel producing element_count values
+                // of node is evaluated on. Kernels too small to amortize waking
+                // the thread pool run on the calling thread.
+                static const Eigen::ThreadPoolDevice&
+                    get_eigen_device(CPU_ExternalFunction* external_function,
+                                     const ngraph::Node* node,
+                                     size_t element_count);
             };
         }
     }
@@ -26,9 +26,13 @@ using namespace std;
 using namespace ngraph;
 
 runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
-                                           EntryPoint compiled_function)
+                                           EntryPoint compiled_function,
+                                           uint8_t* memory_pool)
     : m_external_function(external_function)
     , m_compiled_function(compiled_function)
+    , m_memory_pool(memory_pool)
+    , m_inputs(external_function->get_parameter_layout_descriptors().size())
+    , m_outputs(external_function->get_result_layout_descriptors().size())
 {
     setup_runtime_context();
 }
@@ -61,6 +65,20 @@ void runtime::cpu::CPU_CallFrame::call(
         outputs.push_back(tv->get_data_ptr());
     }
 
+    execute(outputs, inputs);
+}
+
+void runtime::cpu::CPU_CallFrame::call(std::vector<void*>& outputs, std::vector<void*>& inputs)
+{
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        ctx->p_en[i] = true;
+    }
+    execute(outputs, inputs);
+}
+
+void runtime::cpu::CPU_CallFrame::execute(std::vector<void*>& outputs, std::vector<void*>& inputs)
+{
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
@@ -114,15 +132,36 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
 
     // Create temporary buffer pools
     size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
-    for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+    if (!m_external_function->is_direct_execution())
+    {
+        for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+        {
+            auto buffer = new AlignedBuffer(buffer_size, alignment);
+            ctx->memory_buffers.push_back(buffer);
+        }
+    }
+    else if (m_memory_pool == nullptr)
     {
-        auto buffer = new AlignedBuffer(buffer_size, alignment);
-        ctx->memory_buffers.push_back(buffer);
+        // A single pool holds the intermediates of this function and of every nested call
+        size_t pool_size = m_external_function->get_memory_pool_size();
+        if (pool_size)
+        {
+            auto buffer = new AlignedBuffer(pool_size, alignment);
+            ctx->memory_buffers.push_back(buffer);
+            m_memory_pool = static_cast<uint8_t*>(buffer->get_ptr());
+        }
     }
     const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
     ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
     ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
 
+    ctx->buffer_data = nullptr;
+    ctx->tensor_stale = nullptr;
+    if (m_external_function->is_direct_execution())
+    {
+        m_external_function->initialize_runtime_context(ctx, m_memory_pool);
+    }
+
     if (std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
     {
         ctx->G = new tbb::flow::graph;
@@ -137,6 +176,12 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 {
     delete[] ctx->op_durations;
     delete[] ctx->p_en;
+    delete[] ctx->buffer_data;
+    delete[] ctx->tensor_stale;
+    for (auto callee_frame : ctx->callee_frames)
+    {
+        delete callee_frame;
+    }
     for (auto buffer : ctx->memory_buffers)
     {
         delete buffer;
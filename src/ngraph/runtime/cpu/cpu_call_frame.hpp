@@ -42,8 +42,14 @@ namespace ngraph
             class CPU_CallFrame
             {
             public:
+                /// \brief Create a call frame, optionally running on memory_pool instead of
+                ///        a temporary pool of its own.
+                ///
+                /// The pool has to hold CPU_ExternalFunction::get_memory_pool_size() bytes and
+                /// outlive the call frame. Only direct execution supports external pools.
                 CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
-                              EntryPoint compiled_function);
+                              EntryPoint compiled_function,
+                              uint8_t* memory_pool = nullptr);
                 ~CPU_CallFrame();
 
                 /// \brief Invoke the function with values matching the signature of the function.
@@ -52,6 +58,20 @@ namespace ngraph
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+                /// \brief Invoke the function on raw buffers in the default layouts of its
+                ///        parameters and results.
+                ///
+                /// Nothing is allocated, so kernels can call nested functions once per element.
+                /// Every input is treated as stale.
+                void call(std::vector<void*>& outputs, std::vector<void*>& inputs);
+
+                /// \brief Pointer tables sized to the parameters and results of the function.
+                ///
+                /// Callers of the raw call() can fill these in place instead of building new
+                /// vectors on every invocation.
+                std::vector<void*>& get_input_buffers() { return m_inputs; }
+                std::vector<void*>& get_output_buffers() { return m_outputs; }
+
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
@@ -59,13 +79,18 @@ namespace ngraph
                 void cleanup_runtime_context();
 
             protected:
+                void execute(std::vector<void*>& outputs, std::vector<void*>& inputs);
+
                 CPU_CallFrame(const CPU_CallFrame&) = delete;
                 CPU_CallFrame(CPU_CallFrame&&) = delete;
                 CPU_CallFrame& operator=(const CPU_CallFrame&) = delete;
 
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
+                uint8_t* m_memory_pool;
                 CPURuntimeContext* ctx;
+                std::vector<void*> m_inputs;
+                std::vector<void*> m_outputs;
             };
         }
     }
@@ -232,6 +232,49 @@ namespace ngraph
                        << ", MPI_SUM, MPI_COMM_WORLD);\n";
                 writer.block_end();
             }
+
+            // Generated code has no state that outlives an op, so the reduction completes before
+            // the start returns and the wait only unpacks the buffer
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::AllReduceStart)
+            {
+                const element::Type& element_type = out[0].get_element_type();
+                auto data_type = "MPI_FLOAT";
+
+                if (element_type == element::f64)
+                {
+                    data_type = "MPI_DOUBLE";
+                }
+
+                writer.block_begin();
+                size_t offset = 0;
+                for (auto& arg : args)
+                {
+                    writer << "memcpy(" << out[0].get_name() << " + " << offset << ", "
+                           << arg.get_name() << ", " << arg.get_size() * element_type.size()
+                           << ");\n";
+                    offset += arg.get_size();
+                }
+                writer << "MPI_Allreduce(MPI_IN_PLACE, " << out[0].get_name() << ", "
+                       << out[0].get_size() << ", " << data_type
+                       << ", MPI_SUM, MPI_COMM_WORLD);\n";
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::AllReduceWait)
+            {
+                writer.block_begin();
+                size_t offset = 0;
+                for (auto& output : out)
+                {
+                    writer << "memcpy(" << output.get_name() << ", " << args[0].get_name()
+                           << " + " << offset << ", "
+                           << output.get_size() * output.get_element_type().size() << ");\n";
+                    offset += output.get_size();
+                }
+                writer.block_end();
+            }
 #endif
 
             static void emitCblasSgemmBatch(codegen::CodeWriter& writer,
@@ -3929,33 +3972,9 @@ namespace ngraph
             {
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
 
-                auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
+                auto input_desc = mkldnn_utils::get_convert_layout_input_md(node);
                 auto result_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
 
-                //this is a special case to handle nchw(oihw) to goihw/Goihw16g/Goihw8g for GroupConvolution's weights
-                if (input_desc.data.format == mkldnn_nchw &&
-                    result_desc.data.format == mkldnn_goihw)
-                {
-                    input_desc = result_desc;
-                }
-                else if (input_desc.data.format == mkldnn_nchw &&
-                         input_desc.data.ndims == 4 /*nchw*/ &&
-                         result_desc.data.ndims == 5 /*Goihw16g/Goihw8g/etc*/ &&
-                         node->get_users().size() == 1)
-                {
-                    auto gconv = std::dynamic_pointer_cast<ngraph::op::GroupConvolution>(
-                        *(begin(node->get_users())));
-                    if (gconv)
-                    {
-                        Shape weights_shape_groups = gconv->get_weights_dimensions();
-                        input_desc = mkldnn::memory::desc(
-                            mkldnn::memory::dims(weights_shape_groups.begin(),
-                                                 weights_shape_groups.end()),
-                            mkldnn_utils::get_mkldnn_data_type(args[0].get_element_type()),
-                            mkldnn::memory::format::goihw);
-                    }
-                }
-
                 size_t reorder_index = mkldnn_emitter->build_reorder(input_desc, result_desc);
 
                 auto& deps = mkldnn_emitter->get_primitive_deps(reorder_index);
@@ -4576,6 +4595,17 @@ namespace ngraph
                 auto nege =
                     std::bind(emit_prefix_operator, std::string("-"), std::placeholders::_1);
                 auto sube = std::bind(emit_infix_operator, std::string("-"), std::placeholders::_1);
+                auto mule = std::bind(emit_infix_operator, std::string("*"), std::placeholders::_1);
+                auto dive = std::bind(emit_infix_operator, std::string("/"), std::placeholders::_1);
+                auto call = [](const std::string& function) {
+                    return std::bind(emit_function_call, function, std::placeholders::_1);
+                };
+                auto sigmoide = [](const std::vector<std::string>& args) {
+                    return "1 / (1 + std::exp(-" + args.at(0) + "))";
+                };
+                auto signe = [](const std::vector<std::string>& args) {
+                    return "((0 < " + args.at(0) + ") - (" + args.at(0) + " < 0))";
+                };
 
                 return std::unordered_map<
                     std::type_index,
@@ -4587,6 +4617,25 @@ namespace ngraph
                     {TI(ngraph::op::Add), adde},
                     {TI(ngraph::op::Negative), nege},
                     {TI(ngraph::op::Subtract), sube},
+                    {TI(ngraph::op::Multiply), mule},
+                    {TI(ngraph::op::Divide), dive},
+                    {TI(ngraph::op::Power), call("std::pow")},
+                    {TI(ngraph::op::Acos), call("std::acos")},
+                    {TI(ngraph::op::Asin), call("std::asin")},
+                    {TI(ngraph::op::Atan), call("std::atan")},
+                    {TI(ngraph::op::Ceiling), call("std::ceil")},
+                    {TI(ngraph::op::Cos), call("std::cos")},
+                    {TI(ngraph::op::Cosh), call("std::cosh")},
+                    {TI(ngraph::op::Exp), call("std::exp")},
+                    {TI(ngraph::op::Floor), call("std::floor")},
+                    {TI(ngraph::op::Log), call("std::log")},
+                    {TI(ngraph::op::Sin), call("std::sin")},
+                    {TI(ngraph::op::Sinh), call("std::sinh")},
+                    {TI(ngraph::op::Sqrt), call("std::sqrt")},
+                    {TI(ngraph::op::Tan), call("std::tan")},
+                    {TI(ngraph::op::Tanh), call("std::tanh")},
+                    {TI(ngraph::op::Sigmoid), sigmoide},
+                    {TI(ngraph::op::Sign), signe},
                 };
             }
 
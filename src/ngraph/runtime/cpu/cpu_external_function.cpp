@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
 #include <memory>
@@ -22,6 +23,7 @@
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 
 // Kill clang diagnostics bug
 #pragma clang diagnostic push
@@ -116,6 +118,7 @@
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/op/topk.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/cse.hpp"
@@ -126,6 +129,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
+#include "ngraph/pass/reshape_elimination.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
@@ -135,6 +139,7 @@
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/cpu_visualize_tree.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
@@ -164,10 +169,14 @@
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_prepack_constants.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_reshape_sinking.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
+#include "ngraph/util.hpp"
 
 #ifdef NGRAPH_DISTRIBUTED
 #include "ngraph/op/allreduce.hpp"
@@ -181,10 +190,13 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     : m_function(function)
     , m_release_function(release_function)
     , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    // Flow graph nodes run out of program order, so a freed pool offset can
+    // only be handed to another tensor when ops execute sequentially
+    , m_enable_memory_sharing(std::getenv("NGRAPH_CPU_MEMORY_SHARING") != nullptr && !m_use_tbb)
+    , m_emit_timing(false)
     , m_compiled_function(nullptr)
 #if !defined(NGRAPH_DEX_ONLY)
     , m_is_compiled(false)
-    , m_emit_timing(false)
 #endif
     , m_function_name(function->get_name())
     , m_is_built(false)
@@ -250,6 +262,8 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Add), &runtime::cpu::CPU_Emitter::emit<op::Add>},
 #ifdef NGRAPH_DISTRIBUTED
     {TI(ngraph::op::AllReduce), &runtime::cpu::CPU_Emitter::emit<op::AllReduce>},
+    {TI(ngraph::op::AllReduceStart), &runtime::cpu::CPU_Emitter::emit<op::AllReduceStart>},
+    {TI(ngraph::op::AllReduceWait), &runtime::cpu::CPU_Emitter::emit<op::AllReduceWait>},
 #endif
     {TI(ngraph::op::MatmulBias), &runtime::cpu::CPU_Emitter::emit<op::MatmulBias>},
     {TI(ngraph::op::Dot), &runtime::cpu::CPU_Emitter::emit<op::Dot>},
@@ -399,9 +413,21 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<ngraph::pass::CommonFunctionCollection>(
         femitter, node_function_map, common_function_string);
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(
+        size_t(s_memory_pool_alignment), !m_enable_memory_sharing, true);
     pass_manager.run_passes(m_function);
 
+    if (m_enable_memory_sharing)
+    {
+        for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
+        {
+            size_t unshared_size = find_shared_intermediates(current_function);
+            NGRAPH_DEBUG << "CPU codegen: " << current_function->get_name()
+                         << " temporary pool size " << current_function->get_temporary_pool_size()
+                         << " bytes, " << unshared_size << " bytes without memory sharing";
+        }
+    }
+
     unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
@@ -544,14 +570,27 @@ using namespace ngraph::runtime;
                 m_active_constants.push_back(node);
                 shared_ptr<descriptor::Tensor> tv = node->get_outputs()[0].get_tensor_ptr();
                 string type = tv->get_element_type().c_type_string();
-                writer << "static " << type << "* " << tv->get_name() << " = ((" << type << "*)("
-                       << c->get_data_ptr() << "));\n";
+                writer << "static " << type << "* " << tv->get_name() << " = nullptr;\n";
                 m_variable_name_map[tv->get_name()] = tv->get_name();
                 m_tensor_roles[tv->get_name()] = CPUTensorRole::CONSTANT;
             }
         }
     }
 
+    // Constant data is bound once the module is loaded instead of being baked
+    // into the source, so the compiled module does not depend on this process
+    writer << "extern \"C\" void set_constant_data(void** constants)\n";
+    writer << "{\n";
+    writer.indent++;
+    for (size_t i = 0; i < m_active_constants.size(); i++)
+    {
+        shared_ptr<descriptor::Tensor> tv = m_active_constants[i]->get_output_tensor_ptr();
+        string type = tv->get_element_type().c_type_string();
+        writer << tv->get_name() << " = static_cast<" << type << "*>(constants[" << i << "]);\n";
+    }
+    writer.indent--;
+    writer << "}\n\n";
+
     writer << "// Declare all functions\n";
     for (shared_ptr<Function> f : pass_manager.get_state().get_functions())
     {
@@ -801,8 +840,9 @@ using namespace ngraph::runtime;
                 }
 
                 // Always enable nodes computing output tensors or nodes whose outputs might get
-                // overwritten due to inplace kernels
-                if (computes_result(node.get()) || possibly_overwritten(node.get()))
+                // overwritten due to inplace kernels or memory sharing
+                if (computes_result(node.get()) || possibly_overwritten(node.get()) ||
+                    computes_shared_intermediate(node.get()))
                 {
                     writer << " || 1";
                 }
@@ -952,6 +992,19 @@ using namespace ngraph::runtime;
         throw runtime_error("could not find compiled function");
     }
 
+    auto set_constant_data = m_execution_engine->find_function<void(void**)>("set_constant_data");
+    if (set_constant_data == nullptr)
+    {
+        throw runtime_error("could not find compiled function set_constant_data");
+    }
+    vector<void*> constant_data;
+    for (const shared_ptr<Node>& node : m_active_constants)
+    {
+        constant_data.push_back(
+            const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
+    }
+    set_constant_data(constant_data.data());
+
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
     {
@@ -1001,6 +1054,12 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(ngraph::pass::Ma
 {
     pass_manager.register_pass<ngraph::pass::LikeReplacement>();
     pass_manager.register_pass<ngraph::pass::NopElimination>();
+    // Transposes are sunk towards the results, where inverse pairs cancel out
+    m_reshape_sinking = pass_manager.register_pass<runtime::cpu::pass::CPUReshapeSinking>();
+    pass_manager.register_pass<ngraph::pass::ReshapeElimination>();
+#ifdef NGRAPH_DISTRIBUTED
+    pass_manager.register_pass<ngraph::pass::AllReduceBucketing>();
+#endif
     // TODO (pruthvi): Enable all the disabeled RNN fusion graph pass after fixing
     // failing mxnet unit tests.
     // pass_manager.register_pass<runtime::cpu::pass::LSTMFusion>();
@@ -1015,6 +1074,12 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(ngraph::pass::Ma
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUHorizontalFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUCollapseDims>();
+    if (m_direct_execution)
+    {
+        // Chains of elementwise ops left after the fusions above are
+        // evaluated in a single pass over memory
+        pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
+    }
     NodeVector nv_cwi; // We dont need CPUWorkspaceInsertion to return list of indices
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi, false);
     pass_manager.register_pass<runtime::cpu::pass::CPUAssignment>(this);
@@ -1037,6 +1102,86 @@ bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
     return false;
 }
 
+size_t runtime::cpu::CPU_ExternalFunction::find_shared_intermediates(
+    const shared_ptr<ngraph::Function>& function)
+{
+    // Tensors produced in place of their input occupy the same buffer as that
+    // input; any other overlap in the pool means the memory was reused
+    unordered_map<const descriptor::Tensor*, size_t> buffer_ids;
+    vector<const descriptor::Tensor*> intermediates;
+    size_t buffer_count = 0;
+    size_t unshared_size = 0;
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        unordered_map<const descriptor::Tensor*, const descriptor::Tensor*> in_place_outputs;
+        if (auto op = std::dynamic_pointer_cast<ngraph::op::Op>(node))
+        {
+            if (auto op_annotations = op->get_op_annotations())
+            {
+                for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
+                {
+                    auto output = &node->get_outputs().at(oi_pair.output).get_tensor();
+                    auto input = &node->get_inputs().at(oi_pair.input).get_tensor();
+                    if (node->liveness_free_list.count(input) != 0 &&
+                        buffer_ids.count(input) != 0 &&
+                        output->get_pool_offset() == input->get_pool_offset())
+                    {
+                        in_place_outputs.insert({output, input});
+                    }
+                }
+            }
+        }
+
+        for (const descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            if (in_place_outputs.count(tensor))
+            {
+                buffer_ids[tensor] = buffer_ids.at(in_place_outputs.at(tensor));
+            }
+            else
+            {
+                buffer_ids[tensor] = buffer_count++;
+                unshared_size += ngraph::pass::MemoryManager::align(tensor->size(),
+                                                                    s_memory_pool_alignment);
+            }
+            intermediates.push_back(tensor);
+        }
+    }
+
+    sort(intermediates.begin(),
+         intermediates.end(),
+         [](const descriptor::Tensor* a, const descriptor::Tensor* b) {
+             return a->get_pool_offset() < b->get_pool_offset();
+         });
+    for (size_t i = 0; i < intermediates.size(); i++)
+    {
+        size_t end = intermediates[i]->get_pool_offset() + intermediates[i]->size();
+        for (size_t j = i + 1;
+             j < intermediates.size() && intermediates[j]->get_pool_offset() < end;
+             j++)
+        {
+            if (buffer_ids.at(intermediates[i]) != buffer_ids.at(intermediates[j]))
+            {
+                m_shared_intermediates.insert(intermediates[i]);
+                m_shared_intermediates.insert(intermediates[j]);
+            }
+        }
+    }
+    return unshared_size;
+}
+
+bool runtime::cpu::CPU_ExternalFunction::computes_shared_intermediate(Node* node)
+{
+    for (size_t i = 0; i < node->get_output_size(); i++)
+    {
+        if (m_shared_intermediates.count(&node->get_output_tensor(i)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void runtime::cpu::CPU_ExternalFunction::propagate_in_place_input(
     ngraph::descriptor::Output* output, std::string input_name, bool dex)
 {
@@ -1147,10 +1292,21 @@ void runtime::cpu::CPU_ExternalFunction::build()
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
     ngraph::pass::Manager pass_manager;
     register_common_passes(pass_manager);
+    // Weights are reordered once here instead of by ConvertLayout on every call
+    pass_manager.register_pass<runtime::cpu::pass::CPUPrepackConstants>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(
+        size_t(s_memory_pool_alignment), !m_enable_memory_sharing, true);
     pass_manager.run_passes(m_function, false);
 
+    if (m_enable_memory_sharing)
+    {
+        size_t unshared_size = find_shared_intermediates(m_function);
+        NGRAPH_DEBUG << "CPU DEX: " << m_function_name << " temporary pool size "
+                     << m_function->get_temporary_pool_size() << " bytes, " << unshared_size
+                     << " bytes without memory sharing";
+    }
+
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
     {
@@ -1188,6 +1344,9 @@ void runtime::cpu::CPU_ExternalFunction::build()
     }
 
     // Build executor
+    // Every tensor the functors touch is addressed through a slot in the
+    // per-call-frame buffer table so that several call frames can execute
+    // the same compiled function concurrently
     // Intermediates
     if (m_function->get_temporary_pool_size())
     {
@@ -1197,7 +1356,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             for (auto tensor : node->liveness_new_list)
             {
-                intermediates_offsets.emplace_back(tensor_data[tensor->get_name()],
+                intermediates_offsets.emplace_back(get_raw_buffer_index(tensor->get_name()),
                                                    tensor->get_pool_offset());
                 m_tensor_roles[tensor->get_name()] = CPUTensorRole::INTERMEDIATE;
             }
@@ -1210,8 +1369,9 @@ void runtime::cpu::CPU_ExternalFunction::build()
         if (node->is_constant())
         {
             auto tv = node->get_outputs()[0].get_tensor_ptr();
-            tensor_data[tv->get_name()] =
-                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr());
+            constant_tensor_data.emplace_back(
+                get_raw_buffer_index(tv->get_name()),
+                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
             m_tensor_roles[tv->get_name()] = CPUTensorRole::CONSTANT;
         }
     }
@@ -1223,8 +1383,9 @@ void runtime::cpu::CPU_ExternalFunction::build()
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
             shared_ptr<descriptor::Tensor> tv = param->get_output_tensor_ptr(i);
-            function_input_index.emplace_back(
-                tensor_data[tv->get_name()], arg_index, tensor_stale[tv->get_name()]);
+            function_input_index.emplace_back(get_raw_buffer_index(tv->get_name()),
+                                              arg_index,
+                                              get_stale_index(tv->get_name()));
             m_tensor_roles[tv->get_name()] = CPUTensorRole::INPUT;
             propagate_in_place_input(&param->get_outputs().at(i), tv->get_name(), true);
             arg_index++;
@@ -1236,7 +1397,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
     {
         shared_ptr<Node> op = m_function->get_output_op(i);
         shared_ptr<descriptor::Tensor> tv = op->get_output_tensor_ptr();
-        function_output_index.emplace_back(tensor_data[tv->get_name()], i);
+        function_output_index.emplace_back(get_raw_buffer_index(tv->get_name()), i);
         m_tensor_roles[tv->get_name()] = CPUTensorRole::OUTPUT;
 
         //keep assigning different outputs to a result descriptor
@@ -1248,7 +1409,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             shared_ptr<descriptor::Tensor> itv =
                 res->get_inputs().at(0).get_output().get_tensor_ptr();
-            function_output_index.emplace_back(tensor_data[itv->get_name()], i);
+            function_output_index.emplace_back(get_raw_buffer_index(itv->get_name()), i);
             m_tensor_roles[itv->get_name()] = CPUTensorRole::OUTPUT;
             tensor_alias[itv->get_name()] = tv->get_name();
             propagate_in_place_output(
@@ -1256,6 +1417,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
     }
 
+    unordered_map<Node*, size_t> op_index_map;
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1289,35 +1451,52 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names);
+        m_op_names.push_back(node->get_name());
 
+        size_t primitive_count = m_mkldnn_emitter->get_mkldnn_primitives().size();
         handler->second(this, node.get(), in, out);
 
-        bool disable_caching = computes_result(node.get()) || possibly_overwritten(node.get());
+        // MKLDNN primitives hold the data handles of their memory objects, so
+        // an op that binds and executes its primitives must not interleave
+        // with the same op in another call frame. Each op has a lock of its
+        // own, different ops still run concurrently.
+        if (m_mkldnn_emitter->get_mkldnn_primitives().size() != primitive_count)
+        {
+            auto functor = functors.back();
+            auto primitives_mutex = make_shared<mutex>();
+            functors.back() = [primitives_mutex, functor](CPURuntimeContext* ctx) {
+                lock_guard<mutex> lock(*primitives_mutex);
+                functor(ctx);
+            };
+        }
 
-        vector<reference_wrapper<bool>> in_stale, out_stale;
+        bool disable_caching = computes_result(node.get()) || possibly_overwritten(node.get()) ||
+                               computes_shared_intermediate(node.get());
+
+        vector<size_t> in_stale, out_stale;
         for (const auto& name : in_names)
         {
             if (tensor_alias.count(name))
             {
-                in_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                in_stale.emplace_back(get_stale_index(tensor_alias[name]));
             }
             else
             {
-                in_stale.emplace_back(tensor_stale[name]);
+                in_stale.emplace_back(get_stale_index(name));
             }
         }
         for (const auto& name : out_names)
         {
-            out_stale.emplace_back(tensor_stale[name]);
+            out_stale.emplace_back(get_stale_index(name));
         }
 
         function<bool(CPURuntimeContext*)> enable;
         if (disable_caching)
         {
             enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
-                for (auto& stale : out_stale)
+                for (auto stale : out_stale)
                 {
-                    stale.get() = true;
+                    ctx->tensor_stale[stale] = true;
                 }
                 return true;
             };
@@ -1326,24 +1505,36 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
                 bool en = false;
-                for (const auto& stale : in_stale)
+                for (auto stale : in_stale)
                 {
-                    if (stale)
+                    if (ctx->tensor_stale[stale])
                     {
                         en = true;
                         break;
                     }
                 }
-                for (auto& stale : out_stale)
+                for (auto stale : out_stale)
                 {
-                    stale.get() = en;
+                    ctx->tensor_stale[stale] = en;
                 }
                 return en;
             };
         }
 
         enables.emplace_back(enable);
-        enable_nodename_list.emplace_back(make_pair(enable, node->get_name()));
+
+        // Record the data dependencies between ops so that call frames can
+        // build their flow graphs after the function has been released
+        vector<size_t> dependencies;
+        for (auto arg : node->get_arguments())
+        {
+            if (!arg->is_parameter() && !arg->is_constant())
+            {
+                dependencies.push_back(op_index_map.at(arg.get()));
+            }
+        }
+        op_index_map[node.get()] = op_dependencies.size();
+        op_dependencies.push_back(dependencies);
     }
 
     if ((std::getenv("NGRAPH_DEX_DEBUG") != nullptr))
@@ -1370,13 +1561,12 @@ void runtime::cpu::CPU_ExternalFunction::build()
         write_to_file(strm.str(), s_debug_dir, filename);
         strm.str("");
 
-        //dump the op's order of execution along with the address of
-        //tensor_data which holds the base address of each tensor.
+        //dump the op's order of execution along with the buffer table slot
+        //which holds the base address of each tensor.
         for (shared_ptr<Node> node : m_function->get_ordered_ops())
         {
             std::vector<string> node_inputs;
             std::vector<string> node_outputs;
-            std::stringstream temp;
             if (node->is_parameter() || node->is_constant())
             {
                 continue;
@@ -1385,17 +1575,15 @@ void runtime::cpu::CPU_ExternalFunction::build()
             {
                 const descriptor::Output& output = input.get_output();
                 shared_ptr<descriptor::Tensor> tv = output.get_tensor_ptr();
-                temp << &tensor_data[tv->get_name()];
-                node_inputs.push_back(tv->get_name() + "(" + temp.str() + ")");
-                temp.str("");
+                node_inputs.push_back(tv->get_name() + "(" +
+                                      to_string(get_buffer_index(tv->get_name())) + ")");
             }
 
             for (const descriptor::Output& output : node->get_outputs())
             {
                 shared_ptr<descriptor::Tensor> tv = output.get_tensor_ptr();
-                temp << &tensor_data[tv->get_name()];
-                node_outputs.push_back(tv->get_name() + "(" + temp.str() + ")");
-                temp.str("");
+                node_outputs.push_back(tv->get_name() + "(" +
+                                       to_string(get_buffer_index(tv->get_name())) + ")");
             }
             strm << "\n" << node->get_name() << "(";
             vector<string> parameter_nodes = node_inputs;
@@ -1409,103 +1597,95 @@ void runtime::cpu::CPU_ExternalFunction::build()
     //This check ensures we have exactly one functor for Op.
     assert(m_op_attrs.size() == functors.size());
 
-    executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
-        cpu::Timestamp start_ts;
-        int profiler_count = 0;
-
-        if (ctx->first_iteration)
-        {
-            for (auto& p : intermediates_offsets)
-            {
-                p.first.get() = static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
-            }
-        }
+    if (m_emit_timing)
+    {
+        m_op_timings = vector<OpTiming>(functors.size());
+    }
 
+    // The executor only reads state that is immutable after build() and keeps
+    // everything that changes per call in the runtime context
+    executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
         for (const auto& p : function_input_index)
         {
-            get<0>(p).get() = inputs[get<1>(p)];
-            get<2>(p).get() = ctx->p_en[get<1>(p)];
+            ctx->buffer_data[get<0>(p)] = inputs[get<1>(p)];
+            ctx->tensor_stale[get<2>(p)] = ctx->p_en[get<1>(p)];
         }
 
         for (const auto& p : function_output_index)
         {
-            p.first.get() = outputs[p.second];
+            ctx->buffer_data[p.first] = outputs[p.second];
         }
 
-        auto functor = functors.begin();
         if (m_use_tbb)
         {
             // Build the flow graph
             if (ctx->first_iteration)
             {
-                std::unordered_map<
-                    std::string,
-                    tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*>
-                    nodename_tbbnode_map;
+                vector<tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*>
+                    flowgraph_nodes;
                 tbb::flow::continue_node<tbb::flow::continue_msg,
                                          tbb::flow::lightweight>* flowgraph_node_start =
                     new tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>(
-                        *(ctx->G), [&](const tbb::flow::continue_msg& msg) {});
-                auto it = enable_nodename_list.begin();
+                        *(ctx->G), [](const tbb::flow::continue_msg& msg) {});
+                auto functor = functors.begin();
+                size_t op_index = 0;
                 for (const auto& p : enables)
                 {
+                    auto& op_functor = *functor;
+                    auto& op_enable = p;
                     tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*
                         flowgraph_node = new tbb::flow::continue_node<tbb::flow::continue_msg,
                                                                       tbb::flow::lightweight>(
-                            *(ctx->G), [&](const tbb::flow::continue_msg& msg) {
-                                if (p(ctx) || ctx->first_iteration)
+                            *(ctx->G),
+                            [this, ctx, op_index, &op_functor, &op_enable](
+                                const tbb::flow::continue_msg& msg) {
+                                cpu::Timestamp start_ts;
+                                if (op_enable(ctx) || ctx->first_iteration)
                                 {
-                                    if (runtime::cpu::IsTracingEnabled())
+                                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
-                                    (*functor)(ctx);
-                                    if (runtime::cpu::IsTracingEnabled())
+                                    op_functor(ctx);
+                                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
-                                        ctx->op_durations[profiler_count++] =
-                                            (std::chrono::duration_cast<cpu::Timescale>(
-                                                 cpu::Clock::now() - start_ts))
-                                                .count();
+                                        auto elapsed = cpu::Clock::now() - start_ts;
+                                        if (runtime::cpu::IsTracingEnabled())
+                                        {
+                                            ctx->op_durations[op_index] =
+                                                (std::chrono::duration_cast<cpu::Timescale>(
+                                                     elapsed))
+                                                    .count();
+                                        }
+                                        if (m_emit_timing)
+                                        {
+                                            record_op_timing(op_index, elapsed);
+                                        }
                                     }
                                 }
                                 else
                                 {
                                     if (runtime::cpu::IsTracingEnabled())
                                     {
-                                        ctx->op_durations[profiler_count++] = 0;
+                                        ctx->op_durations[op_index] = 0;
                                     }
                                 }
-                                std::advance(functor, 1);
                             });
-                    nodename_tbbnode_map.insert({it->second, flowgraph_node});
-                    it++;
+                    flowgraph_nodes.push_back(flowgraph_node);
+                    std::advance(functor, 1);
+                    op_index++;
                 }
 
-                traverse_nodes(
-                    m_function, [&flowgraph_node_start, &nodename_tbbnode_map](shared_ptr<Node> n) {
-                        if (!n->is_parameter() && !n->is_constant())
-                        {
-                            bool is_head = true;
-                            for (auto arg : n->get_arguments())
-                            {
-                                if (!arg->is_parameter() && !arg->is_constant())
-                                {
-                                    is_head = false;
-                                    tbb::flow::make_edge(*(nodename_tbbnode_map[arg->get_name()]),
-                                                         *(nodename_tbbnode_map[n->get_name()]));
-                                }
-                            }
-                            if (is_head)
-                            {
-                                tbb::flow::make_edge(*flowgraph_node_start,
-                                                     *(nodename_tbbnode_map[n->get_name()]));
-                            }
-                        }
-                    });
-
-                if (m_release_function)
+                for (size_t i = 0; i < op_dependencies.size(); i++)
                 {
-                    release_function();
+                    if (op_dependencies[i].empty())
+                    {
+                        tbb::flow::make_edge(*flowgraph_node_start, *flowgraph_nodes[i]);
+                    }
+                    for (auto dependency : op_dependencies[i])
+                    {
+                        tbb::flow::make_edge(*flowgraph_nodes[dependency], *flowgraph_nodes[i]);
+                    }
                 }
             }
             // Execute the flow graph
@@ -1524,23 +1704,33 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
         else
         {
+            cpu::Timestamp start_ts;
+            size_t profiler_count = 0;
+            size_t op_index = 0;
+            auto functor = functors.begin();
             for (const auto& p : enables)
             {
                 if (p(ctx) || ctx->first_iteration)
                 {
                     // Each Op will have exactly one functor, start the clock before the exceution of functor
                     // and collect the profiler_count once the execution complets
-                    if (runtime::cpu::IsTracingEnabled())
+                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                     {
                         start_ts = cpu::Clock::now();
                     }
                     (*functor)(ctx);
-                    if (runtime::cpu::IsTracingEnabled())
+                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                     {
-                        ctx->op_durations[profiler_count++] =
-                            (std::chrono::duration_cast<cpu::Timescale>(cpu::Clock::now() -
-                                                                        start_ts))
-                                .count();
+                        auto elapsed = cpu::Clock::now() - start_ts;
+                        if (runtime::cpu::IsTracingEnabled())
+                        {
+                            ctx->op_durations[profiler_count++] =
+                                (std::chrono::duration_cast<cpu::Timescale>(elapsed)).count();
+                        }
+                        if (m_emit_timing)
+                        {
+                            record_op_timing(op_index, elapsed);
+                        }
                     }
                 }
                 else
@@ -1551,35 +1741,168 @@ void runtime::cpu::CPU_ExternalFunction::build()
                     }
                 }
                 std::advance(functor, 1);
+                op_index++;
+            }
+            if (runtime::cpu::IsTracingEnabled())
+            {
+                assert(m_op_attrs.size() == profiler_count);
             }
         }
         ctx->first_iteration = false;
-
-        if (runtime::cpu::IsTracingEnabled())
-        {
-            assert(m_op_attrs.size() == profiler_count);
-        }
-
     };
 
     m_is_built = true;
 
-    if (m_release_function && !m_use_tbb)
+    if (m_release_function)
     {
         release_function();
     }
 }
 
-void*& runtime::cpu::CPU_ExternalFunction::get_tensor_data(const std::string& name)
+size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& name)
 {
     if (tensor_alias.count(name))
     {
-        return tensor_data[tensor_alias[name]];
+        return get_raw_buffer_index(tensor_alias[name]);
     }
     else
     {
-        return tensor_data[name];
+        return get_raw_buffer_index(name);
+    }
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_raw_buffer_index(const std::string& name)
+{
+    auto it = m_buffer_indices.find(name);
+    if (it == m_buffer_indices.end())
+    {
+        it = m_buffer_indices.emplace(name, m_buffer_indices.size()).first;
+    }
+    return it->second;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_stale_index(const std::string& name)
+{
+    auto it = m_stale_indices.find(name);
+    if (it == m_stale_indices.end())
+    {
+        it = m_stale_indices.emplace(name, m_stale_indices.size()).first;
+    }
+    return it->second;
+}
+
+void runtime::cpu::CPU_ExternalFunction::initialize_runtime_context(CPURuntimeContext* ctx,
+                                                                     uint8_t* memory_pool)
+{
+    ctx->buffer_data = new void*[m_buffer_indices.size()]();
+    ctx->tensor_stale = new bool[m_stale_indices.size()]();
+
+    for (const auto& p : intermediates_offsets)
+    {
+        ctx->buffer_data[p.first] = memory_pool + p.second;
+    }
+    for (const auto& p : constant_tensor_data)
+    {
+        ctx->buffer_data[p.first] = p.second;
+    }
+
+    // Callee frames run on consecutive slices of the pool that follow the intermediates
+    size_t offset = get_intermediate_pool_size();
+    for (auto& callee : m_callee_frame_functions)
+    {
+        ctx->callee_frames.push_back(
+            new CPU_CallFrame(callee, callee->m_compiled_function, memory_pool + offset));
+        offset += callee->get_memory_pool_size();
     }
+#ifdef NGRAPH_DISTRIBUTED
+    ctx->allreduce_requests.resize(m_allreduce_request_indices.size(), MPI_REQUEST_NULL);
+#endif
+}
+
+#ifdef NGRAPH_DISTRIBUTED
+size_t runtime::cpu::CPU_ExternalFunction::get_allreduce_request_index(const string& start_name)
+{
+    auto it = m_allreduce_request_indices.find(start_name);
+    if (it != m_allreduce_request_indices.end())
+    {
+        return it->second;
+    }
+    size_t index = m_allreduce_request_indices.size();
+    m_allreduce_request_indices[start_name] = index;
+    return index;
+}
+#endif
+
+size_t runtime::cpu::CPU_ExternalFunction::add_callee_frame(
+    const std::shared_ptr<CPU_ExternalFunction>& callee)
+{
+    if (!callee->m_is_built)
+    {
+        callee->build();
+    }
+    m_callee_frame_functions.push_back(callee);
+    return m_callee_frame_functions.size() - 1;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_intermediate_pool_size() const
+{
+    size_t size = 0;
+    for (auto buffer_size : m_memory_buffer_sizes)
+    {
+        size += ngraph::round_up(buffer_size, s_memory_pool_alignment);
+    }
+    return size;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_memory_pool_size() const
+{
+    size_t size = get_intermediate_pool_size();
+    for (auto& callee : m_callee_frame_functions)
+    {
+        size += callee->get_memory_pool_size();
+    }
+    return size;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_reshape_sinking_eliminated_bytes() const
+{
+    return m_reshape_sinking ? m_reshape_sinking->get_eliminated_bytes() : 0;
+}
+
+Eigen::ThreadPoolDevice& runtime::cpu::CPU_ExternalFunction::get_eigen_device()
+{
+    if (m_thread_pool)
+    {
+        return m_thread_pool->get_device();
+    }
+    return eigen::global_thread_pool_device;
+}
+
+void runtime::cpu::CPU_ExternalFunction::record_op_timing(size_t op_index,
+                                                          cpu::Clock::duration elapsed)
+{
+    // Call frames may execute concurrently, so totals are only ever added to
+    OpTiming& timing = m_op_timings[op_index];
+    timing.m_nanoseconds.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+        std::memory_order_relaxed);
+    timing.m_call_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+vector<runtime::PerformanceCounter>
+    runtime::cpu::CPU_ExternalFunction::get_performance_data() const
+{
+    vector<runtime::PerformanceCounter> rc;
+    for (size_t i = 0; i < m_op_timings.size(); i++)
+    {
+        size_t call_count = m_op_timings[i].m_call_count.load(std::memory_order_relaxed);
+        if (call_count > 0)
+        {
+            size_t nanoseconds = m_op_timings[i].m_nanoseconds.load(std::memory_order_relaxed);
+            rc.push_back({m_op_names[i].c_str(), nanoseconds / 1000, call_count});
+        }
+    }
+    return rc;
 }
 
 shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
@@ -16,14 +16,17 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -41,6 +44,16 @@
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+#ifdef NGRAPH_DISTRIBUTED
+#include <mpi.h>
+#endif
+
+namespace Eigen
+{
+    struct ThreadPoolDevice;
+}
 
 namespace ngraph
 {
@@ -52,6 +65,16 @@ namespace ngraph
             class CPU_Emitter;
             class CPU_CallFrame;
 
+            namespace eigen
+            {
+                class LocalThreadPool;
+            }
+
+            namespace pass
+            {
+                class CPUReshapeSinking;
+            }
+
 #if !defined(NGRAPH_DEX_ONLY)
 
             using OpFunction = std::function<void(CPU_ExternalFunction* external_function,
@@ -117,8 +140,17 @@ namespace ngraph
                 {
                     return functors;
                 }
-                std::unordered_map<std::string, void*>& get_tensor_data() { return tensor_data; }
-                void*& get_tensor_data(const std::string& name);
+                // Slot of the named tensor in the runtime context's buffer table
+                size_t get_buffer_index(const std::string& name);
+                // Set up the per-call-frame buffer table, staleness flags and callee
+                // frames, with intermediates placed in memory_pool
+                void initialize_runtime_context(CPURuntimeContext* ctx, uint8_t* memory_pool);
+                // Give every call frame of this function a persistent call frame of
+                // callee and return its slot in CPURuntimeContext::callee_frames
+                size_t add_callee_frame(const std::shared_ptr<CPU_ExternalFunction>& callee);
+                // Bytes of temporary memory a DEX call frame needs, including the
+                // slices handed to the frames of its callees
+                size_t get_memory_pool_size() const;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -130,6 +162,21 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+#ifdef NGRAPH_DISTRIBUTED
+                // Index of the request of the reduction started by the named AllReduceStart in
+                // CPURuntimeContext::allreduce_requests, shared with the AllReduceWait that
+                // completes it. Each call frame has its own requests.
+                size_t get_allreduce_request_index(const std::string& start_name);
+#endif
+                // Thread pool device that the parallel elementwise kernels of
+                // this function use
+                Eigen::ThreadPoolDevice& get_eigen_device();
+                // Per-op execution times collected by the DEX executor,
+                // aggregated over all calls and call frames
+                std::vector<runtime::PerformanceCounter> get_performance_data() const;
+                // Bytes fewer that transposing Reshapes write after reshape
+                // sinking ran during compilation, 0 before compiling
+                size_t get_reshape_sinking_eliminated_bytes() const;
                 void write_to_file(const std::string& code,
                                    const std::string& directory,
                                    const std::string& filename);
@@ -158,6 +205,14 @@ namespace ngraph
                                                std::string output_name,
                                                bool dex);
                 bool computes_result(Node* node);
+                // Record the intermediates whose pool memory is reused by
+                // unrelated tensors and return the pool size needed without reuse
+                size_t find_shared_intermediates(const std::shared_ptr<ngraph::Function>& function);
+                bool computes_shared_intermediate(Node* node);
+                size_t get_raw_buffer_index(const std::string& name);
+                size_t get_stale_index(const std::string& name);
+                size_t get_intermediate_pool_size() const;
+                void record_op_timing(size_t op_index, cpu::Clock::duration elapsed);
 
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(codegen::CodeWriter& writer,
@@ -186,6 +241,12 @@ namespace ngraph
                 bool m_release_function;
 
                 bool m_use_tbb;
+                bool m_enable_memory_sharing;
+                bool m_emit_timing;
+                std::shared_ptr<runtime::cpu::pass::CPUReshapeSinking> m_reshape_sinking;
+                // Set when the backend runs elementwise kernels on a pool of its own
+                std::shared_ptr<eigen::LocalThreadPool> m_thread_pool;
+                std::unordered_set<const descriptor::Tensor*> m_shared_intermediates;
 
                 EntryPoint m_compiled_function;
                 std::unordered_map<std::string, std::string> m_variable_name_map;
@@ -195,7 +256,6 @@ namespace ngraph
                 bool m_is_compiled;
                 std::unique_ptr<codegen::Compiler> m_compiler;
                 std::unique_ptr<codegen::ExecutionEngine> m_execution_engine;
-                bool m_emit_timing;
 
                 std::map<std::string, size_t> m_name_index_map;
 
@@ -218,19 +278,30 @@ namespace ngraph
 
                 std::list<std::function<void(CPURuntimeContext*)>> functors;
                 std::list<std::function<bool(CPURuntimeContext*)>> enables;
-                std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
-                    enable_nodename_list;
+                std::vector<std::vector<size_t>> op_dependencies;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
-                std::unordered_map<std::string, void*> tensor_data;
-                std::unordered_map<std::string, bool> tensor_stale;
+                std::unordered_map<std::string, size_t> m_buffer_indices;
+                std::unordered_map<std::string, size_t> m_stale_indices;
                 std::unordered_map<std::string, std::string> tensor_alias;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> intermediates_offsets;
-                std::list<
-                    std::tuple<std::reference_wrapper<void*>, size_t, std::reference_wrapper<bool>>>
-                    function_input_index;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> function_output_index;
+                std::list<std::pair<size_t, size_t>> intermediates_offsets;
+                std::list<std::pair<size_t, void*>> constant_tensor_data;
+#ifdef NGRAPH_DISTRIBUTED
+                std::unordered_map<std::string, size_t> m_allreduce_request_indices;
+#endif
+                std::list<std::tuple<size_t, size_t, size_t>> function_input_index;
+                std::list<std::pair<size_t, size_t>> function_output_index;
+
+                struct OpTiming
+                {
+                    std::atomic<size_t> m_nanoseconds{0};
+                    std::atomic<size_t> m_call_count{0};
+                };
+                // Indexed like functors, only allocated when timing is enabled
+                std::vector<std::string> m_op_names;
+                std::vector<OpTiming> m_op_timings;
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
+                std::vector<std::shared_ptr<CPU_ExternalFunction>> m_callee_frame_functions;
                 bool m_is_built;
                 bool m_direct_execution;
             };
@@ -24,6 +24,10 @@
 #include <tbb/global_control.h>
 #include <tbb/task_scheduler_init.h>
 
+#ifdef NGRAPH_DISTRIBUTED
+#include <mpi.h>
+#endif
+
 namespace mkldnn
 {
     class primitive;
@@ -43,6 +47,8 @@ namespace ngraph
     {
         namespace cpu
         {
+            class CPU_CallFrame;
+
             typedef std::chrono::high_resolution_clock Clock;
             typedef std::chrono::time_point<Clock> Timestamp;
             typedef std::chrono::microseconds Timescale;
@@ -53,8 +59,16 @@ namespace ngraph
                 int64_t* op_durations;
                 bool* p_en;
                 bool first_iteration;
+                void** buffer_data;
+                bool* tensor_stale;
                 mkldnn::primitive* const* mkldnn_primitives;
                 std::vector<AlignedBuffer*> memory_buffers;
+                // Persistent frames of the functions called by FunctionCall ops
+                std::vector<CPU_CallFrame*> callee_frames;
+#ifdef NGRAPH_DISTRIBUTED
+                // Requests of the reductions in flight, indexed by AllReduceStart
+                std::vector<MPI_Request> allreduce_requests;
+#endif
                 char* const* mkldnn_workspaces;
                 tbb::flow::graph* G;
                 tbb::global_control* c;
@@ -19,6 +19,7 @@
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
+#include "ngraph/runtime/cpu/kernel/eigen_bfloat16.hpp"
 #include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
 
 namespace ngraph
@@ -30,7 +31,11 @@ namespace ngraph
             namespace kernel
             {
                 template <typename ElementType>
-                void add(void* input0, void* input1, void* output, size_t count)
+                void add(void* input0,
+                         void* input1,
+                         void* output,
+                         size_t count,
+                         const Eigen::ThreadPoolDevice& device)
                 {
                     Eigen::array<Eigen::Index, 1> out_dims, in_dims;
 
@@ -43,7 +48,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0 + in1;
+                    out.device(device) = in0 + in1;
                 }
             }
         }
@@ -30,7 +30,10 @@ namespace ngraph
             namespace kernel
             {
                 template <typename ElementType>
-                void asin(void* input0, void* output, size_t count)
+                void asin(void* input0,
+                          void* output,
+                          size_t count,
+                          const Eigen::ThreadPoolDevice& device)
                 {
                     Eigen::array<Eigen::Index, 1> out_dims, in_dims;
 
@@ -41,7 +44,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(device) =
                         in0.unaryExpr(Eigen::internal::scalar_asin_op<ElementType>());
                 }
             }
@@ -34,8 +34,8 @@ namespace ngraph
             namespace kernel
             {
                 template <typename ElementType, int Rank>
-                void concat(std::vector<std::reference_wrapper<void*>> inputs,
-                            std::vector<Shape> input_shapes,
+                void concat(const std::vector<void*>& inputs,
+                            const std::vector<Shape>& input_shapes,
                             void* output,
                             Shape output_shape,
                             size_t axis)
@@ -59,7 +59,7 @@ namespace ngraph
                         }
 
                         Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
-                            static_cast<ElementType*>(inputs[i].get()), in_dims);
+                            static_cast<ElementType*>(inputs[i]), in_dims);
                         out.slice(concat_pos, in_dims).device(eigen::global_thread_pool_device) =
                             in;
                         concat_pos[axis] += in_dims[axis];
@@ -20,6 +20,7 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/type/bfloat16.hpp"
 
 namespace ngraph
 {
@@ -104,6 +105,32 @@ namespace ngraph
                 {
                     convert<InputElementType, uint64_t>(input, output, count);
                 }
+
+                // bfloat16 is not an Eigen scalar type, so conversions to and from it are plain
+                // loops through float.
+                template <typename InputElementType>
+                void convert_to_bf16(void* input, void* output, size_t count)
+                {
+                    auto in = static_cast<const InputElementType*>(input);
+                    auto out = static_cast<bfloat16*>(output);
+#pragma omp parallel for
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = static_cast<float>(in[i]);
+                    }
+                }
+
+                template <typename OutputElementType>
+                void convert_from_bf16(void* input, void* output, size_t count)
+                {
+                    auto in = static_cast<const bfloat16*>(input);
+                    auto out = static_cast<OutputElementType*>(output);
+#pragma omp parallel for
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = static_cast<OutputElementType>(static_cast<float>(in[i]));
+                    }
+                }
             }
         }
     }
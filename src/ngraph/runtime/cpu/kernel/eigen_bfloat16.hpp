@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/type/bfloat16.hpp"
+
+// Lets Eigen tensor expressions run on bfloat16. There is no packet type for bfloat16, so the
+// kernels evaluate one element at a time, converting each operand to float and rounding the
+// result back to bfloat16.
+namespace Eigen
+{
+    template <>
+    struct NumTraits<ngraph::bfloat16> : GenericNumTraits<ngraph::bfloat16>
+    {
+        enum
+        {
+            IsSigned = true,
+            IsInteger = false,
+            IsComplex = false,
+            RequireInitialization = false,
+            ReadCost = 1,
+            AddCost = 2,
+            MulCost = 2
+        };
+
+        static inline ngraph::bfloat16 epsilon()
+        {
+            return std::numeric_limits<ngraph::bfloat16>::epsilon();
+        }
+        static inline ngraph::bfloat16 dummy_precision() { return ngraph::bfloat16(1e-2f); }
+        static inline ngraph::bfloat16 highest()
+        {
+            return std::numeric_limits<ngraph::bfloat16>::max();
+        }
+        static inline ngraph::bfloat16 lowest()
+        {
+            return std::numeric_limits<ngraph::bfloat16>::lowest();
+        }
+        static inline ngraph::bfloat16 infinity()
+        {
+            return std::numeric_limits<ngraph::bfloat16>::infinity();
+        }
+        static inline ngraph::bfloat16 quiet_NaN()
+        {
+            return std::numeric_limits<ngraph::bfloat16>::quiet_NaN();
+        }
+    };
+}
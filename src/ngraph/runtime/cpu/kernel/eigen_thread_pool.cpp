@@ -38,7 +38,7 @@ namespace ngraph
                         return count;
                     }
                     else if (ngraph_intra_op_parallelism &&
-                             (count == std::atoi(ngraph_intra_op_parallelism)))
+                             (count = std::atoi(ngraph_intra_op_parallelism)))
                     {
                         return count;
                     }
@@ -52,6 +52,14 @@ namespace ngraph
                 Eigen::ThreadPool global_thread_pool(GetNumCores());
                 Eigen::ThreadPoolDevice global_thread_pool_device(&global_thread_pool,
                                                                   global_thread_pool.NumThreads());
+                // A device limited to one thread never dispatches to its pool
+                Eigen::ThreadPoolDevice global_serial_device(&global_thread_pool, 1);
+
+                LocalThreadPool::LocalThreadPool(int num_threads)
+                    : m_pool(num_threads)
+                    , m_device(&m_pool, num_threads)
+                {
+                }
             }
         }
     }
@@ -29,6 +29,19 @@ namespace ngraph
             {
                 extern Eigen::ThreadPool global_thread_pool;
                 extern Eigen::ThreadPoolDevice global_thread_pool_device;
+                // Evaluates kernels on the calling thread
+                extern Eigen::ThreadPoolDevice global_serial_device;
+
+                // Thread pool owned by a single backend instance
+                class LocalThreadPool
+                {
+                public:
+                    LocalThreadPool(int num_threads);
+                    Eigen::ThreadPoolDevice& get_device() { return m_device; }
+                private:
+                    Eigen::ThreadPool m_pool;
+                    Eigen::ThreadPoolDevice m_device;
+                };
             }
         }
     }
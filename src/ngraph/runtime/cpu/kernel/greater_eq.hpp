@@ -30,7 +30,11 @@ namespace ngraph
             namespace kernel
             {
                 template <typename ElementType>
-                void greater_eq(void* input0, void* input1, void* output, size_t count)
+                void greater_eq(void* input0,
+                                void* input1,
+                                void* output,
+                                size_t count,
+                                const Eigen::ThreadPoolDevice& device)
                 {
                     Eigen::array<Eigen::Index, 1> out_dims, in_dims;
 
@@ -43,8 +47,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
-                        (in0 >= in1).template cast<char>();
+                    out.device(device) = (in0 >= in1).template cast<char>();
                 }
             }
         }
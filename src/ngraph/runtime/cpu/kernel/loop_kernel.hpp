@@ -0,0 +1,215 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                enum class LoopKernelOpcode
+                {
+                    Abs,
+                    Acos,
+                    Add,
+                    Asin,
+                    Atan,
+                    Ceiling,
+                    Cos,
+                    Cosh,
+                    Divide,
+                    Exp,
+                    Floor,
+                    Log,
+                    Maximum,
+                    Minimum,
+                    Multiply,
+                    Negative,
+                    Power,
+                    Relu,
+                    Sigmoid,
+                    Sign,
+                    Sin,
+                    Sinh,
+                    Sqrt,
+                    Subtract,
+                    Tan,
+                    Tanh
+                };
+
+                // One node of a loop kernel. Slots below the number of buffers
+                // are the kernel's input and output tensors, the rest are
+                // temporaries that only live for one block of elements.
+                struct LoopKernelStep
+                {
+                    LoopKernelOpcode opcode;
+                    size_t arg0_slot;
+                    size_t arg1_slot;
+                    size_t out_slot;
+                };
+
+                struct LoopKernelProgram
+                {
+                    std::vector<LoopKernelStep> steps;
+                    // Runtime context buffer index of each tensor slot
+                    std::vector<size_t> buffer_indices;
+                    size_t slot_count;
+                };
+
+                // Elements evaluated by every step before moving on to the next
+                // one, small enough for all temporaries of a block to stay in L1
+                static constexpr size_t loop_kernel_block_size = 1024;
+
+                // Evaluates one node over a block with the same Eigen expression
+                // as its standalone kernel, so fused and unfused results match
+                template <typename ElementType>
+                void loop_kernel_step(const LoopKernelStep& step,
+                                      ElementType* const* slots,
+                                      size_t count)
+                {
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(
+                        slots[step.out_slot], dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
+                        slots[step.arg0_slot], dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
+                        slots[step.arg1_slot], dims);
+
+                    switch (step.opcode)
+                    {
+                    case LoopKernelOpcode::Abs: out = in0.abs(); break;
+                    case LoopKernelOpcode::Acos:
+                        out = in0.unaryExpr(Eigen::internal::scalar_acos_op<ElementType>());
+                        break;
+                    case LoopKernelOpcode::Add: out = in0 + in1; break;
+                    case LoopKernelOpcode::Asin:
+                        out = in0.unaryExpr(Eigen::internal::scalar_asin_op<ElementType>());
+                        break;
+                    case LoopKernelOpcode::Atan:
+                        out = in0.unaryExpr(Eigen::internal::scalar_atan_op<ElementType>());
+                        break;
+                    case LoopKernelOpcode::Ceiling: out = in0.ceil(); break;
+                    case LoopKernelOpcode::Cos:
+                        out = in0.unaryExpr(Eigen::internal::scalar_cos_op<ElementType>());
+                        break;
+                    case LoopKernelOpcode::Cosh:
+                        out = in0.unaryExpr(Eigen::internal::scalar_cosh_op<ElementType>());
+                        break;
+                    case LoopKernelOpcode::Divide: out = in0 / in1; break;
+                    case LoopKernelOpcode::Exp: out = in0.exp(); break;
+                    case LoopKernelOpcode::Floor: out = in0.floor(); break;
+                    case LoopKernelOpcode::Log: out = in0.log(); break;
+                    case LoopKernelOpcode::Maximum: out = in0.cwiseMax(in1); break;
+                    case LoopKernelOpcode::Minimum: out = in0.cwiseMin(in1); break;
+                    case LoopKernelOpcode::Multiply: out = in0 * in1; break;
+                    case LoopKernelOpcode::Negative: out = -in0; break;
+                    case LoopKernelOpcode::Power:
+                        out = in0.binaryExpr(
+                            in1, Eigen::internal::scalar_pow_op<ElementType, ElementType>());
+                        break;
+                    case LoopKernelOpcode::Relu: out = in0.cwiseMax(ElementType(0)); break;
+                    case LoopKernelOpcode::Sigmoid: out = in0.sigmoid(); break;
+                    case LoopKernelOpcode::Sign: out = in0.sign(); break;
+                    case LoopKernelOpcode::Sin:
+                        out = in0.unaryExpr(Eigen::internal::scalar_sin_op<ElementType>());
+                        break;
+                    case LoopKernelOpcode::Sinh:
+                        out = in0.unaryExpr(Eigen::internal::scalar_sinh_op<ElementType>());
+                        break;
+                    case LoopKernelOpcode::Sqrt: out = in0.sqrt(); break;
+                    case LoopKernelOpcode::Subtract: out = in0 - in1; break;
+                    case LoopKernelOpcode::Tan:
+                        out = in0.unaryExpr(Eigen::internal::scalar_tan_op<ElementType>());
+                        break;
+                    case LoopKernelOpcode::Tanh: out = in0.tanh(); break;
+                    }
+                }
+
+                // Evaluates all steps of the program one block of elements at a
+                // time so every input is read and every output written exactly
+                // once. Blocks are distributed over the device's threads.
+                template <typename ElementType>
+                void loop_kernel(const LoopKernelProgram& program,
+                                 void** buffer_data,
+                                 size_t count,
+                                 const Eigen::ThreadPoolDevice& device)
+                {
+                    size_t buffer_count = program.buffer_indices.size();
+                    size_t temp_count = program.slot_count - buffer_count;
+                    size_t block_count =
+                        (count + loop_kernel_block_size - 1) / loop_kernel_block_size;
+
+                    auto evaluate_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                        // Per-thread scratch, reused across calls
+                        static thread_local std::vector<ElementType> temps;
+                        static thread_local std::vector<ElementType*> slots;
+                        temps.resize(std::max(temps.size(), temp_count * loop_kernel_block_size));
+                        slots.resize(program.slot_count);
+
+                        for (Eigen::Index block = first; block < last; block++)
+                        {
+                            size_t offset = block * loop_kernel_block_size;
+                            size_t block_elements =
+                                std::min(loop_kernel_block_size, count - offset);
+                            for (size_t i = 0; i < buffer_count; i++)
+                            {
+                                slots[i] =
+                                    static_cast<ElementType*>(
+                                        buffer_data[program.buffer_indices[i]]) +
+                                    offset;
+                            }
+                            for (size_t i = 0; i < temp_count; i++)
+                            {
+                                slots[buffer_count + i] =
+                                    temps.data() + i * loop_kernel_block_size;
+                            }
+                            for (auto& step : program.steps)
+                            {
+                                loop_kernel_step(step, slots.data(), block_elements);
+                            }
+                        }
+                    };
+
+                    if (block_count <= 1 || device.numThreads() <= 1)
+                    {
+                        evaluate_blocks(0, block_count);
+                        return;
+                    }
+
+                    double bytes_per_block = static_cast<double>(buffer_count) *
+                                             loop_kernel_block_size * sizeof(ElementType);
+                    Eigen::TensorOpCost cost(bytes_per_block,
+                                             0,
+                                             static_cast<double>(program.steps.size()) *
+                                                 loop_kernel_block_size);
+                    device.parallelFor(block_count, cost, evaluate_blocks);
+                }
+            }
+        }
+    }
+}
@@ -29,7 +29,11 @@ namespace ngraph
         {
             namespace kernel
             {
-                void logical_or(void* input0, void* input1, void* output, size_t count)
+                void logical_or(void* input0,
+                                void* input1,
+                                void* output,
+                                size_t count,
+                                const Eigen::ThreadPoolDevice& device)
                 {
                     Eigen::array<Eigen::Index, 1> out_dims, in_dims;
 
@@ -42,8 +46,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<char, 1, Eigen::RowMajor>> in1(
                         static_cast<char*>(input1), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
-                        (in0 || in1).template cast<char>();
+                    out.device(device) = (in0 || in1).template cast<char>();
                 }
             }
         }
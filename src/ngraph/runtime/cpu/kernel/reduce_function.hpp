@@ -20,10 +20,9 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/axis_set.hpp"
-#include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
-#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/scalar_function.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -35,6 +34,8 @@ namespace ngraph
         {
             namespace kernel
             {
+                // Eigen reducer that combines values with a nested function. The function's
+                // call frame is not thread safe, so reductions using it run on one thread.
                 template <typename ElementType>
                 struct Reducer
                 {
@@ -42,33 +43,9 @@ namespace ngraph
                     static const bool IsStateful = false;
 
                     ElementType initial;
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function;
-                    std::shared_ptr<Backend> backend;
+                    ScalarFunction<ElementType>* function;
 
-                    Reducer(ElementType x, const std::shared_ptr<CPU_ExternalFunction>& ef)
-                        : initial(x)
-                        , external_function(ef)
-                        , backend(runtime::Backend::create("CPU"))
-                    {
-                    }
-
-                    void reduce(const ElementType v, ElementType* R)
-                    {
-                        TensorViewPtrs inputs, outputs;
-                        ElementType p __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = v;
-                        ElementType q __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = *R;
-                        ElementType r __attribute__((aligned(NGRAPH_CPU_ALIGNMENT)));
-
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &p));
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &q));
-                        outputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &r));
-                        auto call_frame = external_function->make_call_frame();
-                        call_frame->call(outputs, inputs);
-                        *R = r;
-                    }
+                    void reduce(const ElementType v, ElementType* R) { *R = (*function)(v, *R); }
                     ElementType initialize() const { return initial; }
                     ElementType finalize(const ElementType R) const { return R; }
                 };
@@ -80,6 +57,7 @@ namespace ngraph
                                      const Shape& input_shape,
                                      const Shape& output_shape,
                                      const AxisSet& reduction_axes,
+                                     ScalarOp scalar_op,
                                      const std::shared_ptr<CPU_ExternalFunction>& external_function)
                 {
                     Eigen::array<Eigen::Index, Rank> in_dims;
@@ -107,10 +85,36 @@ namespace ngraph
                         out(static_cast<ElementType*>(output), out_dims);
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
                         static_cast<ElementType*>(input0), in_dims);
-                    Reducer<ElementType> reducer(*static_cast<ElementType*>(input1),
-                                                 external_function);
-                    out.device(eigen::global_thread_pool_device) =
-                        in.reduce(reduction_dims, reducer);
+                    ElementType initial = *static_cast<ElementType*>(input1);
+
+                    // Reducers that are a single op use Eigen's own reductions, with the initial
+                    // value folded in once per output element. Booleans are 0 or 1, so And and
+                    // Or are the minimum and maximum.
+                    auto& device = eigen::global_thread_pool_device;
+                    switch (scalar_op)
+                    {
+                    case ScalarOp::Add:
+                        out.device(device) = in.sum(reduction_dims) + initial;
+                        break;
+                    case ScalarOp::Multiply:
+                        out.device(device) = in.prod(reduction_dims) * initial;
+                        break;
+                    case ScalarOp::Maximum:
+                    case ScalarOp::Or:
+                        out.device(device) = in.maximum(reduction_dims).cwiseMax(initial);
+                        break;
+                    case ScalarOp::Minimum:
+                    case ScalarOp::And:
+                        out.device(device) = in.minimum(reduction_dims).cwiseMin(initial);
+                        break;
+                    default:
+                    {
+                        ScalarFunction<ElementType> function(external_function);
+                        Reducer<ElementType> reducer{initial, &function};
+                        out.device(eigen::global_serial_device) =
+                            in.reduce(reduction_dims, reducer);
+                    }
+                    }
                 }
 
                 template <typename ElementType, unsigned int Rank>
@@ -121,6 +125,7 @@ namespace ngraph
                     const Shape& input_shape,
                     const Shape& output_shape,
                     const AxisSet& reduction_axes,
+                    ScalarOp scalar_op,
                     const std::shared_ptr<CPU_ExternalFunction>& external_function)
                 {
                     reduce_function<ElementType, Rank, 1>(input0,
@@ -129,6 +134,7 @@ namespace ngraph
                                                           input_shape,
                                                           output_shape,
                                                           reduction_axes,
+                                                          scalar_op,
                                                           external_function);
                 }
 
@@ -140,6 +146,7 @@ namespace ngraph
                     const Shape& input_shape,
                     const Shape& output_shape,
                     const AxisSet& reduction_axes,
+                    ScalarOp scalar_op,
                     const std::shared_ptr<CPU_ExternalFunction>& external_function)
                 {
                     reduce_function<ElementType, 2, 2>(input0,
@@ -148,6 +155,7 @@ namespace ngraph
                                                        input_shape,
                                                        output_shape,
                                                        reduction_axes,
+                                                       scalar_op,
                                                        external_function);
                 }
 
@@ -159,6 +167,7 @@ namespace ngraph
                     const Shape& input_shape,
                     const Shape& output_shape,
                     const AxisSet& reduction_axes,
+                    ScalarOp scalar_op,
                     const std::shared_ptr<CPU_ExternalFunction>& external_function)
                 {
                     reduce_function<ElementType, 3, 2>(input0,
@@ -167,6 +176,7 @@ namespace ngraph
                                                        input_shape,
                                                        output_shape,
                                                        reduction_axes,
+                                                       scalar_op,
                                                        external_function);
                 }
             }
@@ -16,10 +16,11 @@
 
 #pragma once
 
-#include "ngraph/runtime/backend.hpp"
-#include "ngraph/runtime/cpu/cpu_external_function.hpp"
-#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include <functional>
+#include <memory>
 
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/kernel/scalar_function.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 
 namespace ngraph
@@ -39,29 +40,19 @@ namespace ngraph
                     const Shape& output_shape,
                     const Shape& window_shape,
                     const Strides& window_movement_strides,
+                    ScalarOp scalar_op,
                     const std::shared_ptr<CPU_ExternalFunction>& external_function)
                 {
-                    auto backend = runtime::Backend::create("CPU");
-
-                    auto reducer = [&](ElementType a, ElementType b) {
-                        TensorViewPtrs inputs, outputs;
-
-                        ElementType p __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = a;
-                        ElementType q __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = b;
-                        ElementType r __attribute__((aligned(NGRAPH_CPU_ALIGNMENT)));
-
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &p));
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &q));
-                        outputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &r));
-
-                        auto call_frame = external_function->make_call_frame();
-                        call_frame->call(outputs, inputs);
-
-                        return r;
-                    };
+                    std::function<ElementType(ElementType, ElementType)> reducer =
+                        get_scalar_combiner<ElementType>(scalar_op);
+                    std::unique_ptr<ScalarFunction<ElementType>> function;
+                    if (!reducer)
+                    {
+                        function.reset(new ScalarFunction<ElementType>(external_function));
+                        reducer = [&function](ElementType a, ElementType b) {
+                            return (*function)(a, b);
+                        };
+                    }
 
                     reference::reduce_window<ElementType>(static_cast<const ElementType*>(input0),
                                                           static_cast<const ElementType*>(input1),
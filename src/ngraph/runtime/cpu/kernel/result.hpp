@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -25,7 +27,10 @@ namespace ngraph
             namespace kernel
             {
                 template <typename ElementType>
-                void result(const void* arg, void* out, size_t count)
+                void result(const void* arg,
+                            void* out,
+                            size_t count,
+                            const Eigen::ThreadPoolDevice& device)
                 {
                     if (arg != out)
                     {
@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/and.hpp"
+#include "ngraph/op/greater.hpp"
+#include "ngraph/op/greater_eq.hpp"
+#include "ngraph/op/less.hpp"
+#include "ngraph/op/less_eq.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/or.hpp"
+#include "ngraph/runtime/cpu/kernel/scalar_function.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+runtime::cpu::kernel::ScalarOp
+    runtime::cpu::kernel::get_scalar_op(const shared_ptr<Function>& function)
+{
+    static const unordered_map<type_index, ScalarOp> commutative_ops{
+        {TI(op::Add), ScalarOp::Add},
+        {TI(op::Multiply), ScalarOp::Multiply},
+        {TI(op::Maximum), ScalarOp::Maximum},
+        {TI(op::Minimum), ScalarOp::Minimum},
+        {TI(op::And), ScalarOp::And},
+        {TI(op::Or), ScalarOp::Or}};
+    static const unordered_map<type_index, ScalarOp> ordered_ops{
+        {TI(op::Greater), ScalarOp::Greater},
+        {TI(op::GreaterEq), ScalarOp::GreaterEq},
+        {TI(op::Less), ScalarOp::Less},
+        {TI(op::LessEq), ScalarOp::LessEq}};
+
+    auto& params = function->get_parameters();
+    if (params.size() != 2 || function->get_output_size() != 1)
+    {
+        return ScalarOp::None;
+    }
+    auto node = function->get_output_op(0)->get_argument(0);
+    auto args = node->get_arguments();
+    if (args.size() != 2)
+    {
+        return ScalarOp::None;
+    }
+
+    const Node& n = *node;
+    if (args[0] == params[0] && args[1] == params[1])
+    {
+        auto it = ordered_ops.find(TI(n));
+        if (it != ordered_ops.end())
+        {
+            return it->second;
+        }
+    }
+    if ((args[0] == params[0] && args[1] == params[1]) ||
+        (args[0] == params[1] && args[1] == params[0]))
+    {
+        auto it = commutative_ops.find(TI(n));
+        if (it != commutative_ops.end())
+        {
+            return it->second;
+        }
+    }
+    return ScalarOp::None;
+}
@@ -0,0 +1,146 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // The op computed by a function of two scalars, such as the reducer of a
+                // Reduce, when it can be evaluated without calling the function
+                enum class ScalarOp
+                {
+                    None,
+                    Add,
+                    Multiply,
+                    Maximum,
+                    Minimum,
+                    And,
+                    Or,
+                    Greater,
+                    GreaterEq,
+                    Less,
+                    LessEq
+                };
+
+                // Returns the op if the function's result is that op applied to its first
+                // and second parameters (in either order when the op is commutative), and
+                // ScalarOp::None otherwise
+                ScalarOp get_scalar_op(const std::shared_ptr<Function>& function);
+
+                // Evaluates a function of two scalars on one call frame and one set of
+                // argument buffers that are reused for every call, so calls do not allocate.
+                // An instance must only be used by one thread at a time.
+                template <typename ElementType, typename ResultType = ElementType>
+                class ScalarFunction
+                {
+                public:
+                    ScalarFunction(const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                        : m_call_frame(external_function->make_call_frame())
+                        , m_inputs{&m_arg0, &m_arg1}
+                        , m_outputs{&m_result}
+                    {
+                    }
+                    ScalarFunction(const ScalarFunction&) = delete;
+                    ScalarFunction& operator=(const ScalarFunction&) = delete;
+
+                    ResultType operator()(ElementType a, ElementType b)
+                    {
+                        m_arg0 = a;
+                        m_arg1 = b;
+                        m_call_frame->call(m_outputs, m_inputs);
+                        return m_result;
+                    }
+
+                private:
+                    std::shared_ptr<CPU_CallFrame> m_call_frame;
+                    ElementType m_arg0 __attribute__((aligned(NGRAPH_CPU_ALIGNMENT)));
+                    ElementType m_arg1 __attribute__((aligned(NGRAPH_CPU_ALIGNMENT)));
+                    ResultType m_result __attribute__((aligned(NGRAPH_CPU_ALIGNMENT)));
+                    std::vector<void*> m_inputs;
+                    std::vector<void*> m_outputs;
+                };
+
+                // Returns a callable for a commutative ScalarOp that combines two values
+                template <typename ElementType>
+                std::function<ElementType(ElementType, ElementType)>
+                    get_scalar_combiner(ScalarOp op)
+                {
+                    switch (op)
+                    {
+                    case ScalarOp::Add:
+                        return [](ElementType a, ElementType b) { return a + b; };
+                    case ScalarOp::Multiply:
+                        return [](ElementType a, ElementType b) { return a * b; };
+                    case ScalarOp::Maximum:
+                        return [](ElementType a, ElementType b) { return a > b ? a : b; };
+                    case ScalarOp::Minimum:
+                        return [](ElementType a, ElementType b) { return a < b ? a : b; };
+                    case ScalarOp::And:
+                        return [](ElementType a, ElementType b) {
+                            return static_cast<ElementType>(a && b);
+                        };
+                    case ScalarOp::Or:
+                        return [](ElementType a, ElementType b) {
+                            return static_cast<ElementType>(a || b);
+                        };
+                    default: return nullptr;
+                    }
+                }
+
+                // Returns a callable for a comparison ScalarOp
+                template <typename ElementType>
+                std::function<char(ElementType, ElementType)> get_scalar_comparison(ScalarOp op)
+                {
+                    switch (op)
+                    {
+                    case ScalarOp::Greater:
+                        return [](ElementType a, ElementType b) {
+                            return static_cast<char>(a > b);
+                        };
+                    case ScalarOp::GreaterEq:
+                        return [](ElementType a, ElementType b) {
+                            return static_cast<char>(a >= b);
+                        };
+                    case ScalarOp::Less:
+                        return [](ElementType a, ElementType b) {
+                            return static_cast<char>(a < b);
+                        };
+                    case ScalarOp::LessEq:
+                        return [](ElementType a, ElementType b) {
+                            return static_cast<char>(a <= b);
+                        };
+                    default: return nullptr;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -32,6 +32,7 @@
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/type/element_type.hpp"
 
 #include "mkldnn_utils.hpp"
@@ -71,6 +72,7 @@ std::map<element::Type, const mkldnn::memory::data_type>&
     // Mapping from POD types to MKLDNN data types
     static std::map<element::Type, const mkldnn::memory::data_type> s_mkldnn_data_type_map = {
         {element::boolean, mkldnn::memory::data_type::s8},
+        {element::bf16, mkldnn::memory::data_type::data_undef},
         {element::f32, mkldnn::memory::data_type::f32},
         {element::f64, mkldnn::memory::data_type::data_undef},
         {element::i8, mkldnn::memory::data_type::s8},
@@ -90,6 +92,7 @@ std::map<element::Type, const std::string>&
 {
     static std::map<element::Type, const std::string> s_mkldnn_data_type_string_map{
         {element::boolean, "mkldnn::memory::data_type::s8"},
+        {element::bf16, "mkldnn::memory::data_type::data_undef"},
         {element::f32, "mkldnn::memory::data_type::f32"},
         {element::f64, "mkldnn::memory::data_type::data_undef"},
         {element::i8, "mkldnn::memory::data_type::s8"},
@@ -251,6 +254,35 @@ const mkldnn::memory::desc& runtime::cpu::mkldnn_utils::get_output_mkldnn_md(con
     return dynamic_cast<runtime::cpu::LayoutDescriptor&>(*tvl).get_mkldnn_md();
 }
 
+mkldnn::memory::desc runtime::cpu::mkldnn_utils::get_convert_layout_input_md(const Node* node)
+{
+    auto input_desc = get_input_mkldnn_md(node, 0);
+    auto& result_desc = get_output_mkldnn_md(node, 0);
+
+    // Special case for nchw(oihw) to goihw/Goihw16g/Goihw8g for GroupConvolution's weights
+    if (input_desc.data.format == mkldnn_nchw && result_desc.data.format == mkldnn_goihw)
+    {
+        //becomes a copy
+        input_desc = result_desc;
+    }
+    else if (input_desc.data.format == mkldnn_nchw && input_desc.data.ndims == 4 /*nchw*/ &&
+             result_desc.data.ndims == 5 /*Goihw16g/Goihw8g/etc*/ &&
+             node->get_users().size() == 1)
+    {
+        auto gconv =
+            std::dynamic_pointer_cast<ngraph::op::GroupConvolution>(*(begin(node->get_users())));
+        if (gconv)
+        {
+            Shape weights_shape_groups = gconv->get_weights_dimensions();
+            input_desc = mkldnn::memory::desc(
+                mkldnn::memory::dims(weights_shape_groups.begin(), weights_shape_groups.end()),
+                get_mkldnn_data_type(node->get_input_element_type(0)),
+                mkldnn::memory::format::goihw);
+        }
+    }
+    return input_desc;
+}
+
 mkldnn::memory::desc runtime::cpu::mkldnn_utils::create_default_mkldnn_md(
     const Node* node,
     size_t index,
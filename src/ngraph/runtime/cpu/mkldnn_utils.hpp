@@ -43,6 +43,8 @@ namespace ngraph
 
                 const mkldnn::memory::desc& get_input_mkldnn_md(const Node* node, size_t index);
                 const mkldnn::memory::desc& get_output_mkldnn_md(const Node* node, size_t index);
+                // Source descriptor for the reorder performed by a ConvertLayout
+                mkldnn::memory::desc get_convert_layout_input_md(const Node* node);
 
                 mkldnn::memory::desc create_default_mkldnn_md(const Node* node,
                                                               size_t index,
@@ -14,9 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <unordered_map>
+
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/get_output_element.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -79,6 +82,45 @@ ngraph::runtime::cpu::op::LoopKernel::LoopKernel(const NodeVector& node_list,
         }
     }
 
+    // GetOutputElements are transparent, both for the kernel's arguments and for
+    // the arguments of the nodes inside it
+    auto source_output = [](const descriptor::Output* output) {
+        while (auto goe =
+                   std::dynamic_pointer_cast<ngraph::op::GetOutputElement>(output->get_node()))
+        {
+            output = &goe->get_inputs().at(goe->get_n()).get_output();
+        }
+        return output;
+    };
+
+    std::unordered_map<const descriptor::Output*, size_t> sources;
+    for (size_t i = 0; i < node_list.size(); i++)
+    {
+        for (auto& output : node_list.at(i)->get_outputs())
+        {
+            sources.insert(std::make_pair(&output, get_input_size() + i));
+        }
+    }
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        sources.insert(std::make_pair(source_output(&get_inputs().at(i).get_output()), i));
+    }
+    for (auto n : node_list)
+    {
+        std::vector<size_t> node_sources;
+        for (auto& input : n->get_inputs())
+        {
+            auto it = sources.find(source_output(&input.get_output()));
+            if (it == sources.end())
+            {
+                throw ngraph_error(n->get_name() + " has an argument that isn't an input of " +
+                                   get_name());
+            }
+            node_sources.push_back(it->second);
+        }
+        m_input_sources.push_back(node_sources);
+    }
+
     for (size_t i = 0; i < outputs.size(); ++i)
     {
         auto& o = outputs.at(i);
@@ -40,9 +40,20 @@ namespace ngraph
 
                     const NodeVector& get_node_list() const { return m_node_list; }
                     const NodeVector& get_kernel_outputs() const { return m_output_nodes; }
+                    /// \brief Sources of the inputs of each node in node_list, in node_list order.
+                    ///
+                    /// A source below get_input_size() is an input of the kernel, any other source
+                    /// s is the output of node_list[s - get_input_size()]. The mapping is fixed at
+                    /// construction so it survives passes that later rewire the kernel's inputs.
+                    const std::vector<std::vector<size_t>>& get_input_sources() const
+                    {
+                        return m_input_sources;
+                    }
+
                 private:
                     NodeVector m_node_list;
                     NodeVector m_output_nodes;
+                    std::vector<std::vector<size_t>> m_input_sources;
                 };
             }
         }
@@ -22,13 +22,32 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/abs.hpp"
+#include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/asin.hpp"
+#include "ngraph/op/atan.hpp"
+#include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/cos.hpp"
+#include "ngraph/op/cosh.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/floor.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/log.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
+#include "ngraph/op/power.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sign.hpp"
+#include "ngraph/op/sin.hpp"
+#include "ngraph/op/sinh.hpp"
+#include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tan.hpp"
+#include "ngraph/op/tanh.hpp"
 #include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
 #include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
@@ -56,6 +75,7 @@ public:
     {
         for (auto n : f->get_ordered_ops())
         {
+            m_positions.insert(std::make_pair(n, m_positions.size()));
             if (is_fusible(n))
             {
                 auto arg_from_fusible_group = collect_fusible_args(n);
@@ -63,7 +83,8 @@ public:
                 if (!arg_from_fusible_group)
                 {
                     m_heads.insert(std::make_pair(n, n));
-                    m_graphs.insert(std::make_pair(n, LKGraph{{n}, n->get_arguments()}));
+                    m_graphs.insert(std::make_pair(n, LKGraph{{n}, {}}));
+                    add_inputs(m_graphs.at(n), n);
                     NGRAPH_DEBUG << "Created a new group for " << n->get_name();
                     log_group(n);
                 }
@@ -72,13 +93,7 @@ public:
                     auto smallest_head = m_heads.at(arg_from_fusible_group);
                     auto& lkgraph = m_graphs.at(smallest_head);
                     lkgraph.m_nodes.push_back(n);
-                    for (auto arg : n->get_arguments())
-                    {
-                        if (is_leaf(arg))
-                        {
-                            lkgraph.m_inputs.push_back(arg);
-                        }
-                    }
+                    add_inputs(lkgraph, n);
                     m_heads.insert(std::make_pair(n, smallest_head));
                     log_group(smallest_head);
                 }
@@ -94,7 +109,16 @@ public:
         for (auto e : m_graphs)
         {
             auto& lkg = e.second;
-            NodeVector member_outputs = ngraph::get_subgraph_outputs(lkg.m_nodes, NodeVector{});
+            NodeVector member_outputs;
+            for (auto output : ngraph::get_subgraph_outputs(lkg.m_nodes, NodeVector{}))
+            {
+                // a node with several external users is listed once per user
+                if (std::find(member_outputs.begin(), member_outputs.end(), output) ==
+                    member_outputs.end())
+                {
+                    member_outputs.push_back(output);
+                }
+            }
             auto lk = std::make_shared<runtime::cpu::op::LoopKernel>(
                 lkg.m_nodes, member_outputs, lkg.m_inputs);
             lks.push_back(lk);
@@ -105,22 +129,54 @@ public:
 private:
     static bool is_fusible(std::shared_ptr<Node> n)
     {
+        // Softmax, LRN and StopGradient derive from the elementwise arithmetic
+        // base classes but aren't pointwise computations
         static const std::set<std::type_index> fusible_ops_set{TI(ngraph::op::Abs),
+                                                               TI(ngraph::op::Acos),
                                                                TI(ngraph::op::Add),
+                                                               TI(ngraph::op::Asin),
+                                                               TI(ngraph::op::Atan),
+                                                               TI(ngraph::op::Ceiling),
+                                                               TI(ngraph::op::Cos),
+                                                               TI(ngraph::op::Cosh),
+                                                               TI(ngraph::op::Divide),
+                                                               TI(ngraph::op::Exp),
+                                                               TI(ngraph::op::Floor),
+                                                               TI(ngraph::op::Log),
+                                                               TI(ngraph::op::Maximum),
+                                                               TI(ngraph::op::Minimum),
+                                                               TI(ngraph::op::Multiply),
                                                                TI(ngraph::op::Negative),
-                                                               TI(ngraph::op::Subtract),
+                                                               TI(ngraph::op::Power),
                                                                TI(ngraph::op::Relu),
-                                                               TI(ngraph::op::Minimum),
-                                                               TI(ngraph::op::Maximum)};
+                                                               TI(ngraph::op::Sigmoid),
+                                                               TI(ngraph::op::Sign),
+                                                               TI(ngraph::op::Sin),
+                                                               TI(ngraph::op::Sinh),
+                                                               TI(ngraph::op::Sqrt),
+                                                               TI(ngraph::op::Subtract),
+                                                               TI(ngraph::op::Tan),
+                                                               TI(ngraph::op::Tanh)};
 
         const Node& node = *n;
         return fusible_ops_set.count(TI(node)) != 0;
-
-        // return (std::dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(n) ||
-        //         std::dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(n));
     }
 
     bool is_leaf(std::shared_ptr<Node> src) { return src->is_parameter() || src->is_constant(); }
+    // Arguments of n computed outside of its group become inputs of the loop kernel
+    void add_inputs(LKGraph& lkgraph, std::shared_ptr<Node> n)
+    {
+        for (auto arg : n->get_arguments())
+        {
+            if (std::find(lkgraph.m_nodes.begin(), lkgraph.m_nodes.end(), arg) ==
+                    lkgraph.m_nodes.end() &&
+                std::find(lkgraph.m_inputs.begin(), lkgraph.m_inputs.end(), arg) ==
+                    lkgraph.m_inputs.end())
+            {
+                lkgraph.m_inputs.push_back(arg);
+            }
+        }
+    }
     void prune_graphs(size_t min_nodes_to_fuse)
     {
         for (auto it = m_graphs.begin(); it != m_graphs.end();)
@@ -165,11 +221,31 @@ private:
                 }
             }
         }
+
+        // An argument from outside the group that was computed after the group
+        // started might depend on one of its members; fusing n would then
+        // create a cycle through the loop kernel
+        if (arg_from_fusible_group)
+        {
+            auto head = m_heads.at(arg_from_fusible_group);
+            for (auto arg : n->get_arguments())
+            {
+                if (is_leaf(arg) || (m_heads.count(arg) != 0 && m_heads.at(arg) == head))
+                {
+                    continue;
+                }
+                if (m_positions.at(arg) > m_positions.at(head))
+                {
+                    return {nullptr};
+                }
+            }
+        }
         return arg_from_fusible_group;
     }
 
     std::unordered_map<std::shared_ptr<Node>, LKGraph> m_graphs;
     std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<Node>> m_heads;
+    std::unordered_map<std::shared_ptr<Node>, size_t> m_positions;
 };
 
 bool ngraph::runtime::cpu::pass::CPULoopKernelFusion::run_on_function(
@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <vector>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_prepack_constants.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool runtime::cpu::pass::CPUPrepackConstants::run_on_function(
+    std::shared_ptr<ngraph::Function> function)
+{
+    bool replaced = false;
+    for (auto n : function->get_ordered_ops())
+    {
+        auto convert_layout = std::dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(n);
+        if (!convert_layout || convert_layout->get_users().empty())
+        {
+            continue;
+        }
+        auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(n->get_argument(0));
+        // Other consumers of the constant still expect its native layout
+        if (!constant || constant->get_outputs().at(0).get_inputs().size() != 1)
+        {
+            continue;
+        }
+
+        auto input_desc = mkldnn_utils::get_convert_layout_input_md(convert_layout.get());
+        auto result_desc = mkldnn_utils::get_output_mkldnn_md(convert_layout.get(), 0);
+        auto layout = convert_layout->get_output_tensor_ptr()->get_tensor_layout();
+
+        // Blocked layouts may be padded, so the buffer is sized by the layout
+        auto buffer = std::make_shared<runtime::AlignedBuffer>(
+            layout->get_allocated_size(), CPU_ExternalFunction::s_memory_pool_alignment);
+        try
+        {
+            mkldnn::memory input(
+                mkldnn::memory::primitive_desc(input_desc, mkldnn_utils::global_cpu_engine),
+                const_cast<void*>(constant->get_data_ptr()));
+            mkldnn::memory result(
+                mkldnn::memory::primitive_desc(result_desc, mkldnn_utils::global_cpu_engine),
+                buffer->get_ptr());
+            std::vector<mkldnn::primitive> reorder{mkldnn::reorder(input, result)};
+            mkldnn::stream(mkldnn::stream::kind::eager).submit(reorder).wait();
+        }
+        catch (const mkldnn::error& e)
+        {
+            throw ngraph_error("Could not reorder constant " + constant->get_name() + ": " +
+                               e.message);
+        }
+
+        // The packed constant views the reordered buffer, so once the original constant
+        // leaves the graph the function holds the weights in one layout only
+        auto packed = std::make_shared<ngraph::op::Constant>(
+            constant->get_element_type(), constant->get_shape(), buffer->get_ptr(), buffer);
+        packed->get_output_tensor_ptr()->set_tensor_layout(layout);
+        NGRAPH_DEBUG << "Prepacked " << constant->get_name() << " into the layout of "
+                     << convert_layout->get_name() << " as " << packed->get_name();
+        ngraph::replace_node(convert_layout, packed);
+        replaced = true;
+    }
+    return replaced;
+}
@@ -0,0 +1,347 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/runtime/cpu/op/dequantize.hpp"
+#include "ngraph/runtime/cpu/op/quantize.hpp"
+#include "ngraph/runtime/cpu/op/quantized_avg_pool.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/quantized_max_pool.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_quantization.hpp"
+#include "ngraph/runtime/cpu/quantization_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // An int8 tensor standing for the f32 tensor value * max_abs / target_range(type)
+    struct QuantizedTensor
+    {
+        shared_ptr<Node> node;
+        float max_abs;
+    };
+
+    using QuantizedTensors = unordered_map<shared_ptr<Node>, QuantizedTensor>;
+
+    float target_range(const element::Type& type) { return type.is_signed() ? 127.0f : 255.0f; }
+
+    shared_ptr<Node> f32_scalar(float value)
+    {
+        return op::Constant::create(element::f32, Shape{}, {value});
+    }
+
+    bool get_range(const runtime::cpu::QuantizationRanges& ranges,
+                   const shared_ptr<Node>& node,
+                   runtime::cpu::QuantizationRange& range)
+    {
+        auto it = ranges.find(node);
+        if (it == ranges.end() || it->second.min > it->second.max)
+        {
+            return false;
+        }
+        range = it->second;
+        return true;
+    }
+
+    // u8 data of a quantized convolution. f32 inputs are quantized once and the Quantize is
+    // shared by all the convolutions reading them.
+    bool get_u8_input(const shared_ptr<Node>& input,
+                      const runtime::cpu::QuantizationRanges& ranges,
+                      const QuantizedTensors& quantized,
+                      QuantizedTensors& quantized_inputs,
+                      QuantizedTensor& result)
+    {
+        auto it = quantized.find(input);
+        if (it != quantized.end())
+        {
+            result = it->second;
+            return result.node->get_element_type() == element::u8;
+        }
+        it = quantized_inputs.find(input);
+        if (it != quantized_inputs.end())
+        {
+            result = it->second;
+            return true;
+        }
+
+        runtime::cpu::QuantizationRange range;
+        if (input->get_element_type() != element::f32 || !get_range(ranges, input, range) ||
+            range.min < 0.0f)
+        {
+            return false;
+        }
+        // Use the range QuantizeCPU widens the calibrated one to
+        vector<float> quant_util;
+        runtime::cpu::quantization_util::get_min_max_range(0.0f, range.max, false, quant_util);
+        auto quantize = make_shared<op::QuantizeCPU>(
+            input, f32_scalar(0.0f), f32_scalar(range.max), element::u8);
+        result = {make_shared<op::GetOutputElement>(quantize, 0), quant_util[1]};
+        quantized_inputs[input] = result;
+        return true;
+    }
+
+    // Bias of conv + broadcast(bias) along the output channels
+    shared_ptr<op::Constant> match_bias(const shared_ptr<op::Convolution>& conv,
+                                        const shared_ptr<Node>& add)
+    {
+        auto other = add->get_argument(0) == conv ? add->get_argument(1) : add->get_argument(0);
+        auto broadcast = dynamic_pointer_cast<op::Broadcast>(other);
+        if (!broadcast || broadcast->get_broadcast_axes() != AxisSet{0, 2, 3})
+        {
+            return nullptr;
+        }
+        auto bias = dynamic_pointer_cast<op::Constant>(broadcast->get_argument(0));
+        if (!bias || bias->get_shape() != Shape{conv->get_shape().at(1)})
+        {
+            return nullptr;
+        }
+        return bias;
+    }
+
+    shared_ptr<Node> get_single_user(const shared_ptr<Node>& node)
+    {
+        auto users = node->get_users();
+        return users.size() == 1 ? users.at(0) : nullptr;
+    }
+}
+
+bool runtime::cpu::pass::CPUQuantization::run_on_function(shared_ptr<Function> function)
+{
+    // Dequantized results of the rewritten nodes, and the boundary inputs of the regions
+    QuantizedTensors quantized;
+    QuantizedTensors quantized_inputs;
+    auto replace_with_quantized = [&quantized](const shared_ptr<Node>& node,
+                                               const QuantizedTensor& value) {
+        auto type = value.node->get_element_type();
+        auto dequantize =
+            make_shared<op::DequantizeCPU>(value.node,
+                                           f32_scalar(type.is_signed() ? -value.max_abs : 0.0f),
+                                           f32_scalar(value.max_abs),
+                                           type);
+        NGRAPH_DEBUG << "Quantized " << node->get_name() << " to " << type;
+        replace_node(node, dequantize);
+        quantized[dequantize] = value;
+    };
+
+    bool replaced = false;
+    for (auto n : function->get_ordered_ops())
+    {
+        if (auto conv = dynamic_pointer_cast<op::Convolution>(n))
+        {
+            auto filters = dynamic_pointer_cast<op::Constant>(conv->get_argument(1));
+            QuantizedTensor input;
+            if (!filters || conv->get_element_type() != element::f32 ||
+                conv->get_shape().size() != 4 ||
+                conv->get_data_dilation_strides() != Strides{1, 1} ||
+                !get_u8_input(
+                    conv->get_argument(0), m_ranges, quantized, quantized_inputs, input))
+            {
+                continue;
+            }
+
+            shared_ptr<Node> last = conv;
+            shared_ptr<op::Constant> bias;
+            auto user = get_single_user(last);
+            if (user && dynamic_pointer_cast<op::Add>(user) && (bias = match_bias(conv, user)))
+            {
+                last = user;
+                user = get_single_user(last);
+            }
+            bool with_relu = user && dynamic_pointer_cast<op::Relu>(user);
+            if (with_relu)
+            {
+                last = user;
+            }
+
+            QuantizationRange output_range;
+            if (!get_range(m_ranges, last, output_range))
+            {
+                continue;
+            }
+            auto output_type = with_relu ? element::u8 : element::i8;
+            float output_max_abs = with_relu
+                                       ? output_range.max
+                                       : max(abs(output_range.min), abs(output_range.max));
+            if (output_max_abs <= 0.0f)
+            {
+                continue;
+            }
+
+            // Symmetric i8 filters, with the bounds widened so that the (max - min) / 255
+            // level of quantization_range_for_multiplication is the step of the filters
+            auto weights = filters->get_vector<float>();
+            float filter_max_abs = 0.0f;
+            for (auto w : weights)
+            {
+                filter_max_abs = max(filter_max_abs, abs(w));
+            }
+            if (filter_max_abs == 0.0f)
+            {
+                filter_max_abs = 1.0f;
+            }
+            float filter_step = filter_max_abs / 127.0f;
+            vector<int8_t> quantized_weights;
+            for (auto w : weights)
+            {
+                quantized_weights.push_back(static_cast<int8_t>(
+                    max(-127.0f, min(127.0f, static_cast<float>(round(w / filter_step))))));
+            }
+            float filter_bound = filter_step * 255.0f / 2.0f;
+
+            // The kernel scales the int32 accumulator by 2^-24 * max_abs32 / max_abs8 (see
+            // quantization_util::get_scale), so max_abs8 is chosen to map one accumulator level
+            // to its fraction of one output level
+            float min_acc;
+            float max_acc;
+            quantization_util::quantization_range_for_multiplication<uint8_t, int8_t, int32_t>(
+                0.0f, input.max_abs, -filter_bound, filter_bound, &min_acc, &max_acc);
+            float acc_step = input.max_abs / 255.0f * filter_step;
+            float max_abs32 = max(abs(min_acc), abs(max_acc));
+            float output_step = output_max_abs / target_range(output_type);
+            float max_abs8 =
+                static_cast<float>(pow(2, -24) * max_abs32 * output_step / acc_step);
+
+            auto quantized_filters =
+                make_shared<op::Constant>(element::i8, filters->get_shape(), quantized_weights);
+            auto min_input = f32_scalar(0.0f);
+            auto max_input = f32_scalar(input.max_abs);
+            auto min_filter = f32_scalar(-filter_bound);
+            auto max_filter = f32_scalar(filter_bound);
+            auto min_output = f32_scalar(with_relu ? 0.0f : -max_abs8);
+            auto max_output = f32_scalar(max_abs8);
+
+            shared_ptr<Node> qconv;
+            if (bias)
+            {
+                // The bias is added to the int32 accumulator
+                vector<int32_t> quantized_bias;
+                for (auto b : bias->get_vector<float>())
+                {
+                    quantized_bias.push_back(static_cast<int32_t>(round(b / acc_step)));
+                }
+                qconv = make_shared<op::QuantizedConvolutionBias>(
+                    input.node,
+                    quantized_filters,
+                    make_shared<op::Constant>(element::i32, bias->get_shape(), quantized_bias),
+                    conv->get_window_movement_strides(),
+                    conv->get_window_dilation_strides(),
+                    conv->get_padding_below(),
+                    conv->get_padding_above(),
+                    conv->get_data_dilation_strides(),
+                    min_input,
+                    max_input,
+                    min_filter,
+                    max_filter,
+                    min_output,
+                    max_output,
+                    with_relu);
+            }
+            else if (with_relu)
+            {
+                qconv = make_shared<op::QuantizedConvolutionRelu>(
+                    input.node,
+                    quantized_filters,
+                    conv->get_window_movement_strides(),
+                    conv->get_window_dilation_strides(),
+                    conv->get_padding_below(),
+                    conv->get_padding_above(),
+                    conv->get_data_dilation_strides(),
+                    min_input,
+                    max_input,
+                    min_filter,
+                    max_filter,
+                    min_output,
+                    max_output);
+            }
+            else
+            {
+                qconv = make_shared<op::QuantizedConvolution>(input.node,
+                                                              quantized_filters,
+                                                              conv->get_window_movement_strides(),
+                                                              conv->get_window_dilation_strides(),
+                                                              conv->get_padding_below(),
+                                                              conv->get_padding_above(),
+                                                              conv->get_data_dilation_strides(),
+                                                              min_input,
+                                                              max_input,
+                                                              min_filter,
+                                                              max_filter,
+                                                              min_output,
+                                                              max_output);
+            }
+            replace_with_quantized(last,
+                                   {make_shared<op::GetOutputElement>(qconv, 0), output_max_abs});
+            replaced = true;
+        }
+        else if (dynamic_pointer_cast<op::MaxPool>(n) || dynamic_pointer_cast<op::AvgPool>(n))
+        {
+            // Pooling keeps the range of its input, so it is only quantized inside a region
+            auto it = quantized.find(n->get_argument(0));
+            if (it == quantized.end())
+            {
+                continue;
+            }
+            auto input = it->second;
+            auto type = input.node->get_element_type();
+            auto min_range = f32_scalar(type.is_signed() ? -input.max_abs : 0.0f);
+            auto max_range = f32_scalar(input.max_abs);
+
+            shared_ptr<Node> qpool;
+            if (auto max_pool = dynamic_pointer_cast<op::MaxPool>(n))
+            {
+                qpool = make_shared<op::QuantizedMaxPool>(input.node,
+                                                          max_pool->get_window_shape(),
+                                                          max_pool->get_window_movement_strides(),
+                                                          max_pool->get_padding_below(),
+                                                          max_pool->get_padding_above(),
+                                                          min_range,
+                                                          max_range);
+            }
+            else
+            {
+                auto avg_pool = static_pointer_cast<op::AvgPool>(n);
+                qpool = make_shared<op::QuantizedAvgPool>(
+                    input.node,
+                    avg_pool->get_window_shape(),
+                    avg_pool->get_window_movement_strides(),
+                    avg_pool->get_padding_below(),
+                    avg_pool->get_padding_above(),
+                    avg_pool->get_include_padding_in_avg_computation(),
+                    min_range,
+                    max_range);
+            }
+            replace_with_quantized(n, {make_shared<op::GetOutputElement>(qpool, 0), input.max_abs});
+            replaced = true;
+        }
+    }
+    return replaced;
+}
@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/quantization_calibrator.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Rewrites f32 convolution and pooling chains into the quantized CPU ops.
+                ///
+                /// Convolutions with constant filters, optionally followed by a broadcast
+                /// constant bias and a Relu, become QuantizedConvolution,
+                /// QuantizedConvolutionRelu or QuantizedConvolutionBias with scales computed from
+                /// the calibrated ranges. Max and average pools whose input is already quantized
+                /// become QuantizedMaxPool and QuantizedAvgPool. Every rewritten node is replaced
+                /// by a DequantizeCPU of its int8 result, which later quantized ops consume
+                /// directly, so Quantize and Dequantize only remain at the region boundaries.
+                ///
+                /// The quantized convolutions take u8 data, so a region can only start at a
+                /// tensor whose calibrated minimum is not negative.
+                class CPUQuantization : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUQuantization(const QuantizationRanges& ranges)
+                        : m_ranges(ranges)
+                    {
+                    }
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                private:
+                    QuantizationRanges m_ranges;
+                };
+            }
+        }
+    }
+}
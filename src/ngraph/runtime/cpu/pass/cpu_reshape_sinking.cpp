@@ -27,12 +27,22 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/min.hpp"
+#include "ngraph/op/pad.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/sum.hpp"
 #include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/binary_elementwise_logical.hpp"
 #include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/util.hpp"
 
@@ -45,6 +55,18 @@ extern template ngraph::AxisVector
 extern template ngraph::Shape ngraph::apply_permutation<ngraph::Shape>(ngraph::Shape input,
                                                                        ngraph::AxisVector order);
 
+extern template ngraph::Coordinate
+    ngraph::apply_permutation<ngraph::Coordinate>(ngraph::Coordinate input,
+                                                  ngraph::AxisVector order);
+
+extern template ngraph::Strides
+    ngraph::apply_permutation<ngraph::Strides>(ngraph::Strides input, ngraph::AxisVector order);
+
+static bool is_default_order(std::shared_ptr<op::Reshape> reshape)
+{
+    return reshape->get_input_order() == ngraph::get_default_order(reshape->get_shape());
+}
+
 static std::shared_ptr<op::Reshape> combine_reshapes(std::shared_ptr<op::Reshape> r1,
                                                      std::shared_ptr<op::Reshape> r2)
 {
@@ -58,6 +80,11 @@ static std::shared_ptr<op::Reshape> combine_reshapes(std::shared_ptr<op::Reshape
 static void
     insert_reshape(std::shared_ptr<Node> target, std::shared_ptr<Node> reshape, size_t input_index)
 {
+    //pending reshapes are pure transposes, so a default order one is an identity
+    if (is_default_order(std::dynamic_pointer_cast<op::Reshape>(reshape)))
+    {
+        return;
+    }
     auto arg = target->get_inputs().at(input_index).get_output().get_node();
     auto new_reshape = reshape->copy_with_new_args({arg});
     target->get_inputs().at(input_index).replace_output(new_reshape->get_outputs().at(0));
@@ -98,6 +125,257 @@ static std::shared_ptr<op::Reshape> create_default_reshape(std::shared_ptr<Node>
     return default_reshape;
 }
 
+static void materialize_argument(
+    std::shared_ptr<Node> n,
+    size_t input_index,
+    std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<op::Reshape>>& reorders,
+    std::set<std::shared_ptr<Node>>& reshapes_to_delete)
+{
+    auto arg = n->get_argument(input_index);
+    if (reorders.count(arg) != 0)
+    {
+        NGRAPH_DEBUG << "Materializing " << describe_reshape(reorders.at(arg)) << " for "
+                     << arg->get_name();
+        mark_reshape_for_deletion(reorders.at(arg), reshapes_to_delete);
+        insert_reshape(n, reorders.at(arg), input_index);
+    }
+}
+
+static void materialize_arguments(
+    std::shared_ptr<Node> n,
+    std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<op::Reshape>>& reorders,
+    std::set<std::shared_ptr<Node>>& reshapes_to_delete)
+{
+    for (size_t i = 0; i < n->get_arguments().size(); i++)
+    {
+        materialize_argument(n, i, reorders, reshapes_to_delete);
+    }
+}
+
+//materializes the pending reshapes of all the arguments of n, which keeps its order
+static void flush_reshapes(
+    std::shared_ptr<Node> n,
+    std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<op::Reshape>>& reorders,
+    std::set<std::shared_ptr<Node>>& reshapes_to_delete)
+{
+    //no swimming up
+    materialize_arguments(n, reorders, reshapes_to_delete);
+    //multiple output nodes are dealt with by their GOEs
+    if (n->get_outputs().size() == 1)
+    {
+        reorders[n] = create_default_reshape(n);
+    }
+}
+
+//a Reshape can only be sunk or combined if it only permutes the axes of its argument
+static bool is_pure_transpose(std::shared_ptr<op::Reshape> reshape,
+                              std::shared_ptr<op::Reshape> arg_reshape)
+{
+    return reshape->get_is_transpose() &&
+           reshape->get_shape() ==
+               apply_permutation(arg_reshape->get_shape(), reshape->get_input_order());
+}
+
+//the shape an argument has once its pending reshape is deleted
+static Shape get_shape_in_default_order(std::shared_ptr<op::Reshape> arg_reshape)
+{
+    auto perm_to_def = ngraph::get_permutation_to_default_order(arg_reshape->get_input_order());
+    return apply_permutation(arg_reshape->get_shape(), perm_to_def);
+}
+
+//Ops that reshapes are sunk through are rebuilt on placeholders with the shapes their
+//arguments have once pending reshapes are deleted, since the arguments themselves still
+//have the old shapes, and are then connected to the arguments
+static std::shared_ptr<op::Parameter> create_placeholder(std::shared_ptr<Node> arg,
+                                                         std::shared_ptr<op::Reshape> arg_reshape)
+{
+    return std::make_shared<op::Parameter>(arg->get_element_type(),
+                                           get_shape_in_default_order(arg_reshape));
+}
+
+//replaces n with new_node and records the reshape that restores the order of n
+static void replace_with_sunk_node(
+    std::shared_ptr<Node> n,
+    std::shared_ptr<Node> new_node,
+    size_t placeholder_count,
+    const AxisVector& order,
+    std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<op::Reshape>>& reorders)
+{
+    for (size_t i = 0; i < placeholder_count; i++)
+    {
+        new_node->get_inputs().at(i).replace_output(n->get_inputs().at(i).get_output());
+    }
+    ngraph::replace_node(n, new_node);
+    reorders[new_node] = std::make_shared<op::Reshape>(new_node, order, n->get_shape());
+    NGRAPH_DEBUG << "Sinking " << describe_reshape(reorders.at(new_node)) << " below "
+                 << n->get_name();
+}
+
+static bool sink_pad(
+    std::shared_ptr<op::Pad> pad,
+    std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<op::Reshape>>& reorders,
+    std::set<std::shared_ptr<Node>>& reshapes_to_delete)
+{
+    auto arg_reshape = reorders.at(pad->get_argument(0));
+    if (is_default_order(arg_reshape))
+    {
+        return false;
+    }
+    auto perm_to_def = ngraph::get_permutation_to_default_order(arg_reshape->get_input_order());
+    materialize_argument(pad, 1, reorders, reshapes_to_delete);
+    auto new_pad =
+        std::make_shared<op::Pad>(create_placeholder(pad->get_argument(0), arg_reshape),
+                                  pad->get_argument(1),
+                                  apply_permutation(pad->get_padding_below(), perm_to_def),
+                                  apply_permutation(pad->get_padding_above(), perm_to_def),
+                                  apply_permutation(pad->get_padding_interior(), perm_to_def));
+    mark_reshape_for_deletion(arg_reshape, reshapes_to_delete);
+    replace_with_sunk_node(pad, new_pad, 1, arg_reshape->get_input_order(), reorders);
+    return true;
+}
+
+static bool sink_slice(
+    std::shared_ptr<op::Slice> slice,
+    std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<op::Reshape>>& reorders,
+    std::set<std::shared_ptr<Node>>& reshapes_to_delete)
+{
+    auto arg_reshape = reorders.at(slice->get_argument(0));
+    if (is_default_order(arg_reshape))
+    {
+        return false;
+    }
+    auto perm_to_def = ngraph::get_permutation_to_default_order(arg_reshape->get_input_order());
+    auto new_slice =
+        std::make_shared<op::Slice>(create_placeholder(slice->get_argument(0), arg_reshape),
+                                    apply_permutation(slice->get_lower_bounds(), perm_to_def),
+                                    apply_permutation(slice->get_upper_bounds(), perm_to_def),
+                                    apply_permutation(slice->get_strides(), perm_to_def));
+    mark_reshape_for_deletion(arg_reshape, reshapes_to_delete);
+    replace_with_sunk_node(slice, new_slice, 1, arg_reshape->get_input_order(), reorders);
+    return true;
+}
+
+//only sinks if all the arguments have the same non-default pending order
+static bool sink_concat(
+    std::shared_ptr<op::Concat> concat,
+    std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<op::Reshape>>& reorders,
+    std::set<std::shared_ptr<Node>>& reshapes_to_delete)
+{
+    auto first_reshape = reorders.at(concat->get_argument(0));
+    if (is_default_order(first_reshape))
+    {
+        return false;
+    }
+    auto order = first_reshape->get_input_order();
+    for (auto arg : concat->get_arguments())
+    {
+        if (reorders.at(arg)->get_input_order() != order)
+        {
+            return false;
+        }
+    }
+    NodeVector placeholders;
+    for (auto arg : concat->get_arguments())
+    {
+        placeholders.push_back(create_placeholder(arg, reorders.at(arg)));
+        mark_reshape_for_deletion(reorders.at(arg), reshapes_to_delete);
+    }
+    auto new_concat =
+        std::make_shared<op::Concat>(placeholders, order.at(concat->get_concatenation_axis()));
+    replace_with_sunk_node(concat, new_concat, placeholders.size(), order, reorders);
+    return true;
+}
+
+static bool sink_reduction(
+    std::shared_ptr<op::util::ArithmeticReduction> reduction,
+    std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<op::Reshape>>& reorders,
+    std::set<std::shared_ptr<Node>>& reshapes_to_delete)
+{
+    auto arg_reshape = reorders.at(reduction->get_argument(0));
+    if (is_default_order(arg_reshape))
+    {
+        return false;
+    }
+    auto order = arg_reshape->get_input_order();
+    AxisSet reduction_axes;
+    for (auto axis : reduction->get_reduction_axes())
+    {
+        reduction_axes.insert(order.at(axis));
+    }
+
+    //the position of each remaining axis in the output of the new reduction
+    std::vector<size_t> output_positions(order.size());
+    size_t position = 0;
+    for (size_t axis = 0; axis < order.size(); axis++)
+    {
+        if (reduction_axes.count(axis) == 0)
+        {
+            output_positions[axis] = position++;
+        }
+    }
+    AxisVector output_order;
+    for (size_t axis = 0; axis < order.size(); axis++)
+    {
+        if (reduction->get_reduction_axes().count(axis) == 0)
+        {
+            output_order.push_back(output_positions[order[axis]]);
+        }
+    }
+
+    auto placeholder = create_placeholder(reduction->get_argument(0), arg_reshape);
+    std::shared_ptr<Node> new_reduction;
+    if (std::dynamic_pointer_cast<op::Sum>(reduction))
+    {
+        new_reduction = std::make_shared<op::Sum>(placeholder, reduction_axes);
+    }
+    else if (std::dynamic_pointer_cast<op::Product>(reduction))
+    {
+        new_reduction = std::make_shared<op::Product>(placeholder, reduction_axes);
+    }
+    else if (std::dynamic_pointer_cast<op::Max>(reduction))
+    {
+        new_reduction = std::make_shared<op::Max>(placeholder, reduction_axes);
+    }
+    else if (std::dynamic_pointer_cast<op::Min>(reduction))
+    {
+        new_reduction = std::make_shared<op::Min>(placeholder, reduction_axes);
+    }
+    else
+    {
+        return false;
+    }
+    mark_reshape_for_deletion(arg_reshape, reshapes_to_delete);
+    replace_with_sunk_node(reduction, new_reduction, 1, output_order, reorders);
+    return true;
+}
+
+//quantization axes can only be reordered if scale and offset keep their layout
+static bool can_reorder_quantization_axes(std::shared_ptr<op::Reshape> arg_reshape,
+                                          const AxisSet& axis_set)
+{
+    auto& order = arg_reshape->get_input_order();
+    std::vector<size_t> axes;
+    for (auto axis : axis_set)
+    {
+        axes.push_back(order.at(axis));
+    }
+    return std::is_sorted(axes.begin(), axes.end());
+}
+
+static size_t get_transpose_bytes(std::shared_ptr<ngraph::Function> f)
+{
+    size_t bytes = 0;
+    for (auto n : f->get_ordered_ops())
+    {
+        auto reshape = std::dynamic_pointer_cast<op::Reshape>(n);
+        if (reshape && reshape->get_is_transpose())
+        {
+            bytes += shape_size(reshape->get_shape()) * reshape->get_element_type().size();
+        }
+    }
+    return bytes;
+}
+
 //compute an axis order that converts the given axis order to default
 static AxisSet get_quantization_axes_in_default_order(std::shared_ptr<op::Reshape> arg_reshape,
                                                       const AxisSet& old_axis_set)
@@ -137,7 +415,9 @@ void swim(descriptor::Input* input, std::shared_ptr<op::Reshape> reshape)
         work_queue.pop_front();
         auto n = csw.input->get_output().get_node();
         NGRAPH_DEBUG << "Processing (swimming) " << n->get_name();
-        if (auto unary = std::dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(n))
+        auto unary = std::dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(n);
+        //ops with other users have to keep their order
+        if (unary && unary->get_users().size() == 1)
         {
             Swimmer nsw{&unary->get_inputs().at(0), csw.reshape};
             work_queue.push_back(nsw);
@@ -196,6 +476,7 @@ bool ngraph::runtime::cpu::pass::CPUReshapeSinking::run_on_function(
     std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<op::Reshape>> reorders;
     NodeVector results;
     std::set<std::shared_ptr<Node>> reshapes_to_delete;
+    size_t transpose_bytes_before = get_transpose_bytes(f);
 
     for (auto n : f->get_ordered_ops())
     {
@@ -208,7 +489,7 @@ bool ngraph::runtime::cpu::pass::CPUReshapeSinking::run_on_function(
         if (auto reshape = std::dynamic_pointer_cast<op::Reshape>(n))
         {
             auto orig_reshape = reorders.at(n->get_argument(0));
-            if (!reshape->get_is_transpose())
+            if (!is_pure_transpose(reshape, orig_reshape))
             {
                 NGRAPH_DEBUG << "Materializing " << describe_reshape(orig_reshape)
                              << " for reshape " << reshape->get_name();
@@ -238,8 +519,11 @@ bool ngraph::runtime::cpu::pass::CPUReshapeSinking::run_on_function(
                          << n->get_name();
             reorders[n] = reorders[n->get_argument(0)];
         }
-        else if (auto binary = std::dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(n))
+        else if (std::dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(n) ||
+                 std::dynamic_pointer_cast<op::util::BinaryElementwiseComparison>(n) ||
+                 std::dynamic_pointer_cast<op::util::BinaryElementwiseLogical>(n))
         {
+            auto binary = n;
             auto left = n->get_argument(0);
             auto right = n->get_argument(1);
 
@@ -276,9 +560,43 @@ bool ngraph::runtime::cpu::pass::CPUReshapeSinking::run_on_function(
         {
             reorders[goe] = create_default_reshape(goe);
         }
-        else if (auto quantize = std::dynamic_pointer_cast<op::Quantize>(n))
+        else if (auto pad = std::dynamic_pointer_cast<op::Pad>(n))
         {
+            if (!sink_pad(pad, reorders, reshapes_to_delete))
+            {
+                flush_reshapes(n, reorders, reshapes_to_delete);
+            }
+        }
+        else if (auto slice = std::dynamic_pointer_cast<op::Slice>(n))
+        {
+            if (!sink_slice(slice, reorders, reshapes_to_delete))
+            {
+                flush_reshapes(n, reorders, reshapes_to_delete);
+            }
+        }
+        else if (auto concat = std::dynamic_pointer_cast<op::Concat>(n))
+        {
+            if (!sink_concat(concat, reorders, reshapes_to_delete))
+            {
+                flush_reshapes(n, reorders, reshapes_to_delete);
+            }
+        }
+        else if (auto reduction = std::dynamic_pointer_cast<op::util::ArithmeticReduction>(n))
+        {
+            if (!sink_reduction(reduction, reorders, reshapes_to_delete))
+            {
+                flush_reshapes(n, reorders, reshapes_to_delete);
+            }
+        }
+        else if (std::dynamic_pointer_cast<op::Quantize>(n) &&
+                 can_reorder_quantization_axes(
+                     reorders.at(n->get_argument(0)),
+                     std::static_pointer_cast<op::Quantize>(n)->get_axes()))
+        {
+            auto quantize = std::static_pointer_cast<op::Quantize>(n);
             auto arg_reshape = reorders.at(n->get_argument(0));
+            materialize_argument(n, 1, reorders, reshapes_to_delete);
+            materialize_argument(n, 2, reorders, reshapes_to_delete);
             AxisSet axes_in_def_order =
                 get_quantization_axes_in_default_order(arg_reshape, quantize->get_axes());
             auto new_quantize = std::make_shared<op::Quantize>(quantize->get_argument(0),
@@ -291,9 +609,15 @@ bool ngraph::runtime::cpu::pass::CPUReshapeSinking::run_on_function(
             ngraph::replace_node(quantize, new_quantize);
             reorders[new_quantize] = arg_reshape;
         }
-        else if (auto dequantize = std::dynamic_pointer_cast<op::Dequantize>(n))
+        else if (std::dynamic_pointer_cast<op::Dequantize>(n) &&
+                 can_reorder_quantization_axes(
+                     reorders.at(n->get_argument(0)),
+                     std::static_pointer_cast<op::Dequantize>(n)->get_axes()))
         {
+            auto dequantize = std::static_pointer_cast<op::Dequantize>(n);
             auto arg_reshape = reorders.at(n->get_argument(0));
+            materialize_argument(n, 1, reorders, reshapes_to_delete);
+            materialize_argument(n, 2, reorders, reshapes_to_delete);
             AxisSet axes_in_def_order =
                 get_quantization_axes_in_default_order(arg_reshape, dequantize->get_axes());
             auto new_dequantize = std::make_shared<op::Dequantize>(dequantize->get_argument(0),
@@ -307,26 +631,8 @@ bool ngraph::runtime::cpu::pass::CPUReshapeSinking::run_on_function(
         }
         else
         {
-            //skip multiple output nodes and deal with GOEs exclusively
-            if (n->get_outputs().size() > 1)
-            {
-                continue;
-            }
-            //TODO: multiple outputs
-            for (size_t i = 0; i < n->get_arguments().size(); i++)
-            {
-                //materialize all pending reshapes, flush pending reshapes
-                auto arg = n->get_argument(i);
-                if (reorders.count(arg) != 0)
-                {
-                    NGRAPH_DEBUG << "Materializing " << describe_reshape(reorders.at(arg))
-                                 << " for " << arg->get_name();
-                    mark_reshape_for_deletion(reorders.at(arg), reshapes_to_delete);
-                    insert_reshape(n, reorders.at(arg), i);
-                    //no swimming up
-                }
-            }
-            reorders[n] = create_default_reshape(n);
+            //materialize all pending reshapes, flush pending reshapes
+            flush_reshapes(n, reorders, reshapes_to_delete);
         }
     }
 
@@ -349,5 +655,14 @@ bool ngraph::runtime::cpu::pass::CPUReshapeSinking::run_on_function(
     {
         n->validate_and_infer_types();
     }
+
+    size_t transpose_bytes_after = get_transpose_bytes(f);
+    if (transpose_bytes_after < transpose_bytes_before)
+    {
+        m_eliminated_bytes += transpose_bytes_before - transpose_bytes_after;
+    }
+    NGRAPH_DEBUG << "Reshape sinking in " << f->get_name() << ": transposes move "
+                 << transpose_bytes_before << " bytes before and " << transpose_bytes_after
+                 << " bytes after";
     return true;
 }
@@ -26,10 +26,20 @@ namespace ngraph
         {
             namespace pass
             {
+                /// \brief Sinks transposing Reshapes through elementwise, Pad, Slice, Concat and
+                ///        reduction ops towards the results, combining the Reshapes it meets
+                ///        on the way. Inverse pairs are combined into identity Reshapes that
+                ///        ReshapeElimination removes.
                 class CPUReshapeSinking : public ngraph::pass::FunctionPass
                 {
                 public:
                     bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                    /// \brief Returns the number of bytes fewer that transposing Reshapes
+                    ///        write in the functions this pass ran on
+                    size_t get_eliminated_bytes() const { return m_eliminated_bytes; }
+                private:
+                    size_t m_eliminated_bytes{0};
                 };
             }
         }
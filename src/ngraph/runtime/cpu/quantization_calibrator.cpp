@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <limits>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/cpu/quantization_calibrator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::QuantizationCalibrator::QuantizationCalibrator(
+    const shared_ptr<Function>& function, const shared_ptr<runtime::Backend>& backend)
+    : m_backend(backend)
+{
+    NodeMap node_map;
+    auto clone = clone_function(*function, node_map);
+
+    ResultVector results = clone->get_results();
+    for (auto node : function->get_ordered_ops())
+    {
+        if (node->is_output() || node->is_constant() || node->get_output_size() != 1 ||
+            node->get_element_type() != element::f32)
+        {
+            continue;
+        }
+        m_observed_nodes.push_back(node);
+        results.push_back(make_shared<op::Result>(node_map.get(node)));
+    }
+    m_calibration_function = make_shared<Function>(results, clone->get_parameters());
+
+    for (auto result : m_calibration_function->get_results())
+    {
+        m_outputs.push_back(
+            m_backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+    for (auto node : m_observed_nodes)
+    {
+        m_ranges[node] = {numeric_limits<float>::max(), numeric_limits<float>::lowest()};
+    }
+}
+
+runtime::cpu::QuantizationCalibrator::~QuantizationCalibrator()
+{
+    m_backend->remove_compiled_function(m_calibration_function);
+}
+
+void runtime::cpu::QuantizationCalibrator::calibrate(
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    m_backend->call_with_validate(m_calibration_function, m_outputs, inputs);
+
+    // The extra results follow the results of the original function
+    size_t first = m_outputs.size() - m_observed_nodes.size();
+    vector<float> values;
+    for (size_t i = 0; i < m_observed_nodes.size(); i++)
+    {
+        auto& tensor = m_outputs.at(first + i);
+        values.resize(shape_size(tensor->get_shape()));
+        tensor->read(values.data(), 0, values.size() * sizeof(float));
+        if (values.empty())
+        {
+            continue;
+        }
+        auto minmax = minmax_element(values.begin(), values.end());
+        auto& range = m_ranges.at(m_observed_nodes[i]);
+        range.min = min(range.min, *minmax.first);
+        range.max = max(range.max, *minmax.second);
+    }
+}
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Range of the values a tensor took during calibration.
+            struct QuantizationRange
+            {
+                float min;
+                float max;
+            };
+
+            using QuantizationRanges =
+                std::unordered_map<std::shared_ptr<Node>, QuantizationRange>;
+
+            /// \brief Records the ranges of the f32 tensors of a function over representative
+            ///        inputs.
+            ///
+            /// The function is cloned with every f32 tensor exposed as an extra result and the
+            /// clone is run on the given backend, so the function itself is left untouched.
+            /// The ranges are keyed by the nodes of the original function and feed the
+            /// CPUQuantization pass.
+            class QuantizationCalibrator
+            {
+            public:
+                QuantizationCalibrator(const std::shared_ptr<Function>& function,
+                                       const std::shared_ptr<runtime::Backend>& backend);
+                ~QuantizationCalibrator();
+
+                /// \brief Runs one set of representative inputs and widens the recorded ranges.
+                /// \param inputs Tensors for the parameters of the function, in order
+                void calibrate(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+                const QuantizationRanges& get_ranges() const { return m_ranges; }
+            private:
+                std::shared_ptr<runtime::Backend> m_backend;
+                std::shared_ptr<Function> m_calibration_function;
+                // Nodes of the original function, in the order of the extra results
+                std::vector<std::shared_ptr<Node>> m_observed_nodes;
+                std::vector<std::shared_ptr<runtime::Tensor>> m_outputs;
+                QuantizationRanges m_ranges;
+            };
+        }
+    }
+}
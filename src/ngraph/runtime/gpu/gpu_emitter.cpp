@@ -157,6 +157,16 @@ void runtime::gpu::GPU_Emitter::emit_AllReduce(EMIT_ARGS)
     throw unsupported_op("Unsupported op '" + node->description() + "'");
 }
 
+void runtime::gpu::GPU_Emitter::emit_AllReduceStart(EMIT_ARGS)
+{
+    throw unsupported_op("Unsupported op '" + node->description() + "'");
+}
+
+void runtime::gpu::GPU_Emitter::emit_AllReduceWait(EMIT_ARGS)
+{
+    throw unsupported_op("Unsupported op '" + node->description() + "'");
+}
+
 void runtime::gpu::GPU_Emitter::emit_And(EMIT_ARGS)
 {
     emit_elementwise<ngraph::op::And>(external_function, writer, node, args, out);
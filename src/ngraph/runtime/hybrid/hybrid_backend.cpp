@@ -0,0 +1,498 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <future>
+#include <unordered_map>
+
+#include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/pass/assign_placement.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/hybrid/hybrid_backend.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+extern "C" const char* get_ngraph_version_string()
+{
+    return NGRAPH_VERSION;
+}
+
+extern "C" runtime::Backend* new_backend(const char* configuration_string)
+{
+    // HYBRID:CPU,INTERPRETER lists the backends in order of preference
+    string config = configuration_string;
+    vector<string> backend_names;
+    auto colon = config.find(":");
+    if (colon != config.npos)
+    {
+        for (const string& name : split(config.substr(colon + 1), ',', true))
+        {
+            if (!name.empty())
+            {
+                backend_names.push_back(name);
+            }
+        }
+    }
+    else
+    {
+        auto devices = runtime::Backend::get_registered_devices();
+        for (const char* name : {"CPU", "INTERPRETER"})
+        {
+            if (find(devices.begin(), devices.end(), name) != devices.end())
+            {
+                backend_names.push_back(name);
+            }
+        }
+    }
+    return new runtime::hybrid::HybridBackend(backend_names);
+}
+
+extern "C" void delete_backend(runtime::Backend* backend)
+{
+    delete backend;
+}
+
+static Placement get_backend_placement(const string& backend_name)
+{
+    for (auto placement : {Placement::INTERPRETER, Placement::CPU, Placement::GPU, Placement::NNP})
+    {
+        if (placement_to_string(placement) == backend_name)
+        {
+            return placement;
+        }
+    }
+    throw ngraph_error("Backend '" + backend_name + "' cannot be used by the hybrid backend");
+}
+
+// Backends whose tensors can wrap host memory, so both sides of a boundary can share it
+static bool is_host_memory(Placement placement)
+{
+    return placement == Placement::CPU || placement == Placement::INTERPRETER;
+}
+
+static void copy_tensor(runtime::Tensor& dst, const runtime::Tensor& src, vector<char>& staging)
+{
+    size_t size = src.get_size_in_bytes();
+    staging.resize(size);
+    src.read(staging.data(), 0, size);
+    dst.write(staging.data(), 0, size);
+}
+
+runtime::hybrid::HybridBackend::HybridBackend(const vector<string>& backend_names,
+                                              const PlacementPolicy& placement_policy)
+    : m_placement_policy(placement_policy)
+{
+    if (backend_names.empty())
+    {
+        throw ngraph_error("The hybrid backend needs at least one backend");
+    }
+    for (const string& name : backend_names)
+    {
+        Placement placement = get_backend_placement(name);
+        m_placements.push_back(placement);
+        m_backends[placement] = runtime::Backend::create(name);
+    }
+}
+
+shared_ptr<runtime::Tensor>
+    runtime::hybrid::HybridBackend::create_tensor(const element::Type& type, const Shape& shape)
+{
+    return make_shared<runtime::HostTensor>(type, shape, "external");
+}
+
+shared_ptr<runtime::Tensor> runtime::hybrid::HybridBackend::create_tensor(
+    const element::Type& type, const Shape& shape, void* memory_pointer)
+{
+    return make_shared<runtime::HostTensor>(type, shape, memory_pointer, "external");
+}
+
+shared_ptr<runtime::Backend> runtime::hybrid::HybridBackend::get_backend(Placement placement)
+{
+    auto it = m_backends.find(placement);
+    if (it == m_backends.end())
+    {
+        it = m_backends.emplace(placement, Backend::create(placement_to_string(placement))).first;
+    }
+    return it->second;
+}
+
+void runtime::hybrid::HybridBackend::assign_placement(const shared_ptr<Function>& func)
+{
+    if (m_placement_policy)
+    {
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::AssignPlacement>(m_placement_policy);
+        pass_manager.run_passes(func);
+        return;
+    }
+
+    // Placements that were assigned before compiling are kept
+    auto ops = func->get_ordered_ops();
+    for (auto& node : ops)
+    {
+        if (node->get_placement() != Placement::DEFAULT || node->is_parameter() ||
+            node->is_constant() || node->is_output())
+        {
+            continue;
+        }
+        // Partitions are cut at single output ops only
+        if (dynamic_pointer_cast<op::GetOutputElement>(node))
+        {
+            node->set_placement(node->get_argument(0)->get_placement());
+            continue;
+        }
+        for (auto placement : m_placements)
+        {
+            if (get_backend(placement)->is_supported(*node))
+            {
+                node->set_placement(placement);
+                break;
+            }
+        }
+        if (node->get_placement() == Placement::DEFAULT)
+        {
+            throw unsupported_op("No backend of the hybrid backend supports " +
+                                 node->description());
+        }
+    }
+
+    // Parameters and constants go with their first user and results with their argument, so
+    // they do not end up in partitions of their own
+    for (auto& node : ops)
+    {
+        if (node->get_placement() == Placement::DEFAULT &&
+            (node->is_parameter() || node->is_constant()))
+        {
+            Placement placement = m_placements.front();
+            for (auto& user : node->get_users())
+            {
+                if (user->get_placement() != Placement::DEFAULT)
+                {
+                    placement = user->get_placement();
+                    break;
+                }
+            }
+            node->set_placement(placement);
+        }
+    }
+    for (auto& node : ops)
+    {
+        if (node->get_placement() == Placement::DEFAULT && node->is_output())
+        {
+            node->set_placement(node->get_argument(0)->get_placement());
+        }
+    }
+}
+
+bool runtime::hybrid::HybridBackend::compile(shared_ptr<Function> func)
+{
+    lock_guard<mutex> lock(m_mutex);
+    FunctionInstance& instance = m_function_map[func];
+    if (!instance.m_partitions.empty())
+    {
+        return true;
+    }
+
+    try
+    {
+        build_partitions(func, instance);
+    }
+    catch (...)
+    {
+        m_function_map.erase(func);
+        throw;
+    }
+    return true;
+}
+
+void runtime::hybrid::HybridBackend::build_partitions(const shared_ptr<Function>& func,
+                                                      FunctionInstance& instance)
+{
+    // Split a copy, so the graph of the caller is left alone
+    NodeMap node_map;
+    auto function = clone_function(*func, node_map);
+    for (auto& node : func->get_ops())
+    {
+        node_map.get(node)->set_placement(node->get_placement());
+    }
+    assign_placement(function);
+
+    vector<shared_ptr<Function>> sub_functions;
+    unordered_map<shared_ptr<op::Parameter>, shared_ptr<op::Result>> map_parameter_to_result;
+    tie(sub_functions, map_parameter_to_result) = split_function_by_placement(function);
+
+    unordered_map<shared_ptr<Node>, size_t> input_indices;
+    unordered_map<shared_ptr<Node>, size_t> output_indices;
+    for (size_t i = 0; i < function->get_parameters().size(); i++)
+    {
+        input_indices[function->get_parameters()[i]] = i;
+    }
+    for (size_t i = 0; i < function->get_results().size(); i++)
+    {
+        output_indices[function->get_results()[i]] = i;
+    }
+
+    // (partition index, result index) of every result of the sub-functions. Sub-functions
+    // are in topological order, so producers are always visited before their consumers.
+    unordered_map<shared_ptr<Node>, pair<size_t, size_t>> result_locations;
+    vector<size_t> levels(sub_functions.size(), 0);
+    instance.m_partitions.resize(sub_functions.size());
+    for (size_t i = 0; i < sub_functions.size(); i++)
+    {
+        Partition& partition = instance.m_partitions[i];
+        partition.m_function = sub_functions[i];
+        partition.m_placement = get_colocated_function_placement(sub_functions[i]);
+        partition.m_backend = get_backend(partition.m_placement);
+        bool host_memory = is_host_memory(partition.m_placement);
+
+        const auto& results = partition.m_function->get_results();
+        partition.m_result_tensors.resize(results.size());
+        for (size_t j = 0; j < results.size(); j++)
+        {
+            result_locations[results[j]] = make_pair(i, j);
+            auto it = output_indices.find(results[j]);
+            if (it != output_indices.end())
+            {
+                partition.m_output_bindings.emplace_back(j, it->second);
+                if (!host_memory)
+                {
+                    partition.m_result_tensors[j] = partition.m_backend->create_tensor(
+                        results[j]->get_element_type(), results[j]->get_shape());
+                }
+            }
+        }
+
+        const auto& parameters = partition.m_function->get_parameters();
+        partition.m_parameter_tensors.resize(parameters.size());
+        for (size_t j = 0; j < parameters.size(); j++)
+        {
+            const auto& type = parameters[j]->get_element_type();
+            const auto& shape = parameters[j]->get_shape();
+            auto it = input_indices.find(parameters[j]);
+            if (it != input_indices.end())
+            {
+                partition.m_input_bindings.emplace_back(j, it->second);
+                if (!host_memory)
+                {
+                    partition.m_parameter_tensors[j] =
+                        partition.m_backend->create_tensor(type, shape);
+                }
+                continue;
+            }
+
+            auto location = result_locations.at(map_parameter_to_result.at(parameters[j]));
+            Partition& producer = instance.m_partitions[location.first];
+            auto& result_tensor = producer.m_result_tensors[location.second];
+            if (host_memory && is_host_memory(producer.m_placement))
+            {
+                auto buffer = new AlignedBuffer(shape_size(shape) * type.size(), alignment);
+                instance.m_boundary_buffers.emplace_back(buffer);
+                result_tensor = producer.m_backend->create_tensor(type, shape, buffer->get_ptr());
+                partition.m_parameter_tensors[j] =
+                    partition.m_backend->create_tensor(type, shape, buffer->get_ptr());
+            }
+            else
+            {
+                result_tensor = producer.m_backend->create_tensor(type, shape);
+                partition.m_parameter_tensors[j] = partition.m_backend->create_tensor(type, shape);
+                partition.m_copies.emplace_back(result_tensor, partition.m_parameter_tensors[j]);
+            }
+            levels[i] = max(levels[i], levels[location.first] + 1);
+        }
+
+        if (instance.m_performance_counters_enabled)
+        {
+            partition.m_backend->enable_performance_data(partition.m_function, true);
+        }
+        partition.m_backend->compile(partition.m_function);
+
+        if (instance.m_levels.size() <= levels[i])
+        {
+            instance.m_levels.resize(levels[i] + 1);
+        }
+        instance.m_levels[levels[i]].push_back(i);
+    }
+}
+
+void runtime::hybrid::HybridBackend::run_partition(Partition& partition,
+                                                   const vector<shared_ptr<Tensor>>& outputs,
+                                                   const vector<shared_ptr<Tensor>>& inputs)
+{
+    // Tensors of the caller are wrapped when they are in host memory and copied otherwise
+    bool host_memory = is_host_memory(partition.m_placement);
+    for (const auto& binding : partition.m_input_bindings)
+    {
+        const auto& input = inputs.at(binding.second);
+        auto& tensor = partition.m_parameter_tensors[binding.first];
+        auto host_tensor = dynamic_pointer_cast<HostTensor>(input);
+        if (host_memory && host_tensor)
+        {
+            tensor = partition.m_backend->create_tensor(
+                input->get_element_type(), input->get_shape(), host_tensor->get_data_ptr());
+        }
+        else
+        {
+            if (host_memory)
+            {
+                tensor =
+                    partition.m_backend->create_tensor(input->get_element_type(), input->get_shape());
+            }
+            copy_tensor(*tensor, *input, partition.m_staging);
+        }
+    }
+    for (const auto& binding : partition.m_output_bindings)
+    {
+        const auto& output = outputs.at(binding.second);
+        auto& tensor = partition.m_result_tensors[binding.first];
+        auto host_tensor = dynamic_pointer_cast<HostTensor>(output);
+        if (host_memory && host_tensor)
+        {
+            tensor = partition.m_backend->create_tensor(
+                output->get_element_type(), output->get_shape(), host_tensor->get_data_ptr());
+        }
+        else if (host_memory)
+        {
+            tensor =
+                partition.m_backend->create_tensor(output->get_element_type(), output->get_shape());
+        }
+    }
+    for (const auto& copy : partition.m_copies)
+    {
+        copy_tensor(*copy.second, *copy.first, partition.m_staging);
+    }
+
+    partition.m_backend->call(
+        partition.m_function, partition.m_result_tensors, partition.m_parameter_tensors);
+
+    for (const auto& binding : partition.m_output_bindings)
+    {
+        const auto& output = outputs.at(binding.second);
+        if (!host_memory || !dynamic_pointer_cast<HostTensor>(output))
+        {
+            copy_tensor(*output, *partition.m_result_tensors[binding.first], partition.m_staging);
+        }
+    }
+}
+
+bool runtime::hybrid::HybridBackend::call(shared_ptr<Function> func,
+                                          const vector<shared_ptr<Tensor>>& outputs,
+                                          const vector<shared_ptr<Tensor>>& inputs)
+{
+    validate_call(func, outputs, inputs);
+    compile(func);
+
+    FunctionInstance* instance;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        instance = &m_function_map.at(func);
+    }
+
+    lock_guard<mutex> lock(instance->m_call_mutex);
+    for (const auto& level : instance->m_levels)
+    {
+        // Partitions of a level are independent, all but one run on threads of their own
+        vector<future<void>> futures;
+        for (size_t i = 1; i < level.size(); i++)
+        {
+            futures.push_back(async(launch::async,
+                                    &HybridBackend::run_partition,
+                                    this,
+                                    ref(instance->m_partitions[level[i]]),
+                                    cref(outputs),
+                                    cref(inputs)));
+        }
+        run_partition(instance->m_partitions[level[0]], outputs, inputs);
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+    }
+    return true;
+}
+
+void runtime::hybrid::HybridBackend::remove_compiled_function(shared_ptr<Function> func)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end())
+    {
+        for (auto& partition : it->second.m_partitions)
+        {
+            partition.m_backend->remove_compiled_function(partition.m_function);
+        }
+        m_function_map.erase(it);
+    }
+}
+
+bool runtime::hybrid::HybridBackend::is_supported(const Node& node) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto placement : m_placements)
+    {
+        if (m_backends.at(placement)->is_supported(node))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void runtime::hybrid::HybridBackend::enable_performance_data(shared_ptr<Function> func,
+                                                             bool enable)
+{
+    lock_guard<mutex> lock(m_mutex);
+    FunctionInstance& instance = m_function_map[func];
+    if (!instance.m_partitions.empty())
+    {
+        throw runtime_error("Performance data collection must be enabled prior to compiling.");
+    }
+    instance.m_performance_counters_enabled = enable;
+}
+
+vector<runtime::PerformanceCounter>
+    runtime::hybrid::HybridBackend::get_performance_data(shared_ptr<Function> func) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    vector<runtime::PerformanceCounter> rc;
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end())
+    {
+        for (const auto& partition : it->second.m_partitions)
+        {
+            auto counters = partition.m_backend->get_performance_data(partition.m_function);
+            rc.insert(rc.end(), counters.begin(), counters.end());
+        }
+    }
+    return rc;
+}
+
+vector<shared_ptr<Function>>
+    runtime::hybrid::HybridBackend::get_sub_functions(shared_ptr<Function> func)
+{
+    compile(func);
+    lock_guard<mutex> lock(m_mutex);
+    vector<shared_ptr<Function>> rc;
+    for (const auto& partition : m_function_map.at(func).m_partitions)
+    {
+        rc.push_back(partition.m_function);
+    }
+    return rc;
+}
@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ngraph/placement.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            class HybridBackend;
+        }
+    }
+}
+
+/// \brief Executes a function on several backends.
+///
+/// The function is split by placement into sub-functions that are each compiled on the backend
+/// of their placement. Tensors passed between two host memory backends share one buffer, other
+/// boundaries are copied. Sub-functions that do not depend on each other run concurrently.
+///
+/// Created through Backend::create("HYBRID:CPU,INTERPRETER"), where the backends are listed in
+/// order of preference. Every op is placed on the first backend that supports it.
+class ngraph::runtime::hybrid::HybridBackend : public Backend
+{
+public:
+    using PlacementPolicy = std::function<Placement(std::shared_ptr<Node>)>;
+
+    /// \param backend_names Backends in order of preference
+    /// \param placement_policy Places the ops instead of the order of preference when set
+    HybridBackend(const std::vector<std::string>& backend_names,
+                  const PlacementPolicy& placement_policy = nullptr);
+
+    std::shared_ptr<Tensor>
+        create_tensor(const element::Type& type, const Shape& shape, void* memory_pointer) override;
+
+    std::shared_ptr<Tensor> create_tensor(const element::Type& type, const Shape& shape) override;
+
+    bool compile(std::shared_ptr<Function> func) override;
+
+    bool call(std::shared_ptr<Function> func,
+              const std::vector<std::shared_ptr<Tensor>>& outputs,
+              const std::vector<std::shared_ptr<Tensor>>& inputs) override;
+
+    void remove_compiled_function(std::shared_ptr<Function> func) override;
+
+    bool is_supported(const Node& node) const override;
+
+    void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
+    std::vector<PerformanceCounter>
+        get_performance_data(std::shared_ptr<Function> func) const override;
+
+    /// \brief The sub-functions func was split into, in execution order.
+    std::vector<std::shared_ptr<Function>> get_sub_functions(std::shared_ptr<Function> func);
+
+private:
+    class Partition
+    {
+    public:
+        std::shared_ptr<Function> m_function;
+        Placement m_placement;
+        std::shared_ptr<Backend> m_backend;
+        // Tensors of the parameters and results of m_function. Slots bound to the
+        // caller's tensors are filled on every call.
+        std::vector<std::shared_ptr<Tensor>> m_parameter_tensors;
+        std::vector<std::shared_ptr<Tensor>> m_result_tensors;
+        // (parameter index, function input index)
+        std::vector<std::pair<size_t, size_t>> m_input_bindings;
+        // (result index, function output index)
+        std::vector<std::pair<size_t, size_t>> m_output_bindings;
+        // (source, destination) of boundary tensors that are not shared
+        std::vector<std::pair<std::shared_ptr<Tensor>, std::shared_ptr<Tensor>>> m_copies;
+        std::vector<char> m_staging;
+    };
+
+    class FunctionInstance
+    {
+    public:
+        bool m_performance_counters_enabled = false;
+        std::vector<Partition> m_partitions;
+        // Partitions grouped so that each group only depends on earlier groups
+        std::vector<std::vector<size_t>> m_levels;
+        // Storage of the boundary tensors shared by two host memory backends
+        std::vector<std::unique_ptr<AlignedBuffer>> m_boundary_buffers;
+        // Partitions hold per call bindings, so calls of one function run one at a time
+        std::mutex m_call_mutex;
+    };
+
+    std::shared_ptr<Backend> get_backend(Placement placement);
+    void assign_placement(const std::shared_ptr<Function>& func);
+    void build_partitions(const std::shared_ptr<Function>& func, FunctionInstance& instance);
+    void run_partition(Partition& partition,
+                       const std::vector<std::shared_ptr<Tensor>>& outputs,
+                       const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    std::vector<Placement> m_placements;
+    PlacementPolicy m_placement_policy;
+    std::map<Placement, std::shared_ptr<Backend>> m_backends;
+    std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+    mutable std::mutex m_mutex;
+};
@@ -1370,6 +1370,8 @@ bool runtime::intelgpu::IntelGPUBackend::compile(shared_ptr<Function> func)
             break;
         }
         case OP_TYPEID::AllReduce:
+        case OP_TYPEID::AllReduceStart:
+        case OP_TYPEID::AllReduceWait:
         case OP_TYPEID::FunctionCall:
         case OP_TYPEID::Dequantize:
         case OP_TYPEID::Quantize:
@@ -20,10 +20,12 @@
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
 #include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -66,19 +68,111 @@ bool runtime::interpreter::INTBackend::compile(shared_ptr<Function> function)
         instance.m_is_compiled = true;
         pass::Manager pass_manager;
         pass_manager.register_pass<pass::LikeReplacement>();
+#ifdef NGRAPH_DISTRIBUTED
+        pass_manager.register_pass<pass::AllReduceBucketing>();
+#endif
         pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
         pass_manager.register_pass<pass::Liveness>();
+        pass_manager.register_pass<pass::MemoryLayout>(runtime::alignment);
         pass_manager.run_passes(function);
 
+        instance.m_temporary_pool.reset(
+            new AlignedBuffer(function->get_temporary_pool_size(), runtime::alignment));
+
+        unordered_map<const descriptor::Tensor*, size_t> parameter_indices;
+        for (auto param : function->get_parameters())
+        {
+            for (size_t i = 0; i < param->get_output_size(); ++i)
+            {
+                size_t parameter_index = parameter_indices.size();
+                parameter_indices[param->get_output_tensor_ptr(i).get()] = parameter_index;
+            }
+        }
+
+        unordered_map<const descriptor::Tensor*, size_t> result_indices;
+        for (size_t i = 0; i < function->get_output_size(); ++i)
+        {
+            auto output = function->get_output_op(i);
+            if (!dynamic_pointer_cast<op::Result>(output))
+            {
+                throw ngraph_error("One of function's outputs isn't op::Result");
+            }
+            result_indices[output->get_output_tensor_ptr(0).get()] = i;
+        }
+
+        // Constants are read in place, every other tensor that is neither a
+        // parameter nor a result is a view into the temporary pool
+        unordered_map<const descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
         for (const shared_ptr<Node>& node : function->get_ordered_ops())
         {
+            size_t node_index = instance.m_wrapped_nodes.size();
             instance.m_wrapped_nodes.emplace_back(node);
+
+            if (auto constant = dynamic_pointer_cast<op::Constant>(node))
+            {
+                descriptor::Tensor* tv = constant->get_output_tensor_ptr(0).get();
+                tensor_map[tv] =
+                    make_shared<HostTensor>(tv->get_element_type(),
+                                            tv->get_shape(),
+                                            const_cast<void*>(constant->get_data_ptr()),
+                                            tv->get_name());
+            }
+            for (descriptor::Tensor* tv : node->liveness_new_list)
+            {
+                tensor_map[tv] = make_shared<HostTensor>(
+                    tv->get_element_type(),
+                    tv->get_shape(),
+                    instance.m_temporary_pool->get_ptr(tv->get_pool_offset()),
+                    tv->get_name());
+            }
+
+            vector<shared_ptr<HostTensor>> op_inputs;
+            vector<shared_ptr<HostTensor>> op_outputs;
+            if (!node->is_parameter() && !node->is_constant())
+            {
+                for (const descriptor::Input& input : node->get_inputs())
+                {
+                    descriptor::Tensor* tv = input.get_output().get_tensor_ptr().get();
+                    auto it = parameter_indices.find(tv);
+                    if (it != parameter_indices.end())
+                    {
+                        instance.m_parameter_bindings.emplace_back(
+                            node_index, op_inputs.size(), it->second);
+                        op_inputs.push_back(nullptr);
+                    }
+                    else
+                    {
+                        op_inputs.push_back(tensor_map.at(tv));
+                    }
+                }
+                for (size_t i = 0; i < node->get_output_size(); ++i)
+                {
+                    descriptor::Tensor* tv = node->get_output_tensor_ptr(i).get();
+                    auto it = result_indices.find(tv);
+                    if (it != result_indices.end())
+                    {
+                        instance.m_result_bindings.emplace_back(node_index, i, it->second);
+                        op_outputs.push_back(nullptr);
+                    }
+                    else
+                    {
+                        op_outputs.push_back(tensor_map.at(tv));
+                    }
+                }
+            }
+            instance.m_op_inputs.push_back(op_inputs);
+            instance.m_op_outputs.push_back(op_outputs);
         }
     }
 
     return true;
 }
 
+void runtime::interpreter::INTBackend::remove_compiled_function(shared_ptr<Function> func)
+{
+    m_function_map.erase(func);
+}
+
 bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
                                             const vector<shared_ptr<runtime::Tensor>>& outputs,
                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
@@ -87,88 +181,45 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
 
     compile(function);
     FunctionInstance& instance = m_function_map[function];
+    // The bindings and the temporary pool belong to the compiled function
+    lock_guard<mutex> lock(instance.m_call_mutex);
 
-    // convert inputs to HostTensor
-    vector<shared_ptr<runtime::HostTensor>> func_inputs;
-    for (auto tv : inputs)
-    {
-        func_inputs.push_back(static_pointer_cast<runtime::HostTensor>(tv));
-    }
     if (instance.m_nan_check_enabled)
     {
+        vector<shared_ptr<runtime::HostTensor>> func_inputs;
+        for (auto tv : inputs)
+        {
+            func_inputs.push_back(static_pointer_cast<runtime::HostTensor>(tv));
+        }
         perform_nan_check(func_inputs);
     }
 
-    // convert outputs to HostTensor
-    vector<shared_ptr<runtime::HostTensor>> func_outputs;
-    for (auto tv : outputs)
+    // bind function params and outputs to the ops that use them
+    for (const auto& binding : instance.m_parameter_bindings)
     {
-        func_outputs.push_back(static_pointer_cast<runtime::HostTensor>(tv));
+        instance.m_op_inputs[get<0>(binding)][get<1>(binding)] =
+            static_pointer_cast<runtime::HostTensor>(inputs[get<2>(binding)]);
     }
-
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<runtime::HostTensor>> tensor_map;
-    size_t input_count = 0;
-    for (auto param : function->get_parameters())
+    for (const auto& binding : instance.m_result_bindings)
     {
-        for (size_t i = 0; i < param->get_output_size(); ++i)
-        {
-            descriptor::Tensor* tv = param->get_output_tensor_ptr(i).get();
-            tensor_map.insert({tv, func_inputs[input_count++]});
-        }
-    }
-
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < function->get_output_size(); ++output_count)
-    {
-        auto output = function->get_output_op(output_count);
-        if (!dynamic_pointer_cast<op::Result>(output))
-        {
-            throw ngraph_error("One of function's outputs isn't op::Result");
-        }
-        descriptor::Tensor* tv = output->get_output_tensor_ptr(0).get();
-        tensor_map.insert({tv, func_outputs[output_count]});
+        instance.m_op_outputs[get<0>(binding)][get<1>(binding)] =
+            static_pointer_cast<runtime::HostTensor>(outputs[get<2>(binding)]);
     }
 
     // for each ordered op in the graph
-    for (const NodeWrapper& wrapped : instance.m_wrapped_nodes)
+    for (size_t node_index = 0; node_index < instance.m_wrapped_nodes.size(); ++node_index)
     {
+        const NodeWrapper& wrapped = instance.m_wrapped_nodes[node_index];
         const Node* op = &wrapped.get_node();
         auto type_id = wrapped.get_typeid();
-        if (type_id == OP_TYPEID::Parameter)
+        if (type_id == OP_TYPEID::Parameter || type_id == OP_TYPEID::Constant)
         {
             continue;
         }
-        // get op inputs from map
-        vector<shared_ptr<runtime::HostTensor>> op_inputs;
-        for (const descriptor::Input& input : op->get_inputs())
-        {
-            descriptor::Tensor* tv = input.get_output().get_tensor_ptr().get();
-            op_inputs.push_back(tensor_map.at(tv));
-        }
-
-        // get op outputs from map or create
-        vector<shared_ptr<runtime::HostTensor>> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
-        {
-            descriptor::Tensor* tv = op->get_output_tensor_ptr(i).get();
-            shared_ptr<runtime::HostTensor> htv;
-            auto it = tensor_map.find(tv);
-            if (it == tensor_map.end())
-            {
-                // the output tensor is not in the tensor map so create a new tensor
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->get_output_tensor(i).get_name();
-                htv = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tv, htv});
-            }
-            else
-            {
-                htv = it->second;
-            }
-            op_outputs.push_back(htv);
-        }
+        const vector<shared_ptr<runtime::HostTensor>>& op_inputs =
+            instance.m_op_inputs[node_index];
+        const vector<shared_ptr<runtime::HostTensor>>& op_outputs =
+            instance.m_op_outputs[node_index];
 
         // get op type
         element::Type type;
@@ -204,19 +255,16 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         {
             perform_nan_check(op_outputs, op);
         }
+    }
 
-        // delete any obsolete tensors
-        for (const descriptor::Tensor* t : op->liveness_free_list)
-        {
-            for (auto it = tensor_map.begin(); it != tensor_map.end(); ++it)
-            {
-                if (it->second->get_name() == t->get_name())
-                {
-                    tensor_map.erase(it);
-                    break;
-                }
-            }
-        }
+    // don't hold on to the caller's tensors between calls
+    for (const auto& binding : instance.m_parameter_bindings)
+    {
+        instance.m_op_inputs[get<0>(binding)][get<1>(binding)] = nullptr;
+    }
+    for (const auto& binding : instance.m_result_bindings)
+    {
+        instance.m_op_outputs[get<0>(binding)][get<1>(binding)] = nullptr;
     }
 
     return true;
@@ -231,6 +279,10 @@ void runtime::interpreter::INTBackend::generate_calls(const element::Type& type,
     {
         op_engine<char>(op, outputs, inputs);
     }
+    else if (type == element::bf16)
+    {
+        op_engine<bfloat16>(op, outputs, inputs);
+    }
     else if (type == element::f32)
     {
         op_engine<float>(op, outputs, inputs);
@@ -332,6 +384,25 @@ void runtime::interpreter::INTBackend::perform_nan_check(const vector<shared_ptr
                 }
             }
         }
+        else if (type == element::bf16)
+        {
+            const bfloat16* data = tv->get_data_ptr<bfloat16>();
+            for (size_t i = 0; i < tv->get_element_count(); i++)
+            {
+                if (std::isnan(static_cast<float>(data[i])))
+                {
+                    if (op)
+                    {
+                        throw runtime_error("nan found in op '" + op->get_name() + "' output");
+                    }
+                    else
+                    {
+                        throw runtime_error("nan found in function's input tensor number " +
+                                            to_string(arg_number));
+                    }
+                }
+            }
+        }
         else if (type == element::f64)
         {
             const double* data = tv->get_data_ptr<double>();
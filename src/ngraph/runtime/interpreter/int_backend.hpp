@@ -17,8 +17,10 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "ngraph/op/argmax.hpp"
@@ -53,6 +55,7 @@
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/topk.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/node_wrapper.hpp"
@@ -155,6 +158,8 @@ public:
               const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& intputs) override;
 
+    void remove_compiled_function(std::shared_ptr<Function> func) override;
+
     void set_nan_check(std::shared_ptr<Function> func, bool);
 
     void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
@@ -170,8 +175,25 @@ private:
         bool m_performance_counters_enabled = false;
         std::unordered_map<const Node*, stopwatch> m_timer_map;
         std::vector<NodeWrapper> m_wrapped_nodes;
+        // Backing store of all intermediate tensors, laid out by MemoryLayout
+        std::unique_ptr<AlignedBuffer> m_temporary_pool;
+        // Arguments and results of each wrapped node. Slots fed by function
+        // parameters or written to function results are bound on every call.
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> m_op_inputs;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> m_op_outputs;
+        // (node index, input index, parameter index)
+        std::vector<std::tuple<size_t, size_t, size_t>> m_parameter_bindings;
+        // (node index, output index, result index)
+        std::vector<std::tuple<size_t, size_t, size_t>> m_result_bindings;
+        // Calls bind the slots above and run in the temporary pool, so calls of
+        // one function run one at a time
+        std::mutex m_call_mutex;
     };
     std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+#ifdef NGRAPH_DISTRIBUTED
+    // Reductions started by AllReduceStart nodes and not yet waited for
+    std::unordered_map<const Node*, MPI_Request> m_allreduce_requests;
+#endif
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
@@ -224,6 +246,41 @@ private:
                                     out[0]->get_data_ptr<T>(),
                                     args[0]->get_element_type(),
                                     static_cast<int>(args[0]->get_element_count()));
+#endif
+            break;
+        }
+        case OP_TYPEID::AllReduceStart:
+        {
+#ifdef NGRAPH_DISTRIBUTED
+            std::vector<const T*> arg_ptrs;
+            std::vector<size_t> counts;
+            for (auto& arg : args)
+            {
+                arg_ptrs.push_back(arg->get_data_ptr<T>());
+                counts.push_back(arg->get_element_count());
+            }
+            reference::allreduce_start<T>(arg_ptrs,
+                                          counts,
+                                          out[0]->get_data_ptr<T>(),
+                                          out[0]->get_element_type(),
+                                          &m_allreduce_requests[&node]);
+#endif
+            break;
+        }
+        case OP_TYPEID::AllReduceWait:
+        {
+#ifdef NGRAPH_DISTRIBUTED
+            std::vector<T*> out_ptrs;
+            std::vector<size_t> counts;
+            for (auto& output : out)
+            {
+                out_ptrs.push_back(output->get_data_ptr<T>());
+                counts.push_back(output->get_element_count());
+            }
+            reference::allreduce_wait<T>(args[0]->get_data_ptr<T>(),
+                                         out_ptrs,
+                                         counts,
+                                         &m_allreduce_requests[node.get_argument(0).get()]);
 #endif
             break;
         }
@@ -433,6 +490,12 @@ private:
                                       out[0]->get_data_ptr<char>(),
                                       out[0]->get_element_count());
             }
+            else if (type == element::bf16)
+            {
+                reference::convert<T>(args[0]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<bfloat16>(),
+                                      out[0]->get_element_count());
+            }
             else if (type == element::f32)
             {
                 reference::convert<T>(args[0]->get_data_ptr<T>(),
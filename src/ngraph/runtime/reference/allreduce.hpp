@@ -18,6 +18,9 @@
 
 #ifdef NGRAPH_DISTRIBUTED
 
+#include <cstring>
+#include <vector>
+
 #include <mpi.h>
 #include "ngraph/type/element_type.hpp"
 
@@ -27,8 +30,7 @@ namespace ngraph
     {
         namespace reference
         {
-            template <typename T>
-            void allreduce(const T* arg, T* out, const element::Type element_type, int count)
+            inline MPI_Datatype get_mpi_data_type(const element::Type& element_type)
             {
                 auto data_type = MPI_FLOAT;
 
@@ -40,8 +42,58 @@ namespace ngraph
                 {
                     data_type = MPI_DOUBLE;
                 }
+                return data_type;
+            }
+
+            template <typename T>
+            void allreduce(const T* arg, T* out, const element::Type element_type, int count)
+            {
+                MPI_Allreduce(arg,
+                              out,
+                              count,
+                              get_mpi_data_type(element_type),
+                              MPI_SUM,
+                              MPI_COMM_WORLD);
+            }
 
-                MPI_Allreduce(arg, out, count, data_type, MPI_SUM, MPI_COMM_WORLD);
+            // Packs args into buffer and starts summing buffer in place over all processes.
+            // The sums are only available after allreduce_wait completes request.
+            template <typename T>
+            void allreduce_start(const std::vector<const T*>& args,
+                                 const std::vector<size_t>& counts,
+                                 T* buffer,
+                                 const element::Type element_type,
+                                 MPI_Request* request)
+            {
+                size_t offset = 0;
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    std::memcpy(buffer + offset, args[i], counts[i] * sizeof(T));
+                    offset += counts[i];
+                }
+                MPI_Iallreduce(MPI_IN_PLACE,
+                               buffer,
+                               static_cast<int>(offset),
+                               get_mpi_data_type(element_type),
+                               MPI_SUM,
+                               MPI_COMM_WORLD,
+                               request);
+            }
+
+            // Completes request and unpacks the reduced buffer into outs
+            template <typename T>
+            void allreduce_wait(const T* buffer,
+                                const std::vector<T*>& outs,
+                                const std::vector<size_t>& counts,
+                                MPI_Request* request)
+            {
+                MPI_Wait(request, MPI_STATUS_IGNORE);
+                size_t offset = 0;
+                for (size_t i = 0; i < outs.size(); i++)
+                {
+                    std::memcpy(outs[i], buffer + offset, counts[i] * sizeof(T));
+                    offset += counts[i];
+                }
             }
         }
     }
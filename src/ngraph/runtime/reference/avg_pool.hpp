@@ -18,11 +18,13 @@
 
 #include <cmath>
 #include <numeric>
+#include <type_traits>
 #include <vector>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/type/bfloat16.hpp"
 
 namespace ngraph
 {
@@ -207,8 +209,11 @@ namespace ngraph
                     // and the number of elements:
                     //
                     //   n_elements := n_elements + 1
+                    //
+                    // bfloat16 windows are summed in float.
 
-                    T result = 0;
+                    typename std::conditional<std::is_same<T, bfloat16>::value, float, T>::type
+                        result = 0;
                     size_t n_elements = 0;
 
                     for (const Coordinate& input_batch_coord : input_batch_transform)
@@ -218,8 +223,8 @@ namespace ngraph
 
                         if (in_bounds || include_padding_in_avg_computation)
                         {
-                            T v =
-                                in_bounds ? arg[input_batch_transform.index(input_batch_coord)] : 0;
+                            T v = in_bounds ? arg[input_batch_transform.index(input_batch_coord)]
+                                            : T(0);
                             result += v;
                             n_elements++;
                         }
@@ -16,10 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <type_traits>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/type/bfloat16.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -28,6 +32,154 @@ namespace ngraph
     {
         namespace reference
         {
+            // Direct convolution for the plain layouts (batch/channel axes at 0/1, no data
+            // dilation) with up to three spatial dimensions; lower ranks are treated as having
+            // unit extents on the missing leading axes. Each filter tap is accumulated into an
+            // output row whose valid range is computed up front, so the innermost loop needs no
+            // padding checks or coordinate arithmetic. Contributions to an output element are
+            // summed in the same (input channel, filter position) order as the generic path.
+            template <typename T>
+            bool convolution_direct(const T* arg0,
+                                    const T* arg1,
+                                    T* out,
+                                    const Shape& arg0_shape,
+                                    const Shape& arg1_shape,
+                                    const Shape& out_shape,
+                                    const Strides& window_movement_strides,
+                                    const Strides& window_dilation_strides,
+                                    const CoordinateDiff& padding_below,
+                                    const Strides& data_dilation_strides,
+                                    bool rotate_filter)
+            {
+                constexpr size_t max_spatial_dimensions = 3;
+                size_t n_spatial_dimensions = arg0_shape.size() - 2;
+                if (n_spatial_dimensions < 1 || n_spatial_dimensions > max_spatial_dimensions)
+                {
+                    return false;
+                }
+                for (size_t stride : data_dilation_strides)
+                {
+                    if (stride != 1)
+                    {
+                        return false;
+                    }
+                }
+
+                size_t in_dims[max_spatial_dimensions];
+                size_t filter_dims[max_spatial_dimensions];
+                size_t out_dims[max_spatial_dimensions];
+                std::ptrdiff_t movement[max_spatial_dimensions];
+                std::ptrdiff_t dilation[max_spatial_dimensions];
+                std::ptrdiff_t below[max_spatial_dimensions];
+                size_t offset = max_spatial_dimensions - n_spatial_dimensions;
+                for (size_t i = 0; i < max_spatial_dimensions; i++)
+                {
+                    bool real = i >= offset;
+                    size_t axis = i - offset;
+                    in_dims[i] = real ? arg0_shape[2 + axis] : 1;
+                    filter_dims[i] = real ? arg1_shape[2 + axis] : 1;
+                    out_dims[i] = real ? out_shape[2 + axis] : 1;
+                    movement[i] = real ? window_movement_strides[axis] : 1;
+                    dilation[i] = real ? window_dilation_strides[axis] : 1;
+                    below[i] = real ? padding_below[axis] : 0;
+                }
+
+                // Range of output positions along one axis whose input position for filter
+                // tap f falls inside the data
+                auto valid_range = [&](size_t axis, size_t f, size_t& lo, size_t& hi) {
+                    std::ptrdiff_t start = static_cast<std::ptrdiff_t>(f) * dilation[axis] -
+                                           below[axis];
+                    std::ptrdiff_t size = in_dims[axis];
+                    std::ptrdiff_t step = movement[axis];
+                    std::ptrdiff_t first = start >= 0 ? 0 : (-start + step - 1) / step;
+                    std::ptrdiff_t last = start >= size ? 0 : (size - 1 - start) / step + 1;
+                    lo = static_cast<size_t>(std::min<std::ptrdiff_t>(first, out_dims[axis]));
+                    hi = static_cast<size_t>(std::min<std::ptrdiff_t>(last, out_dims[axis]));
+                };
+
+                size_t batch_size = arg0_shape[0];
+                size_t input_channels = arg0_shape[1];
+                size_t output_channels = arg1_shape[0];
+                size_t in_plane = in_dims[0] * in_dims[1] * in_dims[2];
+                size_t filter_plane = filter_dims[0] * filter_dims[1] * filter_dims[2];
+                size_t out_plane = out_dims[0] * out_dims[1] * out_dims[2];
+
+                std::fill(out, out + batch_size * output_channels * out_plane, T(0));
+
+                for (size_t n = 0; n < batch_size; n++)
+                {
+                    for (size_t oc = 0; oc < output_channels; oc++)
+                    {
+                        T* out_channel = out + (n * output_channels + oc) * out_plane;
+                        for (size_t ic = 0; ic < input_channels; ic++)
+                        {
+                            const T* in_channel = arg0 + (n * input_channels + ic) * in_plane;
+                            const T* filter =
+                                arg1 + (oc * input_channels + ic) * filter_plane;
+                            for (size_t fd = 0; fd < filter_dims[0]; fd++)
+                            {
+                                size_t od_lo, od_hi;
+                                valid_range(0, fd, od_lo, od_hi);
+                                for (size_t fh = 0; fh < filter_dims[1]; fh++)
+                                {
+                                    size_t oh_lo, oh_hi;
+                                    valid_range(1, fh, oh_lo, oh_hi);
+                                    for (size_t fw = 0; fw < filter_dims[2]; fw++)
+                                    {
+                                        size_t ow_lo, ow_hi;
+                                        valid_range(2, fw, ow_lo, ow_hi);
+                                        size_t filter_index =
+                                            rotate_filter
+                                                ? ((filter_dims[0] - fd - 1) * filter_dims[1] +
+                                                   (filter_dims[1] - fh - 1)) *
+                                                          filter_dims[2] +
+                                                      (filter_dims[2] - fw - 1)
+                                                : (fd * filter_dims[1] + fh) * filter_dims[2] + fw;
+                                        const T w = filter[filter_index];
+                                        for (size_t od = od_lo; od < od_hi; od++)
+                                        {
+                                            size_t id = od * movement[0] + fd * dilation[0] -
+                                                        below[0];
+                                            for (size_t oh = oh_lo; oh < oh_hi; oh++)
+                                            {
+                                                size_t ih = oh * movement[1] +
+                                                            fh * dilation[1] - below[1];
+                                                const T* in_row =
+                                                    in_channel + (id * in_dims[1] + ih) * in_dims[2];
+                                                T* out_row =
+                                                    out_channel + (od * out_dims[1] + oh) * out_dims[2];
+                                                size_t iw = ow_lo * movement[2] + fw * dilation[2] -
+                                                            below[2];
+                                                if (movement[2] == 1)
+                                                {
+                                                    std::ptrdiff_t shift =
+                                                        static_cast<std::ptrdiff_t>(iw - ow_lo);
+                                                    for (size_t ow = ow_lo; ow < ow_hi; ow++)
+                                                    {
+                                                        out_row[ow] +=
+                                                            w * in_row[static_cast<std::ptrdiff_t>(ow) +
+                                                                       shift];
+                                                    }
+                                                }
+                                                else
+                                                {
+                                                    for (size_t ow = ow_lo; ow < ow_hi;
+                                                         ow++, iw += movement[2])
+                                                    {
+                                                        out_row[ow] += w * in_row[iw];
+                                                    }
+                                                }
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+                return true;
+            }
+
             template <typename T>
             void convolution(const T* arg0,
                              const T* arg1,
@@ -48,6 +200,27 @@ namespace ngraph
                              size_t output_channel_axis_result,
                              bool rotate_filter)
             {
+                // The direct path accumulates in the output buffer, so bfloat16 convolutions
+                // take the generic path below, which sums in float.
+                if (!std::is_same<T, bfloat16>::value && batch_axis_data == 0 &&
+                    input_channel_axis_data == 1 &&
+                    input_channel_axis_filters == 1 && output_channel_axis_filters == 0 &&
+                    batch_axis_result == 0 && output_channel_axis_result == 1 &&
+                    convolution_direct(arg0,
+                                       arg1,
+                                       out,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       out_shape,
+                                       window_movement_strides,
+                                       window_dilation_strides,
+                                       padding_below,
+                                       data_dilation_strides,
+                                       rotate_filter))
+                {
+                    return;
+                }
+
                 // Comments throughout assume without loss of generality that:
                 //
                 // * batch axes for both input data and output data are 0
@@ -165,7 +338,8 @@ namespace ngraph
                     //
                     //   output[O] += arg0[I] * arg1[F].
 
-                    T result = 0;
+                    typename std::conditional<std::is_same<T, bfloat16>::value, float, T>::type
+                        result = 0;
 
                     CoordinateTransform::Iterator input_it = input_batch_transform.begin();
                     CoordinateTransform::Iterator filter_it = filter_transform.begin();
@@ -190,7 +364,7 @@ namespace ngraph
 
                         T v = input_batch_transform.has_source_coordinate(input_batch_coord)
                                   ? arg0[input_batch_transform.index(input_batch_coord)]
-                                  : 0;
+                                  : T(0);
 
                         result += v * arg1[filter_transform.index(filter_coord)];
 
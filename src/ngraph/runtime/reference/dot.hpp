@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
+#include <vector>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/bfloat16.hpp"
 
 namespace ngraph
 {
@@ -27,6 +30,11 @@ namespace ngraph
     {
         namespace reference
         {
+            // Row-major arg0 is an (M x K) matrix and arg1 a (K x N) matrix once the dotted axes
+            // are flattened, so any dot is a single matrix product. Tiles of arg1 are reused
+            // across a block of output rows and the innermost loop runs over contiguous memory
+            // so the compiler can vectorize it. The partial sums for an output element are still
+            // accumulated in increasing K order.
             template <typename T>
             void dot(const T* arg0,
                      const T* arg1,
@@ -36,86 +44,81 @@ namespace ngraph
                      const Shape& out_shape,
                      size_t reduction_axes_count)
             {
-                // Get the sizes of the dot axes. It's easiest to pull them from arg1 because they're
-                // right up front.
-                Shape dot_axis_sizes(reduction_axes_count);
-                std::copy(arg1_shape.begin(),
-                          arg1_shape.begin() + reduction_axes_count,
-                          dot_axis_sizes.begin());
+                constexpr size_t block_m = 32;
+                constexpr size_t block_k = 128;
+                constexpr size_t block_n = 256;
 
-                CoordinateTransform arg0_transform(arg0_shape);
-                CoordinateTransform arg1_transform(arg1_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                // Create coordinate transforms for arg0 and arg1 that throw away the dotted axes.
                 size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
-                size_t arg1_projected_rank = arg1_shape.size() - reduction_axes_count;
-
-                Shape arg0_projected_shape(arg0_projected_rank);
-                std::copy(arg0_shape.begin(),
-                          arg0_shape.begin() + arg0_projected_rank,
-                          arg0_projected_shape.begin());
-
-                Shape arg1_projected_shape(arg1_projected_rank);
-                std::copy(arg1_shape.begin() + reduction_axes_count,
-                          arg1_shape.end(),
-                          arg1_projected_shape.begin());
 
-                CoordinateTransform arg0_projected_transform(arg0_projected_shape);
-                CoordinateTransform arg1_projected_transform(arg1_projected_shape);
+                size_t m = 1;
+                for (size_t i = 0; i < arg0_projected_rank; i++)
+                {
+                    m *= arg0_shape[i];
+                }
+                size_t k = 1;
+                for (size_t i = 0; i < reduction_axes_count; i++)
+                {
+                    k *= arg1_shape[i];
+                }
+                size_t n = 1;
+                for (size_t i = reduction_axes_count; i < arg1_shape.size(); i++)
+                {
+                    n *= arg1_shape[i];
+                }
 
-                // Create a coordinate transform that allows us to iterate over all possible values
-                // for the dotted axes.
-                CoordinateTransform dot_axes_transform(dot_axis_sizes);
+                std::fill(out, out + m * n, T(0));
 
-                for (const Coordinate& arg0_projected_coord : arg0_projected_transform)
+                for (size_t i0 = 0; i0 < m; i0 += block_m)
                 {
-                    for (const Coordinate& arg1_projected_coord : arg1_projected_transform)
+                    size_t i1 = std::min(i0 + block_m, m);
+                    for (size_t k0 = 0; k0 < k; k0 += block_k)
                     {
-                        // The output coordinate is just the concatenation of the projected coordinates.
-                        Coordinate out_coord(arg0_projected_coord.size() +
-                                             arg1_projected_coord.size());
-
-                        auto out_coord_it = std::copy(arg0_projected_coord.begin(),
-                                                      arg0_projected_coord.end(),
-                                                      out_coord.begin());
-                        std::copy(
-                            arg1_projected_coord.begin(), arg1_projected_coord.end(), out_coord_it);
-
-                        // Zero out to start the sum.
-                        T sum = 0;
-
-                        size_t out_index = output_transform.index(out_coord);
-
-                        // Walk along the dotted axes.
-                        Coordinate arg0_coord(arg0_shape.size());
-                        Coordinate arg1_coord(arg1_shape.size());
-                        auto arg0_it = std::copy(arg0_projected_coord.begin(),
-                                                 arg0_projected_coord.end(),
-                                                 arg0_coord.begin());
-                        for (const Coordinate& dot_axis_positions : dot_axes_transform)
+                        size_t k1 = std::min(k0 + block_k, k);
+                        for (size_t j0 = 0; j0 < n; j0 += block_n)
                         {
-                            // In order to find the points to multiply together, we need to inject our current
-                            // positions along the dotted axes back into the projected arg0 and arg1 coordinates.
-                            std::copy(
-                                dot_axis_positions.begin(), dot_axis_positions.end(), arg0_it);
-
-                            auto arg1_it = std::copy(dot_axis_positions.begin(),
-                                                     dot_axis_positions.end(),
-                                                     arg1_coord.begin());
-                            std::copy(
-                                arg1_projected_coord.begin(), arg1_projected_coord.end(), arg1_it);
-
-                            // Multiply and add to the sum.
-                            sum += arg0[arg0_transform.index(arg0_coord)] *
-                                   arg1[arg1_transform.index(arg1_coord)];
+                            size_t j1 = std::min(j0 + block_n, n);
+                            for (size_t i = i0; i < i1; i++)
+                            {
+                                const T* arg0_row = arg0 + i * k;
+                                T* out_row = out + i * n;
+                                for (size_t kk = k0; kk < k1; kk++)
+                                {
+                                    const T a = arg0_row[kk];
+                                    const T* arg1_row = arg1 + kk * n;
+                                    for (size_t j = j0; j < j1; j++)
+                                    {
+                                        out_row[j] += a * arg1_row[j];
+                                    }
+                                }
+                            }
                         }
-
-                        // Write the sum back.
-                        out[out_index] = sum;
                     }
                 }
             }
+
+            // Accumulating into a bfloat16 output would round every partial sum, so bfloat16
+            // dots are computed in float and rounded once per output element.
+            template <>
+            inline void dot<bfloat16>(const bfloat16* arg0,
+                                      const bfloat16* arg1,
+                                      bfloat16* out,
+                                      const Shape& arg0_shape,
+                                      const Shape& arg1_shape,
+                                      const Shape& out_shape,
+                                      size_t reduction_axes_count)
+            {
+                std::vector<float> float_arg0(arg0, arg0 + shape_size(arg0_shape));
+                std::vector<float> float_arg1(arg1, arg1 + shape_size(arg1_shape));
+                std::vector<float> float_out(shape_size(out_shape));
+                dot<float>(float_arg0.data(),
+                           float_arg1.data(),
+                           float_out.data(),
+                           arg0_shape,
+                           arg1_shape,
+                           out_shape,
+                           reduction_axes_count);
+                std::copy(float_out.begin(), float_out.end(), out);
+            }
         }
     }
 }
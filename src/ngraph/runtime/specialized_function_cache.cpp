@@ -0,0 +1,332 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <typeinfo>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/runtime/specialized_function_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Above this many entries the output shape cache is cleared instead of growing further
+static const size_t s_max_output_shapes = 1024;
+
+// Copies the elements that src and dst share in their leading corner. Both are row-major.
+static void copy_corner(const char* src,
+                        const Shape& src_shape,
+                        char* dst,
+                        const Shape& dst_shape,
+                        size_t element_size)
+{
+    if (src_shape.empty())
+    {
+        memcpy(dst, src, element_size);
+        return;
+    }
+    Strides src_strides = row_major_strides(src_shape);
+    Strides dst_strides = row_major_strides(dst_shape);
+    size_t rank = src_shape.size();
+    size_t row_size = min(src_shape[rank - 1], dst_shape[rank - 1]) * element_size;
+    function<void(size_t, const char*, char*)> copy_axis = [&](
+        size_t axis, const char* src_base, char* dst_base) {
+        if (axis == rank - 1)
+        {
+            memcpy(dst_base, src_base, row_size);
+            return;
+        }
+        for (size_t i = 0; i < min(src_shape[axis], dst_shape[axis]); i++)
+        {
+            copy_axis(axis + 1,
+                      src_base + i * src_strides[axis] * element_size,
+                      dst_base + i * dst_strides[axis] * element_size);
+        }
+    };
+    copy_axis(0, src, dst);
+}
+
+static size_t round_up_to_power_of_two(size_t n)
+{
+    size_t rc = 1;
+    while (rc < n)
+    {
+        rc <<= 1;
+    }
+    return rc;
+}
+
+runtime::SpecializedFunctionCache::SpecializedFunctionCache(
+    const shared_ptr<Backend>& backend,
+    const shared_ptr<Function>& function,
+    const vector<PartialShape>& parameter_shapes,
+    size_t capacity,
+    bool pad_to_power_of_two)
+    : m_backend(backend)
+    , m_function(function)
+    , m_parameter_shapes(parameter_shapes)
+    , m_capacity(capacity)
+    , m_pad_to_power_of_two(pad_to_power_of_two)
+{
+    const op::ParameterVector& parameters = m_function->get_parameters();
+    if (m_parameter_shapes.size() != parameters.size())
+    {
+        stringstream ss;
+        ss << "Got " << m_parameter_shapes.size() << " parameter shapes for a Function with "
+           << parameters.size() << " parameters";
+        throw ngraph_error(ss.str());
+    }
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        if (!m_parameter_shapes[i].rank_is_determined() ||
+            !m_parameter_shapes[i].compatible(parameters[i]->get_shape()))
+        {
+            stringstream ss;
+            ss << "Parameter shape " << m_parameter_shapes[i] << " is not compatible with shape "
+               << parameters[i]->get_shape() << " of parameter " << i;
+            throw ngraph_error(ss.str());
+        }
+    }
+    if (m_capacity == 0)
+    {
+        throw ngraph_error("SpecializedFunctionCache capacity must be at least 1");
+    }
+}
+
+runtime::SpecializedFunctionCache::Specialization::~Specialization()
+{
+    backend->remove_compiled_function(function);
+}
+
+shared_ptr<Function>
+    runtime::SpecializedFunctionCache::specialize(const vector<Shape>& input_shapes) const
+{
+    NodeMap node_map;
+    const op::ParameterVector& parameters = m_function->get_parameters();
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        node_map.add(parameters[i],
+                     make_shared<op::Parameter>(parameters[i]->get_element_type(),
+                                                input_shapes[i],
+                                                parameters[i]->get_cacheable()));
+    }
+    // Constants are views of the data of the original ones, which they keep alive
+    for (auto& node : m_function->get_ops())
+    {
+        if (typeid(*node) == typeid(op::Constant))
+        {
+            auto constant = static_pointer_cast<op::Constant>(node);
+            node_map.add(constant,
+                         make_shared<op::Constant>(
+                             constant->get_element_type(),
+                             constant->get_shape(),
+                             constant->get_data_ptr(),
+                             shared_ptr<const void>(constant, constant->get_data_ptr())));
+        }
+    }
+    return clone_function(*m_function, node_map);
+}
+
+void runtime::SpecializedFunctionCache::check_input_shapes(const vector<Shape>& input_shapes) const
+{
+    if (input_shapes.size() != m_parameter_shapes.size())
+    {
+        stringstream ss;
+        ss << "Got " << input_shapes.size() << " inputs for a Function with "
+           << m_parameter_shapes.size() << " parameters";
+        throw ngraph_error(ss.str());
+    }
+    for (size_t i = 0; i < input_shapes.size(); i++)
+    {
+        if (!m_parameter_shapes[i].compatible(input_shapes[i]))
+        {
+            stringstream ss;
+            ss << "Input " << i << " shape " << input_shapes[i] << " is not compatible with "
+               << m_parameter_shapes[i];
+            throw ngraph_error(ss.str());
+        }
+    }
+}
+
+vector<Shape>
+    runtime::SpecializedFunctionCache::get_bucket_shapes(const vector<Shape>& input_shapes) const
+{
+    if (!m_pad_to_power_of_two)
+    {
+        return input_shapes;
+    }
+    vector<Shape> bucket_shapes = input_shapes;
+    for (size_t i = 0; i < bucket_shapes.size(); i++)
+    {
+        for (size_t axis = 0; axis < bucket_shapes[i].size(); axis++)
+        {
+            if (!m_parameter_shapes[i][axis].is_determined())
+            {
+                bucket_shapes[i][axis] = round_up_to_power_of_two(bucket_shapes[i][axis]);
+            }
+        }
+    }
+    return bucket_shapes;
+}
+
+vector<Shape>
+    runtime::SpecializedFunctionCache::get_output_shapes(const vector<Shape>& input_shapes)
+{
+    lock_guard<mutex> lock(m_mutex);
+    check_input_shapes(input_shapes);
+
+    auto it = m_specializations.find(input_shapes);
+    if (it == m_specializations.end())
+    {
+        auto shapes = m_output_shapes.find(input_shapes);
+        if (shapes != m_output_shapes.end())
+        {
+            return shapes->second;
+        }
+    }
+
+    // Shape inference alone, the specialization is compiled by the first call
+    shared_ptr<Function> function =
+        it != m_specializations.end() ? it->second->function : specialize(input_shapes);
+    vector<Shape> output_shapes;
+    for (size_t i = 0; i < function->get_output_size(); i++)
+    {
+        output_shapes.push_back(function->get_output_shape(i));
+    }
+    if (m_output_shapes.size() >= s_max_output_shapes)
+    {
+        m_output_shapes.clear();
+    }
+    m_output_shapes[input_shapes] = output_shapes;
+    return output_shapes;
+}
+
+shared_ptr<runtime::SpecializedFunctionCache::Specialization>
+    runtime::SpecializedFunctionCache::get_specialization(const vector<Shape>& bucket_shapes)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_specializations.find(bucket_shapes);
+    if (it != m_specializations.end())
+    {
+        m_lru.splice(m_lru.begin(), m_lru, it->second->lru_position);
+        return it->second;
+    }
+
+    if (m_specializations.size() >= m_capacity)
+    {
+        m_specializations.erase(m_lru.back());
+        m_lru.pop_back();
+    }
+
+    auto specialization = make_shared<Specialization>();
+    specialization->backend = m_backend;
+    specialization->function = specialize(bucket_shapes);
+    m_backend->compile(specialization->function);
+    m_compile_count++;
+    m_lru.push_front(bucket_shapes);
+    specialization->lru_position = m_lru.begin();
+    m_specializations.emplace(bucket_shapes, specialization);
+    return specialization;
+}
+
+bool runtime::SpecializedFunctionCache::call(const vector<shared_ptr<Tensor>>& outputs,
+                                             const vector<shared_ptr<Tensor>>& inputs)
+{
+    vector<Shape> input_shapes;
+    for (auto& input : inputs)
+    {
+        input_shapes.push_back(input->get_shape());
+    }
+    check_input_shapes(input_shapes);
+    vector<Shape> bucket_shapes = get_bucket_shapes(input_shapes);
+    if (bucket_shapes == input_shapes)
+    {
+        auto specialization = get_specialization(bucket_shapes);
+        return m_backend->call_with_validate(specialization->function, outputs, inputs);
+    }
+
+    vector<Shape> output_shapes = get_output_shapes(input_shapes);
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (outputs[i]->get_shape() != output_shapes.at(i))
+        {
+            stringstream ss;
+            ss << "Output " << i << " shape " << outputs[i]->get_shape() << " does not match "
+               << output_shapes[i];
+            throw ngraph_error(ss.str());
+        }
+    }
+
+    // Zero padded copies of the inputs and outputs are made per call, so that concurrent calls
+    // of one specialization do not share them
+    auto specialization = get_specialization(bucket_shapes);
+    const shared_ptr<Function>& function = specialization->function;
+    vector<shared_ptr<Tensor>> padded_inputs;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        auto& parameter = function->get_parameters().at(i);
+        auto padded =
+            m_backend->create_tensor(parameter->get_element_type(), parameter->get_shape());
+        size_t element_size = inputs[i]->get_element_type().size();
+        vector<char> input(inputs[i]->get_size_in_bytes());
+        vector<char> padded_input(padded->get_size_in_bytes(), 0);
+        inputs[i]->read(input.data(), 0, input.size());
+        copy_corner(input.data(),
+                    input_shapes[i],
+                    padded_input.data(),
+                    bucket_shapes[i],
+                    element_size);
+        padded->write(padded_input.data(), 0, padded_input.size());
+        padded_inputs.push_back(padded);
+    }
+    vector<shared_ptr<Tensor>> padded_outputs;
+    for (size_t i = 0; i < function->get_output_size(); i++)
+    {
+        padded_outputs.push_back(m_backend->create_tensor(function->get_output_element_type(i),
+                                                          function->get_output_shape(i)));
+    }
+    bool rc = m_backend->call_with_validate(function, padded_outputs, padded_inputs);
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        auto& padded = padded_outputs[i];
+        vector<char> padded_output(padded->get_size_in_bytes());
+        vector<char> output(outputs[i]->get_size_in_bytes());
+        padded->read(padded_output.data(), 0, padded_output.size());
+        copy_corner(padded_output.data(),
+                    padded->get_shape(),
+                    output.data(),
+                    output_shapes[i],
+                    outputs[i]->get_element_type().size());
+        outputs[i]->write(output.data(), 0, output.size());
+    }
+    return rc;
+}
+
+size_t runtime::SpecializedFunctionCache::get_cached_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_specializations.size();
+}
+
+size_t runtime::SpecializedFunctionCache::get_compile_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_compile_count;
+}
@@ -0,0 +1,118 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/partial_shape.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class SpecializedFunctionCache;
+    }
+}
+
+/// \brief Executes a Function on inputs whose shapes vary from call to call, compiling one
+///        specialization of the Function per input shape.
+///
+/// Parameters of a Function always have static shapes, so the Function is built with example
+/// shapes and parameter_shapes marks the dimensions that may vary with
+/// Dimension::undetermined(). A call with new input shapes clones the Function with those
+/// shapes, which re-runs shape inference, and compiles the clone. Ops whose attributes depend
+/// on a varying dimension, such as the output shape of a Reshape, fail to specialize.
+///
+/// Specializations share the data of the Function's constants and the least recently used one
+/// is evicted when more than capacity are compiled. With pad_to_power_of_two the varying
+/// dimensions are rounded up to a power of two, so for example batch sizes 5 to 8 share one
+/// specialization. Inputs are padded with zeros and outputs are cut back to the shapes the
+/// inputs would have produced, which is only correct when every output element depends only on
+/// input elements at the same position along the padded dimensions, as for the batch dimension
+/// of an inference graph.
+class ngraph::runtime::SpecializedFunctionCache
+{
+public:
+    /// \param backend The backend that compiles and executes the specializations.
+    /// \param function The Function to specialize, built with example input shapes.
+    /// \param parameter_shapes For each parameter of function, its shape with the dimensions
+    ///        that may vary undetermined. Determined dimensions must match function.
+    /// \param capacity The maximum number of compiled specializations kept.
+    /// \param pad_to_power_of_two Round varying dimensions up to a power of two.
+    SpecializedFunctionCache(const std::shared_ptr<Backend>& backend,
+                             const std::shared_ptr<Function>& function,
+                             const std::vector<PartialShape>& parameter_shapes,
+                             size_t capacity = 8,
+                             bool pad_to_power_of_two = false);
+
+    SpecializedFunctionCache(const SpecializedFunctionCache&) = delete;
+    SpecializedFunctionCache& operator=(const SpecializedFunctionCache&) = delete;
+
+    /// \brief Returns the shapes of the outputs a call with inputs of input_shapes produces
+    std::vector<Shape> get_output_shapes(const std::vector<Shape>& input_shapes);
+
+    /// \brief Executes the specialization for the shapes of inputs, compiling it first if it
+    ///     is not cached. Only the lookup and compilation are serialized, calls of the backend
+    ///     may run concurrently.
+    /// \param outputs Tensors with the shapes returned by get_output_shapes.
+    /// \param inputs Tensors matching the parameters of the Function.
+    /// \returns true if the call is successful, false otherwise
+    bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
+              const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    /// \brief Returns the number of compiled specializations currently cached
+    size_t get_cached_count() const;
+    /// \brief Returns the number of specializations compiled so far, including evicted ones
+    size_t get_compile_count() const;
+
+private:
+    /// \brief A compiled specialization. It is removed from the backend when the last call
+    ///     using it returns, so evicting it does not disturb calls in flight.
+    struct Specialization
+    {
+        ~Specialization();
+        std::shared_ptr<Backend> backend;
+        std::shared_ptr<Function> function;
+        std::list<std::vector<Shape>>::iterator lru_position;
+    };
+
+    std::shared_ptr<Function> specialize(const std::vector<Shape>& input_shapes) const;
+    void check_input_shapes(const std::vector<Shape>& input_shapes) const;
+    std::vector<Shape> get_bucket_shapes(const std::vector<Shape>& input_shapes) const;
+    std::shared_ptr<Specialization> get_specialization(const std::vector<Shape>& bucket_shapes);
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Function> m_function;
+    std::vector<PartialShape> m_parameter_shapes;
+    size_t m_capacity;
+    bool m_pad_to_power_of_two;
+    size_t m_compile_count{0};
+    // Specializations by the shapes of their inputs, most recently used first in m_lru
+    std::map<std::vector<Shape>, std::shared_ptr<Specialization>> m_specializations;
+    std::list<std::vector<Shape>> m_lru;
+    // Output shapes by input shapes, only needed when padding
+    std::map<std::vector<Shape>, std::vector<Shape>> m_output_shapes;
+    mutable std::mutex m_mutex;
+};
@@ -20,6 +20,7 @@
 #include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/mapped_file.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
@@ -203,7 +204,11 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
                                uint32_t size =
                                    static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
                                                          c->get_output_element_type(0).size());
-                               writer.write(c->get_name(), c->get_data_ptr(), size);
+                               // Aligned so that deserialize_mapped can use the data in place
+                               writer.write(c->get_name(),
+                                            c->get_data_ptr(),
+                                            size,
+                                            c->get_output_element_type(0).size());
                            }
                        },
                        true);
@@ -241,6 +246,80 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+using ConstantReader = function<shared_ptr<Node>(
+    const cpio::FileInfo& info, const element::Type& et, const Shape& shape)>;
+
+// Builds the Functions of a CPIO archive from its json model. Constant data files are turned
+// into nodes by read_constant.
+static shared_ptr<Function> read_cpio_model(const string& model,
+                                            const vector<cpio::FileInfo>& file_info,
+                                            const ConstantReader& read_constant)
+{
+    shared_ptr<Function> rc;
+    json js = json::parse(model);
+    unordered_map<string, shared_ptr<Function>> function_map;
+    for (json func : js)
+    {
+        shared_ptr<Function> f = read_function(
+            func,
+            function_map,
+            [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                shared_ptr<Node> const_node;
+                for (const cpio::FileInfo& info : file_info)
+                {
+                    if (info.get_name() == const_name)
+                    {
+                        const_node = read_constant(info, et, shape);
+                        break;
+                    }
+                }
+                return const_node;
+            });
+        rc = f;
+    }
+    return rc;
+}
+
+namespace
+{
+    // Exposes a MappedFile as a std::istream without copying it
+    class mapped_file_buffer : public std::streambuf
+    {
+    public:
+        mapped_file_buffer(const MappedFile& file)
+        {
+            char* begin = const_cast<char*>(file.get_data());
+            setg(begin, begin, begin + file.size());
+        }
+
+    protected:
+        pos_type seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which) override
+        {
+            char* base = eback();
+            if (dir == ios_base::cur)
+            {
+                base = gptr();
+            }
+            else if (dir == ios_base::end)
+            {
+                base = egptr();
+            }
+            char* target = base + off;
+            if (target < eback() || target > egptr())
+            {
+                return pos_type(off_type(-1));
+            }
+            setg(eback(), target, egptr());
+            return pos_type(target - eback());
+        }
+
+        pos_type seekpos(pos_type pos, ios_base::openmode which) override
+        {
+            return seekoff(off_type(pos), ios_base::beg, which);
+        }
+    };
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
@@ -256,30 +335,16 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
             reader.read(file_info[0].get_name(), data, size);
             string jstr(data, size);
             delete[] data;
-            json js = json::parse(jstr);
-            unordered_map<string, shared_ptr<Function>> function_map;
-            for (json func : js)
-            {
-                shared_ptr<Function> f = read_function(
-                    func,
-                    function_map,
-                    [&](const string& const_name, const element::Type& et, const Shape& shape) {
-                        shared_ptr<Node> const_node;
-                        for (const cpio::FileInfo& info : file_info)
-                        {
-                            if (info.get_name() == const_name)
-                            {
-                                void* const_data = malloc(info.get_size());
-                                reader.read(const_name, const_data, info.get_size());
-                                const_node = make_shared<op::Constant>(et, shape, const_data);
-                                free(const_data);
-                                break;
-                            }
-                        }
-                        return const_node;
-                    });
-                rc = f;
-            }
+            rc = read_cpio_model(
+                jstr,
+                file_info,
+                [&](const cpio::FileInfo& info, const element::Type& et, const Shape& shape) {
+                    void* const_data = malloc(info.get_size());
+                    reader.read(info.get_name(), const_data, info.get_size());
+                    auto const_node = make_shared<op::Constant>(et, shape, const_data);
+                    free(const_data);
+                    return const_node;
+                });
         }
     }
     else
@@ -292,6 +357,48 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
     return rc;
 }
 
+shared_ptr<ngraph::Function> ngraph::deserialize_mapped(const string& path)
+{
+    auto file = make_shared<MappedFile>(path);
+    mapped_file_buffer buffer(*file);
+    istream in(&buffer);
+    if (!cpio::is_cpio(in))
+    {
+        // Constants of a json model are parsed from text, there is nothing to map
+        return deserialize(in);
+    }
+
+    shared_ptr<Function> rc;
+    cpio::Reader reader(in);
+    vector<cpio::FileInfo> file_info = reader.get_file_info();
+    if (file_info.size() > 0)
+    {
+        // The first file is the model
+        string jstr(file->get_data() + file_info[0].get_offset(), file_info[0].get_size());
+        rc = read_cpio_model(
+            jstr,
+            file_info,
+            [&](const cpio::FileInfo& info, const element::Type& et, const Shape& shape) {
+                const char* const_data = file->get_data() + info.get_offset();
+                if (info.get_offset() + info.get_size() > file->size() ||
+                    info.get_size() != shape_size(shape) * et.size())
+                {
+                    throw ngraph_error("Constant '" + info.get_name() + "' in '" + path +
+                                       "' does not match its shape and element type");
+                }
+                // Archives written before constants were aligned may have misaligned data,
+                // which is copied
+                if (reinterpret_cast<uintptr_t>(const_data) % et.size() != 0)
+                {
+                    return make_shared<op::Constant>(et, shape, const_data);
+                }
+                return make_shared<op::Constant>(
+                    et, shape, const_data, shared_ptr<const void>(file, const_data));
+            });
+    }
+    return rc;
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
 {
     shared_ptr<Function> rc;
@@ -398,6 +505,21 @@ static shared_ptr<ngraph::Function>
                 node = make_shared<op::AllReduce>(args[0]);
                 break;
             }
+            case OP_TYPEID::AllReduceStart:
+            {
+                node = make_shared<op::AllReduceStart>(args);
+                break;
+            }
+            case OP_TYPEID::AllReduceWait:
+            {
+                vector<Shape> shapes;
+                for (auto shape : node_js.at("shapes").get<vector<vector<size_t>>>())
+                {
+                    shapes.push_back(shape);
+                }
+                node = make_shared<op::AllReduceWait>(args[0], shapes);
+                break;
+            }
             case OP_TYPEID::And:
             {
                 node = make_shared<op::And>(args[0], args[1]);
@@ -1163,6 +1285,19 @@ static json write(const Node& n, bool binary_constant_data)
     }
     case OP_TYPEID::AllReduce: { break;
     }
+    case OP_TYPEID::AllReduceStart: { break;
+    }
+    case OP_TYPEID::AllReduceWait:
+    {
+        auto tmp = dynamic_cast<const op::AllReduceWait*>(&n);
+        vector<vector<size_t>> shapes;
+        for (const Shape& shape : tmp->get_shapes())
+        {
+            shapes.push_back(shape);
+        }
+        node["shapes"] = shapes;
+        break;
+    }
     case OP_TYPEID::And: { break;
     }
     case OP_TYPEID::Asin: { break;
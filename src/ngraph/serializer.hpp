@@ -55,4 +55,13 @@ namespace ngraph
     /// \brief Deserialize a Function
     /// \param str The json formatted string to deseriailze.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
+
+    /// \brief Deserialize a Function from a file without copying its constant data
+    ///
+    /// The file is memory mapped and the Constants of a CPIO file are read-only views into the
+    /// mapping, so processes loading the same file share its pages. The mapping is released
+    /// when the last Constant referencing it is destroyed; the file must not be modified or
+    /// truncated until then.
+    /// \param path The path of a CPIO or json file written by serialize.
+    std::shared_ptr<ngraph::Function> deserialize_mapped(const std::string& path);
 }
@@ -0,0 +1,124 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace ngraph
+{
+    /// \brief A 16 bit floating point number with the 8 bit exponent of a float and 8 bits of
+    ///        precision. The bits of a bfloat16 are the upper half of the bits of the float it
+    ///        rounds to.
+    ///
+    /// Arithmetic is done by converting to float, so expressions on bfloat16 values compute in
+    /// float and only round when they are stored back to a bfloat16.
+    class bfloat16
+    {
+    public:
+        bfloat16() = default;
+        bfloat16(float value)
+            : m_value(round_to_nearest_even(value))
+        {
+        }
+
+        operator float() const
+        {
+            uint32_t bits = static_cast<uint32_t>(m_value) << 16;
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        /// \brief Returns the bfloat16 with the given bits
+        static bfloat16 from_bits(uint16_t bits)
+        {
+            bfloat16 rc;
+            rc.m_value = bits;
+            return rc;
+        }
+        uint16_t to_bits() const { return m_value; }
+        bfloat16 operator-() const { return from_bits(m_value ^ 0x8000); }
+        bfloat16& operator+=(float value) { return *this = *this + value; }
+        bfloat16& operator-=(float value) { return *this = *this - value; }
+        bfloat16& operator*=(float value) { return *this = *this * value; }
+        bfloat16& operator/=(float value) { return *this = *this / value; }
+    private:
+        static uint16_t round_to_nearest_even(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            if (std::isnan(value))
+            {
+                // Keep the sign and make sure truncating does not turn the NaN into infinity
+                return static_cast<uint16_t>((bits >> 16) | 0x0040);
+            }
+            uint32_t lsb = (bits >> 16) & 1;
+            bits += 0x7FFF + lsb;
+            return static_cast<uint16_t>(bits >> 16);
+        }
+
+        uint16_t m_value{0};
+    };
+
+    std::ostream& operator<<(std::ostream& out, const bfloat16& value);
+}
+
+namespace std
+{
+    template <>
+    class numeric_limits<ngraph::bfloat16>
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = false;
+        static constexpr bool has_infinity = true;
+        static constexpr bool has_quiet_NaN = true;
+        static constexpr bool has_signaling_NaN = true;
+        static constexpr float_denorm_style has_denorm = denorm_present;
+        static constexpr bool has_denorm_loss = false;
+        static constexpr float_round_style round_style = round_to_nearest;
+        static constexpr bool is_iec559 = false;
+        static constexpr bool is_bounded = true;
+        static constexpr bool is_modulo = false;
+        static constexpr int digits = 8;
+        static constexpr int digits10 = 2;
+        static constexpr int max_digits10 = 4;
+        static constexpr int radix = 2;
+        static constexpr int min_exponent = numeric_limits<float>::min_exponent;
+        static constexpr int min_exponent10 = numeric_limits<float>::min_exponent10;
+        static constexpr int max_exponent = numeric_limits<float>::max_exponent;
+        static constexpr int max_exponent10 = numeric_limits<float>::max_exponent10;
+        static constexpr bool traps = false;
+        static constexpr bool tinyness_before = false;
+
+        static ngraph::bfloat16 min() { return ngraph::bfloat16::from_bits(0x0080); }
+        static ngraph::bfloat16 max() { return ngraph::bfloat16::from_bits(0x7F7F); }
+        static ngraph::bfloat16 lowest() { return ngraph::bfloat16::from_bits(0xFF7F); }
+        static ngraph::bfloat16 epsilon() { return ngraph::bfloat16::from_bits(0x3C00); }
+        static ngraph::bfloat16 round_error() { return ngraph::bfloat16::from_bits(0x3F00); }
+        static ngraph::bfloat16 infinity() { return ngraph::bfloat16::from_bits(0x7F80); }
+        static ngraph::bfloat16 quiet_NaN() { return ngraph::bfloat16::from_bits(0x7FC0); }
+        static ngraph::bfloat16 signaling_NaN() { return ngraph::bfloat16::from_bits(0x7FA0); }
+        static ngraph::bfloat16 denorm_min() { return ngraph::bfloat16::from_bits(0x0001); }
+    };
+}
@@ -23,6 +23,7 @@ using namespace ngraph;
 
 const element::Type element::unspecified(0, false, false, false, "unspecified");
 const element::Type element::boolean(8, false, true, false, "char");
+const element::Type element::bf16(16, true, true, false, "bfloat16");
 const element::Type element::f32(32, true, true, false, "float");
 const element::Type element::f64(64, true, true, false, "double");
 const element::Type element::i8(8, false, true, true, "int8_t");
@@ -37,6 +38,7 @@ const element::Type element::u64(64, false, false, false, "uint64_t");
 std::vector<const element::Type*> element::Type::get_known_types()
 {
     std::vector<const element::Type*> rc = {&element::boolean,
+                                            &element::bf16,
                                             &element::f32,
                                             &element::f64,
                                             &element::i8,
@@ -126,6 +128,11 @@ namespace ngraph
             return boolean;
         }
         template <>
+        const Type& from<bfloat16>()
+        {
+            return bf16;
+        }
+        template <>
         const Type& from<float>()
         {
             return f32;
@@ -476,6 +476,8 @@ T ngraph::apply_permutation(T input, AxisVector order)
 
 template AxisVector ngraph::apply_permutation<AxisVector>(AxisVector input, AxisVector order);
 template Shape ngraph::apply_permutation<Shape>(Shape input, AxisVector order);
+template Coordinate ngraph::apply_permutation<Coordinate>(Coordinate input, AxisVector order);
+template Strides ngraph::apply_permutation<Strides>(Strides input, AxisVector order);
 
 AxisVector ngraph::get_default_order(const Shape& shape)
 {
@@ -14,10 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
 #include <random>
+#include <thread>
+#include <time.h>
 
 #include "benchmark.hpp"
 #include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -147,59 +156,100 @@ static void random_init(shared_ptr<runtime::Tensor> tv)
     }
 }
 
-vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
-                                                  const string& backend_name,
-                                                  size_t iterations,
-                                                  bool timing_detail,
-                                                  int warmup_iterations,
-                                                  bool copy_data)
+namespace
 {
-    stopwatch timer;
-    timer.start();
-    auto backend = runtime::Backend::create(backend_name);
-    backend->enable_performance_data(f, timing_detail);
-    backend->compile(f);
-    timer.stop();
-    cout.imbue(locale(""));
-    cout << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+    // The tensors of one caller. The host tensors hold the data copied in and out of the
+    // backend tensors when copying data.
+    struct CallTensors
+    {
+        vector<shared_ptr<runtime::HostTensor>> arg_data;
+        vector<shared_ptr<runtime::Tensor>> args;
+        vector<shared_ptr<runtime::HostTensor>> result_data;
+        vector<shared_ptr<runtime::Tensor>> results;
+    };
+}
 
-    vector<shared_ptr<runtime::HostTensor>> arg_data;
-    vector<shared_ptr<runtime::Tensor>> args;
-    vector<bool> args_cacheable;
+static CallTensors create_call_tensors(runtime::Backend& backend, shared_ptr<Function> f)
+{
+    CallTensors tensors;
     for (shared_ptr<op::Parameter> param : f->get_parameters())
     {
-        auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+        auto tensor = backend.create_tensor(param->get_element_type(), param->get_shape());
         auto tensor_data =
             make_shared<runtime::HostTensor>(param->get_element_type(), param->get_shape());
         random_init(tensor);
-        args.push_back(tensor);
-        arg_data.push_back(tensor_data);
-        args_cacheable.push_back(param->get_cacheable());
+        if (param->get_cacheable())
+        {
+            tensor->set_stale(false);
+        }
+        tensors.args.push_back(tensor);
+        tensors.arg_data.push_back(tensor_data);
     }
-    vector<shared_ptr<runtime::HostTensor>> result_data;
-    vector<shared_ptr<runtime::Tensor>> results;
     for (shared_ptr<Node> out : f->get_results())
     {
-        auto result = backend->create_tensor(out->get_element_type(), out->get_shape());
+        auto result = backend.create_tensor(out->get_element_type(), out->get_shape());
         auto tensor_data =
             make_shared<runtime::HostTensor>(out->get_element_type(), out->get_shape());
-        results.push_back(result);
-        result_data.push_back(tensor_data);
+        tensors.results.push_back(result);
+        tensors.result_data.push_back(tensor_data);
     }
+    return tensors;
+}
 
-    for (size_t i = 0; i < args.size(); i++)
+static void
+    call(runtime::Backend& backend, shared_ptr<Function> f, CallTensors& tensors, bool copy_data)
+{
+    if (copy_data)
     {
-        if (args_cacheable[i])
+        for (size_t arg_index = 0; arg_index < tensors.args.size(); arg_index++)
         {
-            args[i]->set_stale(false);
+            const shared_ptr<runtime::Tensor>& arg = tensors.args[arg_index];
+            if (arg->get_stale())
+            {
+                const shared_ptr<runtime::HostTensor>& data = tensors.arg_data[arg_index];
+                arg->write(data->get_data_ptr(),
+                           0,
+                           data->get_element_count() * data->get_element_type().size());
+            }
         }
     }
+    backend.call(f, tensors.results, tensors.args);
+    if (copy_data)
+    {
+        for (size_t result_index = 0; result_index < tensors.results.size(); result_index++)
+        {
+            const shared_ptr<runtime::HostTensor>& data = tensors.result_data[result_index];
+            const shared_ptr<runtime::Tensor>& result = tensors.results[result_index];
+            result->read(data->get_data_ptr(),
+                         0,
+                         data->get_element_count() * data->get_element_type().size());
+        }
+    }
+}
+
+vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
+                                                  const string& backend_name,
+                                                  size_t iterations,
+                                                  bool timing_detail,
+                                                  int warmup_iterations,
+                                                  bool copy_data)
+{
+    stopwatch timer;
+    timer.start();
+    auto backend = runtime::Backend::create(backend_name);
+    backend->enable_performance_data(f, timing_detail);
+    backend->compile(f);
+    timer.stop();
+    cout.imbue(locale(""));
+    cout << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+
+    CallTensors tensors = create_call_tensors(*backend, f);
 
     if (warmup_iterations)
     {
         for (int i = 0; i < warmup_iterations; i++)
         {
-            backend->call(f, results, args);
+            backend->call(f, tensors.results, tensors.args);
         }
     }
 
@@ -207,37 +257,171 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
     t1.start();
     for (size_t i = 0; i < iterations; i++)
     {
-        if (copy_data)
+        call(*backend, f, tensors, copy_data);
+    }
+    t1.stop();
+    float time = t1.get_milliseconds();
+    cout << time / iterations << "ms per iteration" << endl;
+
+    vector<runtime::PerformanceCounter> perf_data = backend->get_performance_data(f);
+    return perf_data;
+}
+
+static double get_cpu_seconds(clockid_t clock)
+{
+    timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+LoadTestResults run_load_test(shared_ptr<Function> f,
+                              const string& backend_name,
+                              size_t threads,
+                              size_t iterations,
+                              int warmup_iterations,
+                              bool copy_data,
+                              double target_qps,
+                              bool backend_per_thread)
+{
+    if (threads == 0 || iterations == 0)
+    {
+        throw runtime_error("load test needs at least one thread and one iteration");
+    }
+
+    LoadTestResults rc;
+    stopwatch timer;
+    timer.start();
+    // Compiling rewrites the function in place, so every backend gets a copy of its own
+    vector<shared_ptr<runtime::Backend>> backends;
+    vector<shared_ptr<Function>> functions;
+    for (size_t i = 0; i < (backend_per_thread ? threads : 1); i++)
+    {
+        backends.push_back(runtime::Backend::create(backend_name));
+        functions.push_back(i == 0 ? f : clone_function(*f));
+        backends.back()->compile(functions.back());
+    }
+    timer.stop();
+    rc.compile_time = timer.get_milliseconds();
+
+    vector<CallTensors> tensors;
+    for (size_t i = 0; i < threads; i++)
+    {
+        size_t backend_index = backend_per_thread ? i : 0;
+        tensors.push_back(
+            create_call_tensors(*backends.at(backend_index), functions.at(backend_index)));
+    }
+
+    // latencies[thread][iteration] in milliseconds
+    vector<vector<double>> latencies(threads, vector<double>(iterations));
+    vector<double> thread_cpu_seconds(threads);
+    vector<exception_ptr> errors(threads);
+    mutex start_mutex;
+    condition_variable start_condition;
+    size_t ready_count = 0;
+    bool started = false;
+    chrono::steady_clock::time_point start_time;
+
+    auto caller = [&](size_t thread_index) {
+        try
         {
-            for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
+            size_t backend_index = backend_per_thread ? thread_index : 0;
+            runtime::Backend& backend = *backends.at(backend_index);
+            shared_ptr<Function> function = functions.at(backend_index);
+            CallTensors& thread_tensors = tensors[thread_index];
+            for (int i = 0; i < warmup_iterations; i++)
             {
-                const shared_ptr<runtime::Tensor>& arg = args[arg_index];
-                if (arg->get_stale())
+                backend.call(function, thread_tensors.results, thread_tensors.args);
+            }
+            {
+                unique_lock<mutex> lock(start_mutex);
+                ready_count++;
+                start_condition.notify_all();
+                start_condition.wait(lock, [&] { return started; });
+            }
+            double cpu_start = get_cpu_seconds(CLOCK_THREAD_CPUTIME_ID);
+            for (size_t i = 0; i < iterations; i++)
+            {
+                chrono::steady_clock::time_point call_start = chrono::steady_clock::now();
+                if (target_qps > 0)
                 {
-                    const shared_ptr<runtime::HostTensor>& data = arg_data[arg_index];
-                    arg->write(data->get_data_ptr(),
-                               0,
-                               data->get_element_count() * data->get_element_type().size());
+                    // Calls are interleaved over the callers on one schedule
+                    chrono::duration<double> offset((i * threads + thread_index) / target_qps);
+                    call_start =
+                        start_time + chrono::duration_cast<chrono::steady_clock::duration>(offset);
+                    this_thread::sleep_until(call_start);
                 }
+                call(backend, function, thread_tensors, copy_data);
+                chrono::duration<double, milli> latency = chrono::steady_clock::now() - call_start;
+                latencies[thread_index][i] = latency.count();
             }
+            thread_cpu_seconds[thread_index] = get_cpu_seconds(CLOCK_THREAD_CPUTIME_ID) - cpu_start;
         }
-        backend->call(f, results, args);
-        if (copy_data)
+        catch (...)
         {
-            for (size_t result_index = 0; result_index < results.size(); result_index++)
+            errors[thread_index] = current_exception();
+            // Let the other callers start if this one failed during warmup
+            lock_guard<mutex> lock(start_mutex);
+            if (!started)
             {
-                const shared_ptr<runtime::HostTensor>& data = result_data[result_index];
-                const shared_ptr<runtime::Tensor>& result = results[result_index];
-                result->read(data->get_data_ptr(),
-                             0,
-                             data->get_element_count() * data->get_element_type().size());
+                ready_count++;
+                start_condition.notify_all();
             }
         }
+    };
+
+    vector<thread> caller_threads;
+    for (size_t i = 0; i < threads; i++)
+    {
+        caller_threads.emplace_back(caller, i);
+    }
+    double process_cpu_start;
+    {
+        unique_lock<mutex> lock(start_mutex);
+        start_condition.wait(lock, [&] { return ready_count == threads; });
+        process_cpu_start = get_cpu_seconds(CLOCK_PROCESS_CPUTIME_ID);
+        start_time = chrono::steady_clock::now();
+        started = true;
+        start_condition.notify_all();
+    }
+    for (thread& t : caller_threads)
+    {
+        t.join();
+    }
+    rc.seconds = chrono::duration<double>(chrono::steady_clock::now() - start_time).count();
+    double process_cpu_seconds = get_cpu_seconds(CLOCK_PROCESS_CPUTIME_ID) - process_cpu_start;
+    for (const exception_ptr& error : errors)
+    {
+        if (error)
+        {
+            rethrow_exception(error);
+        }
     }
-    t1.stop();
-    float time = t1.get_milliseconds();
-    cout << time / iterations << "ms per iteration" << endl;
 
-    vector<runtime::PerformanceCounter> perf_data = backend->get_performance_data(f);
-    return perf_data;
+    vector<double> all_latencies;
+    for (const vector<double>& thread_latencies : latencies)
+    {
+        all_latencies.insert(all_latencies.end(), thread_latencies.begin(), thread_latencies.end());
+    }
+    sort(all_latencies.begin(), all_latencies.end());
+    rc.requests = all_latencies.size();
+    rc.throughput = rc.requests / rc.seconds;
+    double total_latency = 0;
+    for (double latency : all_latencies)
+    {
+        total_latency += latency;
+    }
+    rc.mean_latency = total_latency / rc.requests;
+    // Nearest rank percentiles
+    for (const pair<string, double>& percentile :
+         vector<pair<string, double>>{{"p50", 50}, {"p90", 90}, {"p99", 99}, {"p99.9", 99.9}})
+    {
+        size_t rank = static_cast<size_t>(ceil(percentile.second / 100 * rc.requests));
+        rc.latency_percentiles[percentile.first] = all_latencies.at(max<size_t>(rank, 1) - 1);
+    }
+    for (double cpu_seconds : thread_cpu_seconds)
+    {
+        rc.thread_cpu_utilization.push_back(cpu_seconds / rc.seconds);
+    }
+    rc.process_cpu_utilization = process_cpu_seconds / rc.seconds;
+    return rc;
 }
@@ -34,3 +34,35 @@ std::vector<ngraph::runtime::PerformanceCounter> run_benchmark(std::shared_ptr<n
                                                                bool timing_detail,
                                                                int warmup_iterations,
                                                                bool copy_data);
+
+/// Results of run_load_test, times are in milliseconds
+struct LoadTestResults
+{
+    double compile_time;
+    size_t requests;
+    double seconds;
+    /// Requests per second
+    double throughput;
+    double mean_latency;
+    /// Latency by percentile name, e.g. "p99"
+    std::map<std::string, double> latency_percentiles;
+    /// CPU time each caller thread used over the duration of the test
+    std::vector<double> thread_cpu_utilization;
+    /// CPU time the whole process used over the duration of the test, including backend threads,
+    /// in units of one core
+    double process_cpu_utilization;
+};
+
+/// Runs iterations calls of f on each of threads concurrent callers. With a target_qps of 0 each
+/// caller makes its next call as soon as the previous one returns. Otherwise calls are started on
+/// a fixed schedule of target_qps calls per second over all callers, and their latency includes
+/// the time they were held up behind the schedule. Callers share one backend unless
+/// backend_per_thread is set, which is needed for backends that do not support concurrent calls.
+LoadTestResults run_load_test(std::shared_ptr<ngraph::Function> f,
+                              const std::string& backend_name,
+                              size_t threads,
+                              size_t iterations,
+                              int warmup_iterations,
+                              bool copy_data,
+                              double target_qps,
+                              bool backend_per_thread);
@@ -32,9 +32,11 @@
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
+#include "nlohmann/json.hpp"
 
 using namespace std;
 using namespace ngraph;
+using json = nlohmann::json;
 
 class PerfShape : public ngraph::runtime::PerformanceCounter
 {
@@ -151,6 +153,43 @@ void print_results(vector<PerfShape> perf_data, bool timing_detail)
     }
 }
 
+void print_load_test_results(const LoadTestResults& results)
+{
+    cout << "compile time: " << results.compile_time << "ms" << endl;
+    cout << results.requests << " requests in " << results.seconds << "s, " << results.throughput
+         << " requests per second" << endl;
+    cout << "latency: mean " << results.mean_latency << "ms";
+    for (const pair<string, double>& percentile : results.latency_percentiles)
+    {
+        cout << ", " << percentile.first << " " << percentile.second << "ms";
+    }
+    cout << endl;
+    cout << "caller thread CPU utilization:";
+    for (double utilization : results.thread_cpu_utilization)
+    {
+        cout << " " << utilization * 100 << "%";
+    }
+    cout << endl;
+    cout << "process CPU utilization: " << results.process_cpu_utilization * 100 << "%" << endl;
+}
+
+json load_test_results_to_json(const LoadTestResults& results)
+{
+    json j;
+    j["compile_ms"] = results.compile_time;
+    j["requests"] = results.requests;
+    j["seconds"] = results.seconds;
+    j["throughput"] = results.throughput;
+    j["latency_ms"]["mean"] = results.mean_latency;
+    for (const pair<string, double>& percentile : results.latency_percentiles)
+    {
+        j["latency_ms"][percentile.first] = percentile.second;
+    }
+    j["thread_cpu_utilization"] = results.thread_cpu_utilization;
+    j["process_cpu_utilization"] = results.process_cpu_utilization;
+    return j;
+}
+
 element::Type get_op_element_type(const Node& op)
 {
     element::Type type;
@@ -186,6 +225,10 @@ int main(int argc, char** argv)
     bool visualize = false;
     int warmup_iterations = 1;
     bool copy_data = true;
+    int threads = 0;
+    double target_qps = 0;
+    bool backend_per_thread = false;
+    string json_file;
 
     for (size_t i = 1; i < argc; i++)
     {
@@ -226,6 +269,38 @@ int main(int argc, char** argv)
         {
             visualize = true;
         }
+        else if (arg == "-t" || arg == "--threads")
+        {
+            try
+            {
+                threads = stoi(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--qps")
+        {
+            try
+            {
+                target_qps = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--backend_per_thread")
+        {
+            backend_per_thread = true;
+        }
+        else if (arg == "--json")
+        {
+            json_file = argv[++i];
+        }
         else if (arg == "-d" || arg == "--directory")
         {
             directory = argv[++i];
@@ -263,6 +338,16 @@ int main(int argc, char** argv)
         cout << "Either file or directory must be specified\n";
         failed = true;
     }
+    else if (threads < 0 || target_qps < 0)
+    {
+        cout << "Threads and QPS can not be negative\n";
+        failed = true;
+    }
+    else if (!json_file.empty() && (backend.empty() || (threads == 0 && target_qps == 0)))
+    {
+        cout << "JSON output requires a backend and a load test\n";
+        failed = true;
+    }
 
     if (failed)
     {
@@ -283,6 +368,13 @@ OPTIONS
         --timing_detail           Gather detailed timing
         -w|--warmup_iterations    Number of warm-up iterations
         --no_copy_data            Disable copy of input/result data every iteration
+        -t|--threads              Run a load test with this many concurrent callers, each
+                                  making the given number of iterations
+        --qps                     Start calls at this rate over all callers instead of as soon
+                                  as each caller's previous call returns (implies --threads 1)
+        --backend_per_thread      Give each caller a backend of its own, for backends that do
+                                  not support concurrent calls
+        --json                    Write the load test results to this file as JSON
 )###";
         return 1;
     }
@@ -306,6 +398,12 @@ OPTIONS
         models.push_back(model_arg);
     }
 
+    if (target_qps > 0 && threads == 0)
+    {
+        threads = 1;
+    }
+
+    json json_results = json::array();
     vector<PerfShape> aggregate_perf_data;
     for (const string& model : models)
     {
@@ -375,7 +473,28 @@ OPTIONS
                 }
             }
 
-            if (!backend.empty())
+            if (!backend.empty() && threads > 0)
+            {
+                cout << "\n---- Load Test ----\n";
+                shared_ptr<Function> f = deserialize(model);
+                auto results = run_load_test(f,
+                                             backend,
+                                             threads,
+                                             iterations,
+                                             warmup_iterations,
+                                             copy_data,
+                                             target_qps,
+                                             backend_per_thread);
+                print_load_test_results(results);
+                json j = load_test_results_to_json(results);
+                j["model"] = model;
+                j["backend"] = backend;
+                j["threads"] = threads;
+                j["iterations"] = iterations;
+                j["target_qps"] = target_qps;
+                json_results.push_back(j);
+            }
+            else if (!backend.empty())
             {
                 cout << "\n---- Benchmark ----\n";
                 shared_ptr<Function> f = deserialize(model);
@@ -406,5 +525,16 @@ OPTIONS
         print_results(aggregate_perf_data, timing_detail);
     }
 
+    if (!json_file.empty())
+    {
+        ofstream out(json_file);
+        out << setw(4) << json_results << endl;
+        if (!out)
+        {
+            cout << "Failed to write " << json_file << endl;
+            return 1;
+        }
+    }
+
     return 0;
 }
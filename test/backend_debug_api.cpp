@@ -73,3 +73,33 @@ TEST(INTERPRETER, nan_check_output)
     ibackend->set_nan_check(f, true);
     EXPECT_ANY_THROW(ibackend->call_with_validate(f, {result}, {a, b}));
 }
+
+TEST(INTERPRETER, temporary_pool_reuse)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 1, 1, 1});
+    auto t0 = (A + B) * C;
+    auto t1 = (t0 - A) * t0;
+    auto f = make_shared<Function>(NodeVector{t1 + B, t0}, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto r0 = backend->create_tensor(element::f32, shape);
+    auto r1 = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    backend->call_with_validate(f, {r0, r1}, {a, b});
+    EXPECT_EQ((vector<float>{35, 54, 77, 104}), read_vector<float>(r0));
+    EXPECT_EQ((vector<float>{6, 8, 10, 12}), read_vector<float>(r1));
+    EXPECT_GT(f->get_temporary_pool_size(), 0);
+
+    // Swapping the arguments must rebind the parameters, not reuse stale views
+    backend->call_with_validate(f, {r0, r1}, {b, a});
+    EXPECT_EQ((vector<float>{7, 18, 33, 52}), read_vector<float>(r0));
+    EXPECT_EQ((vector<float>{6, 8, 10, 12}), read_vector<float>(r1));
+}
@@ -10191,3 +10191,232 @@ NGRAPH_TEST(${BACKEND_NAME}, quantize_clamp)
         (vector<output_c_type>{1, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128}),
         read_vector<output_c_type>(y));
 }
+
+// Small integers, so that sums of their products are exact in float
+static vector<float> make_exact_values(size_t size, int seed)
+{
+    vector<float> values(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        values[i] = static_cast<float>(static_cast<int>((i * 7 + seed) % 11) - 5);
+    }
+    return values;
+}
+
+// M=33, K=130 and N=257 cross every block boundary of the reference GEMM
+NGRAPH_TEST(${BACKEND_NAME}, dot_blocked_multi_axis)
+{
+    Shape shape_a{3, 11, 10, 13};
+    Shape shape_b{10, 13, 257};
+    Shape shape_r{3, 11, 257};
+    size_t m = 33;
+    size_t k = 130;
+    size_t n = 257;
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B, 2), op::ParameterVector{A, B});
+
+    vector<float> a_data = make_exact_values(m * k, 1);
+    vector<float> b_data = make_exact_values(k * n, 2);
+    vector<float> expected(m * n, 0);
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            for (size_t kk = 0; kk < k; kk++)
+            {
+                expected[i * n + j] += a_data[i * k + kk] * b_data[kk * n + j];
+            }
+        }
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    backend->call_with_validate(f, {result}, {a, b});
+    EXPECT_EQ(expected, read_vector<float>(result));
+}
+
+// Calls tap(data_index, filters_index, output_index) for every product a convolution with the
+// default axis layout sums. Written from the definition, independently of the kernels.
+template <typename F>
+static void for_each_convolution_tap(const Shape& data_shape,
+                                     const Shape& filters_shape,
+                                     const Shape& output_shape,
+                                     const Strides& strides,
+                                     const Strides& dilation,
+                                     const CoordinateDiff& padding_below,
+                                     const Strides& data_dilation,
+                                     F tap)
+{
+    CoordinateTransform data_transform(data_shape);
+    CoordinateTransform filters_transform(filters_shape);
+    CoordinateTransform output_transform(output_shape);
+    for (const Coordinate& output_coord : output_transform)
+    {
+        for (const Coordinate& filters_coord : filters_transform)
+        {
+            if (filters_coord[0] != output_coord[1])
+            {
+                continue;
+            }
+            Coordinate data_coord{output_coord[0], filters_coord[1]};
+            bool valid = true;
+            for (size_t d = 2; d < data_shape.size() && valid; d++)
+            {
+                int64_t position = static_cast<int64_t>(output_coord[d] * strides[d - 2] +
+                                                        filters_coord[d] * dilation[d - 2]) -
+                                   padding_below[d - 2];
+                int64_t stride = static_cast<int64_t>(data_dilation[d - 2]);
+                valid = position >= 0 && position % stride == 0 &&
+                        position / stride < static_cast<int64_t>(data_shape[d]);
+                data_coord.push_back(valid ? static_cast<size_t>(position / stride) : 0);
+            }
+            if (valid)
+            {
+                tap(data_transform.index(data_coord),
+                    filters_transform.index(filters_coord),
+                    output_transform.index(output_coord));
+            }
+        }
+    }
+}
+
+// Checks Convolution and both of its backprops against for_each_convolution_tap
+static void convolution_test_helper(const Shape& data_shape,
+                                    const Shape& filters_shape,
+                                    const Strides& strides,
+                                    const Strides& dilation,
+                                    const CoordinateDiff& padding_below,
+                                    const CoordinateDiff& padding_above,
+                                    const Strides& data_dilation)
+{
+    auto data = make_shared<op::Parameter>(element::f32, data_shape);
+    auto filters = make_shared<op::Parameter>(element::f32, filters_shape);
+    auto conv = make_shared<op::Convolution>(
+        data, filters, strides, dilation, padding_below, padding_above, data_dilation);
+    Shape output_shape = conv->get_shape();
+    auto delta = make_shared<op::Parameter>(element::f32, output_shape);
+    auto f = make_shared<Function>(
+        NodeVector{conv,
+                   make_shared<op::ConvolutionBackpropData>(data_shape,
+                                                            filters,
+                                                            delta,
+                                                            strides,
+                                                            dilation,
+                                                            padding_below,
+                                                            padding_above,
+                                                            data_dilation),
+                   make_shared<op::ConvolutionBackpropFilters>(data,
+                                                               filters_shape,
+                                                               delta,
+                                                               strides,
+                                                               dilation,
+                                                               padding_below,
+                                                               padding_above,
+                                                               data_dilation)},
+        op::ParameterVector{data, filters, delta});
+
+    vector<float> data_values = make_exact_values(shape_size(data_shape), 1);
+    vector<float> filters_values = make_exact_values(shape_size(filters_shape), 2);
+    vector<float> delta_values = make_exact_values(shape_size(output_shape), 3);
+    vector<float> expected_output(shape_size(output_shape), 0);
+    vector<float> expected_data_delta(shape_size(data_shape), 0);
+    vector<float> expected_filters_delta(shape_size(filters_shape), 0);
+    for_each_convolution_tap(
+        data_shape,
+        filters_shape,
+        output_shape,
+        strides,
+        dilation,
+        padding_below,
+        data_dilation,
+        [&](size_t data_index, size_t filters_index, size_t output_index) {
+            float data_value = data_values[data_index];
+            float filters_value = filters_values[filters_index];
+            float delta_value = delta_values[output_index];
+            expected_output[output_index] += data_value * filters_value;
+            expected_data_delta[data_index] += filters_value * delta_value;
+            expected_filters_delta[filters_index] += data_value * delta_value;
+        });
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto data_tensor = backend->create_tensor(element::f32, data_shape);
+    copy_data(data_tensor, data_values);
+    auto filters_tensor = backend->create_tensor(element::f32, filters_shape);
+    copy_data(filters_tensor, filters_values);
+    auto delta_tensor = backend->create_tensor(element::f32, output_shape);
+    copy_data(delta_tensor, delta_values);
+    auto output = backend->create_tensor(element::f32, output_shape);
+    auto data_delta = backend->create_tensor(element::f32, data_shape);
+    auto filters_delta = backend->create_tensor(element::f32, filters_shape);
+
+    backend->call_with_validate(f,
+                                {output, data_delta, filters_delta},
+                                {data_tensor, filters_tensor, delta_tensor});
+    EXPECT_EQ(expected_output, read_vector<float>(output));
+    EXPECT_EQ(expected_data_delta, read_vector<float>(data_delta));
+    EXPECT_EQ(expected_filters_delta, read_vector<float>(filters_delta));
+}
+
+// The backprops swap the channel axes and rotate the filters, so they cover the reference
+// convolution's general path while the forward convolutions take the direct path
+NGRAPH_TEST(${BACKEND_NAME}, convolution_1d_strided_padded)
+{
+    convolution_test_helper(Shape{2, 3, 11},
+                            Shape{4, 3, 3},
+                            Strides{2},
+                            Strides{1},
+                            CoordinateDiff{2},
+                            CoordinateDiff{1},
+                            Strides{1});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convolution_2d_strided_dilated_padded)
+{
+    convolution_test_helper(Shape{2, 3, 7, 6},
+                            Shape{4, 3, 3, 2},
+                            Strides{2, 1},
+                            Strides{1, 2},
+                            CoordinateDiff{1, 0},
+                            CoordinateDiff{2, 1},
+                            Strides{1, 1});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convolution_2d_negative_padding)
+{
+    convolution_test_helper(Shape{1, 2, 8, 8},
+                            Shape{3, 2, 3, 3},
+                            Strides{1, 2},
+                            Strides{2, 1},
+                            CoordinateDiff{-1, 2},
+                            CoordinateDiff{1, -2},
+                            Strides{1, 1});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convolution_3d_strided_dilated_padded)
+{
+    convolution_test_helper(Shape{1, 2, 5, 6, 4},
+                            Shape{3, 2, 2, 3, 2},
+                            Strides{1, 2, 1},
+                            Strides{2, 1, 1},
+                            CoordinateDiff{0, 1, 1},
+                            CoordinateDiff{1, 0, 2},
+                            Strides{1, 1, 1});
+}
+
+// Data dilation is not handled by the direct path
+NGRAPH_TEST(${BACKEND_NAME}, convolution_2d_data_dilated)
+{
+    convolution_test_helper(Shape{2, 2, 4, 5},
+                            Shape{3, 2, 3, 2},
+                            Strides{1, 2},
+                            Strides{1, 1},
+                            CoordinateDiff{1, 1},
+                            CoordinateDiff{0, 1},
+                            Strides{2, 3});
+}
@@ -0,0 +1,192 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/bf16_conversion.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/all_close.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static size_t count_converts(const shared_ptr<Function>& f, const element::Type& type)
+{
+    auto ops = f->get_ops();
+    return count_if(ops.begin(), ops.end(), [&type](const shared_ptr<Node>& node) {
+        return dynamic_pointer_cast<op::Convert>(node) && node->get_element_type() == type;
+    });
+}
+
+// Runs f before and after the pass on the INTERPRETER and checks the results are within bf16
+// precision of each other
+static void check_bf16_conversion(const shared_ptr<Function>& f, pass::BF16Conversion& conversion)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    test::Uniform<float> rng(-1.0f, 1.0f);
+
+    vector<shared_ptr<runtime::Tensor>> args;
+    for (auto& param : f->get_parameters())
+    {
+        auto arg = backend->create_tensor(param->get_element_type(), param->get_shape());
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    vector<shared_ptr<runtime::Tensor>> expected;
+    vector<shared_ptr<runtime::Tensor>> results;
+    for (size_t i = 0; i < f->get_output_size(); i++)
+    {
+        expected.push_back(backend->create_tensor(element::f32, f->get_output_shape(i)));
+        results.push_back(backend->create_tensor(element::f32, f->get_output_shape(i)));
+    }
+
+    auto converted = clone_function(*f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BF16Conversion>(conversion);
+    pass_manager.run_passes(converted);
+    for (size_t i = 0; i < converted->get_output_size(); i++)
+    {
+        EXPECT_EQ(element::f32, converted->get_output_element_type(i));
+    }
+
+    backend->call_with_validate(f, expected, args);
+    backend->call_with_validate(converted, results, args);
+    EXPECT_TRUE(test::all_close<float>(expected, results, 2e-2f, 2e-2f));
+}
+
+TEST(bf16_conversion, elementwise_chain)
+{
+    Shape shape{2, 8};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto scale = op::Constant::create(element::f32, shape, vector<float>(16, 0.5f));
+    auto sum = make_shared<op::Add>(A, B);
+    auto relu = make_shared<op::Relu>(sum);
+    auto f =
+        make_shared<Function>(make_shared<op::Multiply>(relu, scale), op::ParameterVector{A, B});
+
+    pass::BF16Conversion conversion;
+    check_bf16_conversion(f, conversion);
+
+    auto converted = clone_function(*f);
+    pass::BF16Conversion pass;
+    pass.run_on_function(converted);
+    EXPECT_EQ(3, pass.get_converted_count());
+    // The two parameters go in, the product comes out and the constant is converted in place
+    EXPECT_EQ(2, count_converts(converted, element::bf16));
+    EXPECT_EQ(1, count_converts(converted, element::f32));
+    EXPECT_EQ(1, count_ops_of_type<op::Multiply>(converted));
+    for (auto& node : converted->get_ops())
+    {
+        if (auto constant = dynamic_pointer_cast<op::Constant>(node))
+        {
+            EXPECT_EQ(element::bf16, constant->get_element_type());
+        }
+    }
+}
+
+TEST(bf16_conversion, dot_accumulates_in_f32)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 16});
+    auto W1 = make_shared<op::Parameter>(element::f32, Shape{16, 8});
+    auto W2 = make_shared<op::Parameter>(element::f32, Shape{8, 4});
+    auto bias = make_shared<op::Parameter>(element::f32, Shape{8});
+    auto dot1 = make_shared<op::Dot>(A, W1);
+    auto biased = make_shared<op::Add>(
+        dot1, make_shared<op::Broadcast>(bias, Shape{4, 8}, AxisSet{0}));
+    auto relu = make_shared<op::Relu>(biased);
+    auto dot2 = make_shared<op::Dot>(relu, W2);
+    auto f = make_shared<Function>(make_shared<op::Sum>(dot2, AxisSet{1}),
+                                   op::ParameterVector{A, W1, W2, bias});
+
+    pass::BF16Conversion conversion;
+    check_bf16_conversion(f, conversion);
+
+    auto converted = clone_function(*f);
+    pass::BF16Conversion pass;
+    pass.run_on_function(converted);
+    EXPECT_EQ(4, pass.get_converted_count());
+    for (auto& node : converted->get_ops())
+    {
+        if (dynamic_pointer_cast<op::Dot>(node))
+        {
+            EXPECT_EQ(element::bf16, node->get_element_type());
+        }
+        if (dynamic_pointer_cast<op::Sum>(node))
+        {
+            EXPECT_EQ(element::f32, node->get_element_type());
+        }
+    }
+}
+
+TEST(bf16_conversion, convolution)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 2, 5, 5});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{3, 2, 2, 2});
+    auto conv = make_shared<op::Convolution>(data, filters, Strides{1, 1}, Strides{2, 2});
+    auto f = make_shared<Function>(make_shared<op::Relu>(conv),
+                                   op::ParameterVector{data, filters});
+
+    pass::BF16Conversion conversion;
+    check_bf16_conversion(f, conversion);
+
+    pass::BF16Conversion pass;
+    pass.run_on_function(f);
+    EXPECT_EQ(2, pass.get_converted_count());
+    EXPECT_EQ(2, count_converts(f, element::bf16));
+    EXPECT_EQ(1, count_converts(f, element::f32));
+}
+
+TEST(bf16_conversion, min_subgraph_size)
+{
+    Shape shape{4, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto relu = make_shared<op::Relu>(make_shared<op::Exp>(A));
+    auto f = make_shared<Function>(make_shared<op::Exp>(relu), op::ParameterVector{A});
+
+    pass::BF16Conversion pass;
+    EXPECT_FALSE(pass.run_on_function(f));
+    EXPECT_EQ(0, count_converts(f, element::bf16));
+
+    pass::BF16Conversion single(1);
+    EXPECT_TRUE(single.run_on_function(f));
+    EXPECT_EQ(1, count_converts(f, element::bf16));
+}
+
+TEST(bf16_conversion, predicate)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto abs = make_shared<op::Abs>(A);
+    auto neg = make_shared<op::Negative>(abs);
+    auto f = make_shared<Function>(make_shared<op::Relu>(neg), op::ParameterVector{A});
+
+    pass::BF16Conversion pass(1, [](const shared_ptr<Node>& node) {
+        return !dynamic_pointer_cast<op::Negative>(node);
+    });
+    check_bf16_conversion(f, pass);
+
+    pass.run_on_function(f);
+    EXPECT_EQ(2, pass.get_converted_count());
+    EXPECT_EQ(element::f32, neg->get_element_type());
+    EXPECT_EQ(2, count_converts(f, element::bf16));
+    EXPECT_EQ(2, count_converts(f, element::f32));
+}
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/codegen/compiler.hpp"
+#include "ngraph/codegen/execution_engine.hpp"
+#include "ngraph/file_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const string s_return_1 = R"(extern "C" int test() { return 1; })";
+static const string s_return_2 = R"(extern "C" int test() { return 2; })";
+
+// The cache entries in dir, as paths without the .bc or .key extension
+static vector<string> get_cache_entries(const string& dir)
+{
+    vector<string> entries;
+    file_util::iterate_files(dir, [&](const string& file, bool is_dir) {
+        if (!is_dir && file.size() > 3 && file.compare(file.size() - 3, 3, ".bc") == 0)
+        {
+            entries.push_back(file.substr(0, file.size() - 3));
+        }
+    });
+    return entries;
+}
+
+// Compiles source with a fresh compiler, as a new process would, and runs it
+static int compile_and_run(const string& source, const vector<string>& search_paths = {})
+{
+    codegen::Compiler compiler;
+    for (const string& path : search_paths)
+    {
+        compiler.add_header_search_path(path);
+    }
+    codegen::ExecutionEngine execution_engine;
+    auto module = compiler.compile(source);
+    EXPECT_NE(nullptr, module);
+    execution_engine.add_module(module);
+    execution_engine.finalize();
+    auto test = execution_engine.find_function<int()>("test");
+    EXPECT_NE(nullptr, test);
+    return test();
+}
+
+TEST(codegen, module_cache)
+{
+    string cache_dir = file_util::path_join(file_util::get_temp_directory_path(), "codegen_cache");
+    file_util::remove_directory(cache_dir);
+    setenv("NGRAPH_CODEGEN_CACHE_DIR", cache_dir.c_str(), 1);
+
+    // Misses store an entry per source
+    EXPECT_EQ(1, compile_and_run(s_return_1));
+    vector<string> entries_1 = get_cache_entries(cache_dir);
+    ASSERT_EQ(1, entries_1.size());
+    EXPECT_EQ(2, compile_and_run(s_return_2));
+    ASSERT_EQ(2, get_cache_entries(cache_dir).size());
+    string entry_1 = entries_1[0];
+    string entry_2;
+    for (const string& entry : get_cache_entries(cache_dir))
+    {
+        if (entry != entry_1)
+        {
+            entry_2 = entry;
+        }
+    }
+
+    // A hit loads the stored module instead of compiling the source. Swapping in the bitcode
+    // of the other source shows which one ran.
+    file_util::remove_file(entry_1 + ".bc");
+    rename((entry_2 + ".bc").c_str(), (entry_1 + ".bc").c_str());
+    EXPECT_EQ(2, compile_and_run(s_return_1));
+
+    // An entry whose key does not match is recompiled and replaced
+    file_util::remove_file(entry_1 + ".key");
+    {
+        ofstream out(entry_1 + ".key");
+        out << "stale key";
+    }
+    EXPECT_EQ(1, compile_and_run(s_return_1));
+    EXPECT_EQ(1, compile_and_run(s_return_1));
+    EXPECT_EQ(1, get_cache_entries(cache_dir).size());
+
+    // Changed source and changed flags are misses with entries of their own
+    EXPECT_EQ(2, compile_and_run(s_return_2));
+    EXPECT_EQ(2, get_cache_entries(cache_dir).size());
+    EXPECT_EQ(1, compile_and_run(s_return_1, {cache_dir}));
+    EXPECT_EQ(3, get_cache_entries(cache_dir).size());
+    setenv("NGRAPH_COMPILER_DEBUGINFO_ENABLE", "1", 1);
+    EXPECT_EQ(1, compile_and_run(s_return_1));
+    unsetenv("NGRAPH_COMPILER_DEBUGINFO_ENABLE");
+    EXPECT_EQ(4, get_cache_entries(cache_dir).size());
+
+    unsetenv("NGRAPH_CODEGEN_CACHE_DIR");
+    file_util::remove_directory(cache_dir);
+}
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "ngraph/cpio.hpp"
@@ -105,3 +107,36 @@ TEST(cpio, write)
         }
     }
 }
+
+TEST(cpio, write_aligned)
+{
+    const string test_file = "test_aligned.cpio";
+    vector<double> d1{1.5, 2.5, 3.5};
+    vector<int32_t> d2{-1, 0, 1};
+    string s1 = "odd";
+    {
+        cpio::Writer writer(test_file);
+        writer.write("a", s1.data(), static_cast<uint32_t>(s1.size()));
+        writer.write("doubles", d1.data(), static_cast<uint32_t>(d1.size() * sizeof(double)), 8);
+        writer.write("ints", d2.data(), static_cast<uint32_t>(d2.size() * sizeof(int32_t)), 4);
+    }
+    {
+        cpio::Reader reader(test_file);
+        auto file_info = reader.get_file_info();
+        ASSERT_EQ(3, file_info.size());
+
+        EXPECT_EQ(file_info[0].get_name(), "a");
+        EXPECT_EQ(file_info[1].get_name(), "doubles");
+        EXPECT_EQ(file_info[2].get_name(), "ints");
+        EXPECT_EQ(file_info[1].get_offset() % 8, 0);
+        EXPECT_EQ(file_info[2].get_offset() % 4, 0);
+
+        vector<double> r1(d1.size());
+        reader.read("doubles", r1.data(), r1.size() * sizeof(double));
+        EXPECT_EQ(r1, d1);
+        vector<int32_t> r2(d2.size());
+        reader.read("ints", r2.data(), r2.size() * sizeof(int32_t));
+        EXPECT_EQ(r2, d2);
+    }
+    file_util::remove_file(test_file);
+}
@@ -1306,7 +1306,6 @@ TEST(cpu_fusion, backwards_maxpool_with_indices_n4_c1_hw4_2x2_max)
     ASSERT_TRUE(read_vector<float>(output) == expected);
 }
 
-#if 0
 TEST(cpu_fusion, loop_kernel_one_input_one_output)
 {
     Shape shapeA{2, 2};
@@ -1498,8 +1497,6 @@ TEST(cpu_fusion, loop_kernel_copy_with_new_args)
     EXPECT_EQ(read_vector<int>(r3), read_vector<int>(copy_r3));
 }
 
-#endif
-
 static std::shared_ptr<ngraph::Function> make_forward_function()
 {
     Shape shape_a{10, 3, 28, 28};
@@ -2144,8 +2141,6 @@ TEST(cpu_fusion, rnn_fusion_inter_vs_cpu_2rnn_layer_3lstm_cell)
     }
 }
 
-#if 0
-
 TEST(cpu_fusion, loop_kernel_fusion_multiple_groups_pruned)
 {
     auto make_function = []() -> std::shared_ptr<Function> {
@@ -2338,7 +2333,27 @@ TEST(cpu_fusion, loop_kernel_fusion_one_group)
     }
 }
 
-#endif
+TEST(cpu_fusion, loop_kernel_fusion_no_cycles)
+{
+    // relu_a and add can't share a kernel since the dot between them would
+    // both feed the kernel and consume one of its outputs
+    Shape shape{2, 2};
+    auto a = make_shared<op::Parameter>(element::f32, shape);
+    auto w = make_shared<op::Parameter>(element::f32, shape);
+    auto relu_a = make_shared<op::Relu>(a);
+    auto dot = make_shared<op::Dot>(relu_a, w);
+    auto add = relu_a + dot;
+    auto neg = make_shared<op::Negative>(add);
+    auto f = make_shared<Function>(NodeVector{neg}, op::ParameterVector{a, w});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>(2);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Relu>(f), 1);
+    ASSERT_EQ(f->get_ordered_ops().size(), f->get_ops().size());
+}
 
 TEST(cpu_fusion, sigmoid_multiply_fusion)
 {
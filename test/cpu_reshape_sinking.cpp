@@ -19,6 +19,7 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <numeric>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -34,6 +35,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_reshape_sinking.hpp"
 #include "ngraph/serializer.hpp"
@@ -51,7 +53,7 @@ using namespace std;
 
 TEST(cpu_reshape_sinking, edge_splitting)
 {
-    //checks if Reshapes are pushed through op::Abs, but stopped by Sum
+    //checks if Reshapes are pushed through op::Abs and op::Sum
     Shape shape_nhwc{16, 28, 28, 1};
     Shape shape_nchw{16, 1, 28, 28};
     auto a = make_shared<op::Parameter>(element::i32, shape_nhwc);
@@ -68,7 +70,10 @@ TEST(cpu_reshape_sinking, edge_splitting)
     pass_manager.register_pass<pass::CommonSubexpressionElimination>();
     pass_manager.register_pass<pass::VisualizeTree>("after.pdf");
     pass_manager.run_passes(func);
-    ASSERT_EQ(func->get_results().at(1)->get_argument(0), sum);
+    //the Sum now reduces the unreshaped Parameter
+    auto new_sum = std::dynamic_pointer_cast<op::Sum>(func->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(new_sum);
+    ASSERT_EQ(new_sum->get_argument(0), a);
     auto new_reshape =
         std::dynamic_pointer_cast<op::Reshape>(func->get_results().at(0)->get_argument(0));
     ASSERT_TRUE(new_reshape);
@@ -94,3 +99,99 @@ TEST(cpu_reshape_sinking, mnist_conv)
     size_t before_after = count_ops_of_type<op::Reshape>(func);
     ASSERT_LE(before_after, before_count);
 }
+
+//runs reshape sinking on a copy of func and checks that it computes the same results
+static size_t check_reshape_sinking(shared_ptr<Function> func, size_t expected_reshapes)
+{
+    auto sunk_func = ngraph::clone_function(*func);
+    runtime::cpu::pass::CPUReshapeSinking reshape_sinking;
+    reshape_sinking.run_on_function(sunk_func);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.run_passes(sunk_func);
+    EXPECT_EQ(count_ops_of_type<op::Reshape>(sunk_func), expected_reshapes);
+
+    vector<vector<float>> args;
+    for (auto param : func->get_parameters())
+    {
+        vector<float> arg(shape_size(param->get_shape()));
+        iota(arg.begin(), arg.end(), -10);
+        args.push_back(arg);
+    }
+    auto expected = execute(func, args, "INTERPRETER");
+    auto results = execute(sunk_func, args, "INTERPRETER");
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(func->get_output_shape(i), sunk_func->get_output_shape(i));
+        EXPECT_EQ(expected.at(i), results.at(i));
+    }
+    return reshape_sinking.get_eliminated_bytes();
+}
+
+TEST(cpu_reshape_sinking, cancel_inverse_transposes)
+{
+    Shape shape_nhwc{1, 4, 4, 3};
+    Shape shape_nchw{1, 3, 4, 4};
+    auto a = make_shared<op::Parameter>(element::f32, shape_nhwc);
+    auto to_nchw = make_shared<op::Reshape>(a, AxisVector{0, 3, 1, 2}, shape_nchw);
+    auto absn = make_shared<op::Abs>(to_nchw);
+    auto to_nhwc = make_shared<op::Reshape>(absn, AxisVector{0, 2, 3, 1}, shape_nhwc);
+    auto func = make_shared<Function>(make_shared<op::Negative>(to_nhwc), op::ParameterVector{a});
+
+    size_t eliminated_bytes = check_reshape_sinking(func, 0);
+    EXPECT_EQ(eliminated_bytes, 2 * shape_size(shape_nhwc) * sizeof(float));
+
+    //the CPU backend runs the pass when compiling and reports the same savings
+    auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(func);
+    EXPECT_EQ(external_function->get_reshape_sinking_eliminated_bytes(), 0);
+    external_function->make_call_frame();
+    EXPECT_EQ(external_function->get_reshape_sinking_eliminated_bytes(), eliminated_bytes);
+}
+
+TEST(cpu_reshape_sinking, pad_slice_concat_sum)
+{
+    Shape shape_nhwc{2, 4, 4, 3};
+    Shape shape_nchw{2, 3, 4, 4};
+    auto a = make_shared<op::Parameter>(element::f32, shape_nhwc);
+    auto b = make_shared<op::Parameter>(element::f32, shape_nhwc);
+    auto a_nchw = make_shared<op::Reshape>(a, AxisVector{0, 3, 1, 2}, shape_nchw);
+    auto b_nchw = make_shared<op::Reshape>(b, AxisVector{0, 3, 1, 2}, shape_nchw);
+    auto pad_value = op::Constant::create(element::f32, Shape{}, {7});
+    auto pad = make_shared<op::Pad>(
+        a_nchw, pad_value, Shape{0, 0, 1, 1}, Shape{0, 0, 1, 0}, Shape{0, 0, 0, 1});
+    auto slice = make_shared<op::Slice>(
+        pad, Coordinate{0, 0, 1, 0}, Coordinate{2, 3, 5, 8}, Strides{1, 1, 1, 2});
+    auto concat = make_shared<op::Concat>(NodeVector{slice, b_nchw}, 1);
+    auto sum = make_shared<op::Sum>(concat, AxisSet{2});
+    auto func = make_shared<Function>(sum, op::ParameterVector{a, b});
+
+    //only the smaller result of the Sum is transposed
+    size_t eliminated_bytes = check_reshape_sinking(func, 1);
+    EXPECT_EQ(eliminated_bytes, (2 * shape_size(shape_nchw) - 2 * 6 * 4) * sizeof(float));
+}
+
+TEST(cpu_reshape_sinking, flattening_transpose)
+{
+    //a Reshape that transposes and flattens is not sunk through the Slice
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+    auto reshape = make_shared<op::Reshape>(a, AxisVector{1, 0, 2}, Shape{3, 8});
+    auto slice = make_shared<op::Slice>(reshape, Coordinate{1, 0}, Coordinate{3, 8});
+    auto func = make_shared<Function>(slice, op::ParameterVector{a});
+
+    check_reshape_sinking(func, 1);
+}
+
+TEST(cpu_reshape_sinking, swim_stops_at_shared_op)
+{
+    //the transpose of b for the Add can not be moved above Abs, which is also a result
+    Shape shape_nhwc{1, 2, 2, 3};
+    Shape shape_nchw{1, 3, 2, 2};
+    auto a = make_shared<op::Parameter>(element::f32, shape_nhwc);
+    auto b = make_shared<op::Parameter>(element::f32, shape_nchw);
+    auto a_nchw = make_shared<op::Reshape>(a, AxisVector{0, 3, 1, 2}, shape_nchw);
+    auto absn = make_shared<op::Abs>(b);
+    auto add = make_shared<op::Add>(a_nchw, absn);
+    auto func = make_shared<Function>(NodeVector{add, absn}, op::ParameterVector{a, b});
+
+    check_reshape_sinking(func, 2);
+}
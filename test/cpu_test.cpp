@@ -19,6 +19,7 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -31,6 +32,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
@@ -195,6 +197,50 @@ TEST(cpu_test, mkldnn_layouts)
     EXPECT_EQ(vector<float>{expected_result}, rv);
 }
 
+TEST(cpu_test, prepacked_constant_weights)
+{
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> weights(shape_size(Shape{32, 16, 3, 3}));
+    rng.initialize(weights);
+
+    auto make_function = [&weights](weak_ptr<Node>& constant) -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto B = op::Constant::create(element::f32, Shape{32, 16, 3, 3}, weights);
+        constant = B;
+        auto conv = make_shared<op::Convolution>(A,
+                                                 B,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 Strides{1, 1});
+        return make_shared<Function>(NodeVector{conv}, op::ParameterVector{A});
+    };
+
+    weak_ptr<Node> cpu_constant;
+    weak_ptr<Node> int_constant;
+    auto cpu_f = make_function(cpu_constant);
+    auto int_f = make_function(int_constant);
+
+    vector<vector<float>> args;
+    vector<float> tensor_val(shape_size(Shape{1, 16, 8, 8}));
+    rng.initialize(tensor_val);
+    args.push_back(tensor_val);
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    // The weights are reordered at compile time, only the input is converted
+    EXPECT_EQ(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f), 1);
+    // and the function holds them in that layout only
+    EXPECT_EQ(count_ops_of_type<op::Constant>(cpu_f), 1);
+    EXPECT_TRUE(cpu_constant.expired());
+    EXPECT_FALSE(int_constant.expired());
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
 TEST(cpu_test, reshape_squeeze)
 {
     auto make_function = []() -> std::shared_ptr<Function> {
@@ -211,9 +257,10 @@ TEST(cpu_test, reshape_squeeze)
         return make_shared<Function>(NodeVector{squeeze}, op::ParameterVector{A, B});
     };
 
-    auto backend = runtime::Backend::create("CPU");
-    auto cpu_f = make_function();
-    auto int_f = make_function();
+    weak_ptr<Node> cpu_constant;
+    weak_ptr<Node> int_constant;
+    auto cpu_f = make_function(cpu_constant);
+    auto int_f = make_function(int_constant);
 
     test::Uniform<float> rng(-100.0f, 100.0f);
     vector<vector<float>> args;
@@ -250,9 +297,10 @@ TEST(cpu_test, reshape_expand)
         return make_shared<Function>(NodeVector{expand}, op::ParameterVector{A, B});
     };
 
-    auto backend = runtime::Backend::create("CPU");
-    auto cpu_f = make_function();
-    auto int_f = make_function();
+    weak_ptr<Node> cpu_constant;
+    weak_ptr<Node> int_constant;
+    auto cpu_f = make_function(cpu_constant);
+    auto int_f = make_function(int_constant);
 
     test::Uniform<float> rng(-100.0f, 100.0f);
     vector<vector<float>> args;
@@ -287,9 +335,10 @@ TEST(cpu_test, reshape_squeeze_padded)
         return make_shared<Function>(NodeVector{squeeze}, op::ParameterVector{A, B});
     };
 
-    auto backend = runtime::Backend::create("CPU");
-    auto cpu_f = make_function();
-    auto int_f = make_function();
+    weak_ptr<Node> cpu_constant;
+    weak_ptr<Node> int_constant;
+    auto cpu_f = make_function(cpu_constant);
+    auto int_f = make_function(int_constant);
 
     test::Uniform<float> rng(-100.0f, 100.0f);
     vector<vector<float>> args;
@@ -336,9 +385,10 @@ TEST(cpu_test, reshape_expand_squeeze)
         return make_shared<Function>(NodeVector{conv2}, op::ParameterVector{A, B1, B2});
     };
 
-    auto backend = runtime::Backend::create("CPU");
-    auto cpu_f = make_function();
-    auto int_f = make_function();
+    weak_ptr<Node> cpu_constant;
+    weak_ptr<Node> int_constant;
+    auto cpu_f = make_function(cpu_constant);
+    auto int_f = make_function(int_constant);
 
     test::Uniform<float> rng(-100.0f, 100.0f);
     vector<vector<float>> args;
@@ -357,3 +407,458 @@ TEST(cpu_test, reshape_expand_squeeze)
     }
     EXPECT_LE(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f), 4);
 }
+
+TEST(cpu_test, concurrent_calls)
+{
+    Shape shape{64, 32};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Relu>((A + B) * C - A),
+                                   op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(f);
+
+    const size_t num_threads = 4;
+    const size_t num_iterations = 50;
+    vector<size_t> mismatches(num_threads, 0);
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            vector<float> a(shape_size(shape), static_cast<float>(t + 1));
+            vector<float> b(shape_size(shape), 2.0f);
+            vector<float> c(shape_size(shape), 3.0f);
+            vector<float> expected(shape_size(shape), (t + 1 + 2.0f) * 3.0f - (t + 1));
+
+            auto ta = backend->create_tensor(element::f32, shape);
+            auto tb = backend->create_tensor(element::f32, shape);
+            auto tc = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            copy_data(ta, a);
+            copy_data(tb, b);
+            copy_data(tc, c);
+            for (size_t i = 0; i < num_iterations; i++)
+            {
+                backend->call_with_validate(f, {result}, {ta, tb, tc});
+                if (read_vector<float>(result) != expected)
+                {
+                    mismatches[t]++;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        EXPECT_EQ(mismatches[t], 0);
+    }
+}
+
+TEST(cpu_test, memory_sharing)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        Shape shape{32, 32};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto C = make_shared<op::Parameter>(element::f32, shape);
+        auto t0 = make_shared<op::Tanh>(A);
+        auto t1 = make_shared<op::Sigmoid>(t0 * B);
+        auto t2 = make_shared<op::Tanh>(t1 + A);
+        auto t3 = make_shared<op::Sigmoid>(t2 * t1);
+        auto t4 = make_shared<op::Tanh>(t3 - B);
+        auto t5 = make_shared<op::Sigmoid>(t4 * t3);
+        return make_shared<Function>(NodeVector{t5 * C}, op::ParameterVector{A, B, C});
+    };
+
+    auto unshared_f = make_function();
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(unshared_f);
+
+    bool share_memory = (getenv("NGRAPH_CPU_MEMORY_SHARING") != nullptr);
+    if (!share_memory)
+    {
+        setenv("NGRAPH_CPU_MEMORY_SHARING", "1", 1);
+    }
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    backend->compile(cpu_f);
+    if (!share_memory)
+    {
+        unsetenv("NGRAPH_CPU_MEMORY_SHARING");
+    }
+    if (getenv("NGRAPH_CPU_USE_TBB") == nullptr)
+    {
+        EXPECT_LT(cpu_f->get_temporary_pool_size(), unshared_f->get_temporary_pool_size());
+    }
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    vector<shared_ptr<runtime::Tensor>> arg_tensors;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        arg_tensors.push_back(backend->create_tensor(element::f32, param->get_shape()));
+        copy_data(arg_tensors.back(), args.at(arg_tensors.size() - 1));
+    }
+    auto result = backend->create_tensor(element::f32, cpu_f->get_output_shape(0));
+    backend->call_with_validate(cpu_f, {result}, arg_tensors);
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), int_results.at(0), 1.0e-4f, 1.0e-4f));
+
+    // Change one argument at a time so ops with cached inputs are skipped
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        rng.initialize(args[i]);
+        copy_data(arg_tensors[i], args[i]);
+        backend->call_with_validate(cpu_f, {result}, arg_tensors);
+        int_results = execute(int_f, args, "INTERPRETER");
+        EXPECT_TRUE(
+            test::all_close(read_vector<float>(result), int_results.at(0), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_test, performance_counters)
+{
+    Shape shape{16, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto mul = make_shared<op::Multiply>(add, C);
+    auto f = make_shared<Function>(mul, op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    backend->enable_performance_data(f, true);
+    backend->compile(f);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 1.0f));
+    copy_data(b, vector<float>(shape_size(shape), 2.0f));
+    copy_data(c, vector<float>(shape_size(shape), 3.0f));
+
+    const size_t num_calls = 3;
+    for (size_t i = 0; i < num_calls; i++)
+    {
+        backend->call_with_validate(f, {result}, {a, b, c});
+    }
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 9.0f));
+
+    bool found_add = false;
+    bool found_mul = false;
+    for (const runtime::PerformanceCounter& counter : backend->get_performance_data(f))
+    {
+        EXPECT_GT(counter.call_count(), 0);
+        if (counter.name() == add->get_name())
+        {
+            found_add = true;
+        }
+        else if (counter.name() == mul->get_name())
+        {
+            found_mul = true;
+            EXPECT_EQ(counter.call_count(), num_calls);
+        }
+    }
+    EXPECT_TRUE(found_add);
+    EXPECT_TRUE(found_mul);
+}
+
+TEST(cpu_test, intra_op_parallelism)
+{
+    auto backend = runtime::Backend::create("CPU");
+    static_pointer_cast<runtime::cpu::CPU_Backend>(backend)->set_intra_op_parallelism(2);
+
+    // Sizes on either side of the threshold for running on the thread pool
+    for (size_t size : {size_t(16), size_t(1 << 17)})
+    {
+        Shape shape{size};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::Exp>(A) * B, op::ParameterVector{A, B});
+
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<vector<float>> args;
+        for (shared_ptr<op::Parameter> param : f->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_shape()));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, args[0]);
+        copy_data(b, args[1]);
+        backend->call_with_validate(f, {result}, {a, b});
+
+        vector<float> expected(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            expected[i] = std::exp(args[0][i]) * args[1][i];
+        }
+        EXPECT_TRUE(test::all_close(read_vector<float>(result), expected, 1.0e-5f, 1.0e-5f));
+    }
+}
+
+TEST(cpu_test, bf16_kernels)
+{
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::bf16, Shape{1, 4, 8, 8});
+        auto W = make_shared<op::Parameter>(element::bf16, Shape{8, 4, 3, 3});
+        auto B = make_shared<op::Parameter>(element::bf16, Shape{8, 1, 1, 16});
+        auto conv = make_shared<op::Convolution>(A, W, Strides{1, 1}, Strides{1, 1});
+        auto relu = make_shared<op::Relu>(conv);
+        auto max_pool = make_shared<op::MaxPool>(relu, Shape{2, 2}, Strides{2, 2});
+        auto avg_pool = make_shared<op::AvgPool>(max_pool, Shape{3, 3});
+        auto dot = make_shared<op::Dot>(avg_pool, B, 3);
+        auto f = make_shared<op::Tanh>(dot * dot - make_shared<op::Abs>(dot));
+        return make_shared<Function>(NodeVector{f}, op::ParameterVector{A, W, B});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    vector<vector<bfloat16>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(vector<bfloat16>(tensor_val.begin(), tensor_val.end()));
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        vector<float> cpu_values(cpu_results.at(i).begin(), cpu_results.at(i).end());
+        vector<float> int_values(int_results.at(i).begin(), int_results.at(i).end());
+        EXPECT_TRUE(test::all_close(cpu_values, int_values, 1.0e-2f, 1.0e-2f));
+    }
+}
+
+TEST(cpu_test, reduce_function_lowering)
+{
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    // max(x, y) written so that it is not recognized as a single op and has to be called
+    auto make_reducer = [](bool native) -> std::shared_ptr<Function> {
+        auto X = make_shared<op::Parameter>(element::f32, Shape{});
+        auto Y = make_shared<op::Parameter>(element::f32, Shape{});
+        auto max = make_shared<op::Maximum>(Y, X);
+        shared_ptr<Node> result = native ? max : make_shared<op::Maximum>(max, X);
+        return make_shared<Function>(result, op::ParameterVector{X, Y});
+    };
+    auto make_function = [&make_reducer](bool native) -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{3, 1000});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{});
+        auto reduce = make_shared<op::Reduce>(A, B, make_reducer(native), AxisSet{1});
+        auto reduce_window = make_shared<op::ReduceWindow>(
+            A, B, make_reducer(native), Shape{2, 10}, Strides{1, 10});
+        return make_shared<Function>(NodeVector{reduce, reduce_window},
+                                     op::ParameterVector{A, B});
+    };
+
+    vector<vector<float>> args;
+    vector<float> tensor_val(3 * 1000);
+    rng.initialize(tensor_val);
+    args.push_back(tensor_val);
+    // An initial value above some of the window maxima
+    args.push_back(vector<float>{0.5f});
+
+    auto int_results = execute(make_function(true), args, "INTERPRETER");
+    for (bool native : {true, false})
+    {
+        auto cpu_results = execute(make_function(native), args, "CPU");
+        for (size_t i = 0; i < cpu_results.size(); i++)
+        {
+            EXPECT_EQ(cpu_results.at(i), int_results.at(i));
+        }
+    }
+}
+
+TEST(cpu_test, reduce_function_lowering_initial_value)
+{
+    // The native Add and Multiply reductions fold the initial value in once per output element
+    auto make_reducer = [](bool add, bool native) -> std::shared_ptr<Function> {
+        auto X = make_shared<op::Parameter>(element::f32, Shape{});
+        auto Y = make_shared<op::Parameter>(element::f32, Shape{});
+        shared_ptr<Node> result;
+        if (add)
+        {
+            result = native ? X + Y : (Y + X) + (X - X);
+        }
+        else
+        {
+            result = native ? X * Y : (Y * X) * (X / X);
+        }
+        return make_shared<Function>(result, op::ParameterVector{X, Y});
+    };
+    auto make_function = [&make_reducer](bool native) -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{4, 20});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{});
+        auto sum = make_shared<op::Reduce>(A, B, make_reducer(true, native), AxisSet{1});
+        auto prod = make_shared<op::Reduce>(A, B, make_reducer(false, native), AxisSet{0});
+        auto sum_window = make_shared<op::ReduceWindow>(
+            A, B, make_reducer(true, native), Shape{2, 5}, Strides{1, 3});
+        auto prod_window = make_shared<op::ReduceWindow>(
+            A, B, make_reducer(false, native), Shape{3, 2}, Strides{1, 2});
+        return make_shared<Function>(NodeVector{sum, prod, sum_window, prod_window},
+                                     op::ParameterVector{A, B});
+    };
+
+    test::Uniform<float> rng(0.5f, 1.5f);
+    vector<vector<float>> args;
+    vector<float> tensor_val(4 * 20);
+    rng.initialize(tensor_val);
+    args.push_back(tensor_val);
+    // Neither the identity of Add nor of Multiply
+    args.push_back(vector<float>{2.5f});
+
+    auto int_results = execute(make_function(true), args, "INTERPRETER");
+    for (bool native : {true, false})
+    {
+        auto cpu_results = execute(make_function(native), args, "CPU");
+        for (size_t i = 0; i < cpu_results.size(); i++)
+        {
+            EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-5f, 1.0e-5f));
+        }
+    }
+}
+
+TEST(cpu_test, select_and_scatter_lowering)
+{
+    // Each comparison with the operands in order is lowered natively, swapped operands are
+    // called through the function
+    using Comparison = function<shared_ptr<Node>(shared_ptr<Node>, shared_ptr<Node>)>;
+    vector<Comparison> comparisons{
+        [](shared_ptr<Node> x, shared_ptr<Node> y) { return make_shared<op::Greater>(x, y); },
+        [](shared_ptr<Node> x, shared_ptr<Node> y) { return make_shared<op::GreaterEq>(x, y); },
+        [](shared_ptr<Node> x, shared_ptr<Node> y) { return make_shared<op::Less>(x, y); },
+        [](shared_ptr<Node> x, shared_ptr<Node> y) { return make_shared<op::LessEq>(x, y); }};
+    auto make_select = [](const Comparison& comparison, bool swapped) {
+        auto X = make_shared<op::Parameter>(element::f32, Shape{});
+        auto Y = make_shared<op::Parameter>(element::f32, Shape{});
+        return make_shared<Function>(swapped ? comparison(Y, X) : comparison(X, Y),
+                                     op::ParameterVector{X, Y});
+    };
+    auto make_scatter = [](bool native) {
+        auto X = make_shared<op::Parameter>(element::f32, Shape{});
+        auto Y = make_shared<op::Parameter>(element::f32, Shape{});
+        shared_ptr<Node> result = native ? X + Y : X + Y + X - X;
+        return make_shared<Function>(result, op::ParameterVector{X, Y});
+    };
+    auto make_function = [&](const Comparison& comparison, bool swapped, bool native_scatter) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{6, 7});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{3, 3});
+        auto C = make_shared<op::Parameter>(element::f32, Shape{});
+        // Overlapping windows, so elements are selected by more than one window
+        auto select_and_scatter =
+            make_shared<op::SelectAndScatter>(A,
+                                              B,
+                                              C,
+                                              make_select(comparison, swapped),
+                                              make_scatter(native_scatter),
+                                              Shape{3, 3},
+                                              Strides{2, 2});
+        return make_shared<Function>(select_and_scatter, op::ParameterVector{A, B, C});
+    };
+
+    // Few distinct values, so windows have ties that tell Greater from GreaterEq. Small
+    // integers keep the sums exact.
+    vector<vector<float>> args;
+    vector<float> selectee(6 * 7);
+    for (size_t i = 0; i < selectee.size(); i++)
+    {
+        selectee[i] = static_cast<float>((i * 5) % 3);
+    }
+    args.push_back(selectee);
+    vector<float> source(3 * 3);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        source[i] = static_cast<float>(i + 1);
+    }
+    args.push_back(source);
+    args.push_back(vector<float>{0.5f});
+
+    for (const Comparison& comparison : comparisons)
+    {
+        for (bool swapped : {false, true})
+        {
+            auto int_results =
+                execute(make_function(comparison, swapped, true), args, "INTERPRETER");
+            for (bool native_scatter : {true, false})
+            {
+                auto cpu_results =
+                    execute(make_function(comparison, swapped, native_scatter), args, "CPU");
+                EXPECT_EQ(cpu_results.at(0), int_results.at(0));
+            }
+        }
+    }
+}
+
+TEST(cpu_test, nested_function_call)
+{
+    Shape shape{4, 8};
+    auto make_function = [&shape]() {
+        // f(A, B, C) = (A + B) * C has an intermediate in its pool
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto C = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B, C});
+
+        // g(P, Q) = f(P, Q, P) - f(Q, Q, P) nests the pool of f twice
+        auto P = make_shared<op::Parameter>(element::f32, shape);
+        auto Q = make_shared<op::Parameter>(element::f32, shape);
+        auto g = make_shared<Function>(make_shared<op::FunctionCall>(f, NodeVector{P, Q, P}) -
+                                           make_shared<op::FunctionCall>(f, NodeVector{Q, Q, P}),
+                                       op::ParameterVector{P, Q});
+
+        auto X = make_shared<op::Parameter>(element::f32, shape);
+        auto Y = make_shared<op::Parameter>(element::f32, shape);
+        auto call = make_shared<op::FunctionCall>(g, NodeVector{X * Y, Y});
+        return make_shared<Function>(
+            NodeVector{call, make_shared<op::FunctionCall>(g, NodeVector{call, X}) + X},
+            op::ParameterVector{X, Y});
+    };
+
+    weak_ptr<Node> cpu_constant;
+    weak_ptr<Node> int_constant;
+    auto cpu_f = make_function(cpu_constant);
+    auto int_f = make_function(int_constant);
+    auto x = backend->create_tensor(element::f32, shape);
+    auto y = backend->create_tensor(element::f32, shape);
+    auto r0 = backend->create_tensor(element::f32, shape);
+    auto r1 = backend->create_tensor(element::f32, shape);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    // Repeated calls run on the persistent callee frames of the same call frame
+    for (size_t i = 0; i < 3; i++)
+    {
+        vector<vector<float>> args;
+        for (size_t j = 0; j < 2; j++)
+        {
+            vector<float> tensor_val(shape_size(shape));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+        copy_data(x, args[0]);
+        copy_data(y, args[1]);
+        backend->call_with_validate(cpu_f, {r0, r1}, {x, y});
+
+        auto int_results = execute(int_f, args, "INTERPRETER");
+        EXPECT_TRUE(test::all_close(read_vector<float>(r0), int_results.at(0)));
+        EXPECT_TRUE(test::all_close(read_vector<float>(r1), int_results.at(1)));
+    }
+}
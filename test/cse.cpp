@@ -307,3 +307,63 @@ TEST(CSE, constant)
     ASSERT_NE(abs0->get_argument(0), absf->get_argument(0));
     ASSERT_NE(abs111->get_argument(0), abs112->get_argument(0));
 }
+
+TEST(CSE, constant_across_functions)
+{
+    Shape shape{2, 3};
+    vector<float> weights{1, 2, 3, 4, 5, 6};
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto callee_weights = op::Constant::create(element::f32, shape, weights);
+    auto callee = make_shared<Function>(A * callee_weights, op::ParameterVector{A});
+
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto caller_weights = op::Constant::create(element::f32, shape, weights);
+    auto other_weights = op::Constant::create(element::f32, shape, {6, 5, 4, 3, 2, 1});
+    auto call = make_shared<op::FunctionCall>(callee, NodeVector{X + caller_weights});
+    auto f = make_shared<Function>(call * other_weights, op::ParameterVector{X});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    // The callee keeps a node of its own that shares the caller's data
+    auto callee_constant = static_pointer_cast<op::Constant>(
+        callee->get_results().at(0)->get_argument(0)->get_argument(1));
+    ASSERT_NE(callee_constant, caller_weights);
+    ASSERT_EQ(callee_constant->get_data_ptr(), caller_weights->get_data_ptr());
+    ASSERT_EQ(caller_weights->get_users().size(), 1);
+    ASSERT_EQ(call->get_argument(0)->get_argument(1), caller_weights);
+    ASSERT_NE(f->get_results().at(0)->get_argument(0)->get_argument(1), caller_weights);
+
+    // Running again finds nothing left to share
+    vector<shared_ptr<Function>> functions{f, callee};
+    ngraph::pass::CommonSubexpressionElimination cse;
+    ASSERT_FALSE(cse.run_on_module(functions));
+}
+
+TEST(CSE, many_constants)
+{
+    // Constants that differ in a single element, plus one duplicate of each
+    size_t count = 1000;
+    Shape shape{64};
+    NodeVector results;
+    for (size_t i = 0; i < count; i++)
+    {
+        vector<int32_t> values(shape_size(shape), 0);
+        values[i % values.size()] = static_cast<int32_t>(i);
+        results.push_back(make_shared<op::Abs>(op::Constant::create(element::i32, shape, values)));
+        results.push_back(make_shared<op::Abs>(op::Constant::create(element::i32, shape, values)));
+    }
+    auto f = make_shared<Function>(results, op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Constant>(f), count);
+    for (size_t i = 0; i < count; i++)
+    {
+        ASSERT_EQ(results.at(2 * i)->get_argument(0), results.at(2 * i + 1)->get_argument(0));
+    }
+}
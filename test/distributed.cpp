@@ -23,6 +23,8 @@
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/manager.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/random.hpp"
 
@@ -52,3 +54,81 @@ TEST(distributed_${BACKEND_NAME}, allreduce)
     backend->call_with_validate(f, {result}, {a});
     EXPECT_EQ(v, read_vector<float>(result));
 }
+
+TEST(distributed_${BACKEND_NAME}, allreduce_bucketing)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto C = make_shared<op::Parameter>(element::f64, Shape{2});
+    auto D = make_shared<op::Parameter>(element::f32, Shape{4});
+    // A and B fill a 28 byte bucket, C has another element type and D needs a bucket of its own
+    auto f = make_shared<Function>(NodeVector{make_shared<op::AllReduce>(A),
+                                              make_shared<op::AllReduce>(B),
+                                              make_shared<op::AllReduce>(C),
+                                              make_shared<op::AllReduce>(D) * D},
+                                   op::ParameterVector{A, B, C, D});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(28);
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::AllReduceStart>(f), 3);
+    EXPECT_EQ(count_ops_of_type<op::AllReduceWait>(f), 3);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    int comm_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+    auto a = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, Shape{3});
+    copy_data(b, vector<float>{5, 6, 7});
+    auto c = backend->create_tensor(element::f64, Shape{2});
+    copy_data(c, vector<double>{0.5, 1.5});
+    auto d = backend->create_tensor(element::f32, Shape{4});
+    copy_data(d, vector<float>{1, 2, 3, 4});
+    auto ra = backend->create_tensor(element::f32, Shape{2, 2});
+    auto rb = backend->create_tensor(element::f32, Shape{3});
+    auto rc = backend->create_tensor(element::f64, Shape{2});
+    auto rd = backend->create_tensor(element::f32, Shape{4});
+
+    float n = static_cast<float>(comm_size);
+    // Every call starts and waits for the buckets again
+    for (size_t i = 0; i < 2; i++)
+    {
+        backend->call_with_validate(f, {ra, rb, rc, rd}, {a, b, c, d});
+        EXPECT_EQ((vector<float>{n, 2 * n, 3 * n, 4 * n}), read_vector<float>(ra));
+        EXPECT_EQ((vector<float>{5 * n, 6 * n, 7 * n}), read_vector<float>(rb));
+        EXPECT_EQ((vector<double>{0.5 * n, 1.5 * n}), read_vector<double>(rc));
+        EXPECT_EQ((vector<float>{n, 4 * n, 9 * n, 16 * n}), read_vector<float>(rd));
+    }
+}
+
+TEST(distributed_${BACKEND_NAME}, allreduce_bucketing_dependent)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    // The second AllReduce reduces a result of the first, so they can't share a bucket
+    auto first = make_shared<op::AllReduce>(A);
+    auto second = make_shared<op::AllReduce>(first * A);
+    auto f = make_shared<Function>(second, op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::AllReduceStart>(f), 2);
+    EXPECT_EQ(count_ops_of_type<op::AllReduceWait>(f), 2);
+    EXPECT_EQ(f->get_ordered_ops().size(), 9);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    int comm_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+    auto a = backend->create_tensor(element::f32, Shape{2});
+    copy_data(a, vector<float>{1, 2});
+    auto result = backend->create_tensor(element::f32, Shape{2});
+
+    float n = static_cast<float>(comm_size);
+    backend->call_with_validate(f, {result}, {a});
+    EXPECT_EQ((vector<float>{n * n, 4 * n * n}), read_vector<float>(result));
+}
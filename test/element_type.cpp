@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
 #include <map>
 
 #include "gtest/gtest.h"
@@ -28,6 +29,7 @@ TEST(element_type, from)
     EXPECT_EQ(element::from<bool>(), element::boolean);
     EXPECT_EQ(element::from<float>(), element::f32);
     EXPECT_EQ(element::from<double>(), element::f64);
+    EXPECT_EQ(element::from<bfloat16>(), element::bf16);
     EXPECT_EQ(element::from<int8_t>(), element::i8);
     EXPECT_EQ(element::from<int16_t>(), element::i16);
     EXPECT_EQ(element::from<int32_t>(), element::i32);
@@ -84,3 +86,25 @@ TEST(element_type, size)
         EXPECT_EQ(2, t1.size());
     }
 }
+
+TEST(element_type, bfloat16)
+{
+    EXPECT_EQ(2, element::bf16.size());
+    EXPECT_TRUE(element::bf16.is_real());
+    EXPECT_EQ(element::bf16, element::Type(16, true, true, false, "bfloat16"));
+
+    // The bits of a bfloat16 are the upper half of the bits of a float
+    EXPECT_EQ(0x3F80, bfloat16(1.0f).to_bits());
+    EXPECT_EQ(0xC000, bfloat16(-2.0f).to_bits());
+    EXPECT_EQ(1.0f, static_cast<float>(bfloat16::from_bits(0x3F80)));
+
+    // Round to nearest, ties to even
+    EXPECT_EQ(1.0f, static_cast<float>(bfloat16(1.001f)));
+    EXPECT_EQ(1.0078125f, static_cast<float>(bfloat16(1.006f)));
+    EXPECT_EQ(1.0f, static_cast<float>(bfloat16(1.00390625f)));
+    EXPECT_EQ(1.015625f, static_cast<float>(bfloat16(1.01171875f)));
+
+    EXPECT_EQ(std::numeric_limits<float>::infinity(),
+              static_cast<float>(bfloat16(std::numeric_limits<float>::max())));
+    EXPECT_TRUE(std::isnan(static_cast<float>(bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+}
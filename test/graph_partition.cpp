@@ -50,156 +50,17 @@ static function<Placement(shared_ptr<Node>)> int_with_cpu_mul_policy = [](shared
     return placement;
 };
 
-// HybridCallFrame servers 2 purposes:
-// 1. HybridBackend's main use case is to test device placement and graph partition routines.
-// 2. It also shows how glued-hybrid runtime can be built by combining different runtimes.
-//
-// By default, HybridBackend operates on INTERPRETER (for example, the tensor view is
-// INTERPRETER tensor view). It falls back to CPU when requested by placement.
-class HybridBackend
+#if defined(NGRAPH_CPU_ENABLE) && defined(NGRAPH_HYBRID_ENABLE)
+// Place the ops of f by int_with_cpu_mul_policy and run them on the hybrid backend, which keeps
+// placements that were assigned before compiling
+static shared_ptr<runtime::Backend> make_int_with_cpu_mul_backend(const shared_ptr<Function>& f)
 {
-public:
-    HybridBackend(const function<Placement(shared_ptr<Node>)>& placement_policy)
-        : m_placement_policy(placement_policy)
-    {
-    }
-
-    ~HybridBackend() {}
-    shared_ptr<runtime::Tensor> create_tensor(const element::Type& element_type, const Shape& shape)
-    {
-        return get_cached_backend(Placement::INTERPRETER)->create_tensor(element_type, shape);
-    }
-
-    bool compile(const shared_ptr<Function>& func)
-    {
-        if (m_function_map.find(func) == m_function_map.end())
-        {
-            // Clone function
-            FunctionInstance instance;
-            instance.m_function = clone_function(*func);
-
-            // Run placement pass
-            pass::Manager pass_manager;
-            pass_manager.register_pass<pass::AssignPlacement>(int_with_cpu_mul_policy);
-            pass_manager.run_passes(instance.m_function);
-
-            // Split function to sub_functions
-            tie(instance.m_sub_functions, instance.m_map_parameter_to_result) =
-                split_function_by_placement(instance.m_function);
-            m_function_map.insert({func, instance});
-
-            // Compile subfunctions in corresponding backends
-            for (shared_ptr<Function>& sub_function : instance.m_sub_functions)
-            {
-                Placement placement = get_colocated_function_placement(sub_function);
-                auto backend = get_cached_backend(placement);
-                backend->compile(sub_function);
-            }
-        }
-        return true;
-    }
-
-    bool call_with_validate(const shared_ptr<Function>& func,
-                            const vector<shared_ptr<runtime::Tensor>>& outputs,
-                            const vector<shared_ptr<runtime::Tensor>>& inputs)
-    {
-        // Get FunctionInstance
-        bool rc = true;
-        auto it = m_function_map.find(func);
-        if (it == m_function_map.end())
-        {
-            compile(func);
-            it = m_function_map.find(func);
-        }
-        if (it == m_function_map.end())
-        {
-            throw runtime_error("Error constructing backend.");
-        }
-        FunctionInstance& instance = it->second;
-
-        // Parameter and result node in sub_function maps to one Tensor
-        unordered_map<shared_ptr<Node>, shared_ptr<runtime::Tensor>> map_node_to_tensor_view;
-        for (size_t i = 0; i < inputs.size(); ++i)
-        {
-            map_node_to_tensor_view[instance.m_function->get_parameters()[i]] = inputs[i];
-        }
-        for (size_t i = 0; i < outputs.size(); ++i)
-        {
-            map_node_to_tensor_view[instance.m_function->get_results()[i]] = outputs[i];
-        }
-
-        // Call subfunctions
-        for (shared_ptr<Function>& sub_function : instance.m_sub_functions)
-        {
-            // Init backend
-            Placement placement = get_colocated_function_placement(sub_function);
-            auto backend = get_cached_backend(placement);
-
-            // Prepare parameter TensorViews
-            vector<shared_ptr<runtime::Tensor>> parameter_tvs;
-            for (auto parameter_node : sub_function->get_parameters())
-            {
-                if (map_node_to_tensor_view.find(parameter_node) != map_node_to_tensor_view.end())
-                {
-                    parameter_tvs.push_back(map_node_to_tensor_view.at(parameter_node));
-                }
-                else
-                {
-                    auto result_node = instance.m_map_parameter_to_result.at(parameter_node);
-                    auto result_tv = map_node_to_tensor_view.at(result_node);
-                    auto parameter_tv = backend->create_tensor(parameter_node->get_element_type(),
-                                                               parameter_node->get_shape());
-                    copy_data(parameter_tv, read_vector<float>(result_tv));
-                    map_node_to_tensor_view[parameter_node] = parameter_tv;
-                    parameter_tvs.push_back(parameter_tv);
-                }
-            }
-
-            // Prepare result TensorViews
-            vector<shared_ptr<runtime::Tensor>> result_tvs;
-            for (auto result_node : sub_function->get_results())
-            {
-                if (map_node_to_tensor_view.find(result_node) != map_node_to_tensor_view.end())
-                {
-                    result_tvs.push_back(map_node_to_tensor_view.at(result_node));
-                }
-                else
-                {
-                    auto result_tv = backend->create_tensor(result_node->get_element_type(),
-                                                            result_node->get_shape());
-                    map_node_to_tensor_view[result_node] = result_tv;
-                    result_tvs.push_back(result_tv);
-                }
-            }
-
-            // Call
-            backend->call_with_validate(sub_function, result_tvs, parameter_tvs);
-        }
-        return rc;
-    }
-
-protected:
-    class FunctionInstance
-    {
-    public:
-        shared_ptr<Function> m_function;
-        vector<shared_ptr<Function>> m_sub_functions;
-        unordered_map<shared_ptr<op::Parameter>, shared_ptr<op::Result>> m_map_parameter_to_result;
-    };
-
-    shared_ptr<runtime::Backend> get_cached_backend(Placement placement)
-    {
-        if (m_cached_backends.find(placement) == m_cached_backends.end())
-        {
-            m_cached_backends[placement] = runtime::Backend::create(placement_to_string(placement));
-        }
-        return m_cached_backends.at(placement);
-    }
-
-    map<Placement, shared_ptr<runtime::Backend>> m_cached_backends;
-    map<shared_ptr<Function>, FunctionInstance> m_function_map;
-    function<Placement(shared_ptr<Node>)> m_placement_policy;
-};
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AssignPlacement>(int_with_cpu_mul_policy);
+    pass_manager.run_passes(f);
+    return runtime::Backend::create("HYBRID:INTERPRETER,CPU");
+}
+#endif
 
 TEST(graph_partition, placement_all_cpu_policy)
 {
@@ -346,9 +207,10 @@ TEST(graph_partition, hybrid_abc_manual)
               (test::NDArray<float, 2>({{54, 80}, {110, 144}})).get_vector());
 }
 
+#ifdef NGRAPH_HYBRID_ENABLE
 TEST(graph_partition, hybrid_abc)
 {
-    // Same as hybrid_abc_manual, but using the test hybrid transformer
+    // Same as hybrid_abc_manual, but using the hybrid backend
     //
     // A   B   C    A   B     C
     //  \ /   /      \ /     /
@@ -375,7 +237,7 @@ TEST(graph_partition, hybrid_abc)
     auto R = make_shared<op::Result>(E);
     auto f = make_shared<Function>(ResultVector{R}, op::ParameterVector{A, B, C});
 
-    auto backend = make_shared<HybridBackend>(int_with_cpu_mul_policy);
+    auto backend = make_int_with_cpu_mul_backend(f);
     shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
     shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
     shared_ptr<runtime::Tensor> c = backend->create_tensor(element::f32, shape);
@@ -410,7 +272,7 @@ TEST(graph_partition, hybrid_abcd)
     shared_ptr<Node> H = F + G;
     shared_ptr<Function> f = make_shared<Function>(H, op::ParameterVector{A, B, C, D});
 
-    auto backend = make_shared<HybridBackend>(int_with_cpu_mul_policy);
+    auto backend = make_int_with_cpu_mul_backend(f);
     backend->compile(f);
 
     shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
@@ -446,7 +308,7 @@ TEST(graph_partition, hybrid_back_and_forth)
     shared_ptr<Node> F = E * C;
     shared_ptr<Function> f = make_shared<Function>(F, op::ParameterVector{A, B, C});
 
-    auto backend = make_shared<HybridBackend>(int_with_cpu_mul_policy);
+    auto backend = make_int_with_cpu_mul_backend(f);
     backend->compile(f);
 
     shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
@@ -483,7 +345,7 @@ TEST(graph_partition, hybrid_multi_middle_nodes)
     shared_ptr<Node> H = F + G;
     shared_ptr<Function> f = make_shared<Function>(H, op::ParameterVector{A, B, C});
 
-    auto backend = make_shared<HybridBackend>(int_with_cpu_mul_policy);
+    auto backend = make_int_with_cpu_mul_backend(f);
     backend->compile(f);
 
     shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
@@ -511,7 +373,7 @@ TEST(graph_partition, hybrid_no_split)
     shared_ptr<Node> C = A + B;
     shared_ptr<Function> f = make_shared<Function>(C, op::ParameterVector{A, B});
 
-    auto backend = make_shared<HybridBackend>(int_with_cpu_mul_policy);
+    auto backend = make_int_with_cpu_mul_backend(f);
     backend->compile(f);
 
     shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
@@ -525,4 +387,76 @@ TEST(graph_partition, hybrid_no_split)
     EXPECT_EQ(read_vector<float>(c), (test::NDArray<float, 2>({{6, 8}, {10, 12}})).get_vector());
 }
 
+TEST(graph_partition, hybrid_default_placement)
+{
+    // Every op is supported by CPU, so nothing runs on INTERPRETER
+    Shape shape = Shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("HYBRID:CPU,INTERPRETER");
+    EXPECT_TRUE(backend->is_supported(*f->get_results().at(0)->get_argument(0)));
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> c = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> r = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, test::NDArray<float, 2>({{1, 2}, {3, 4}}).get_vector());
+    copy_data(b, test::NDArray<float, 2>({{5, 6}, {7, 8}}).get_vector());
+    copy_data(c, test::NDArray<float, 2>({{9, 10}, {11, 12}}).get_vector());
+
+    // Calls reuse the compiled partitions and the caller's tensors
+    for (size_t i = 0; i < 2; i++)
+    {
+        backend->call_with_validate(f, {r}, {a, b, c});
+        EXPECT_EQ(read_vector<float>(r),
+                  (test::NDArray<float, 2>({{54, 80}, {110, 144}})).get_vector());
+    }
+    for (auto node : f->get_ordered_ops())
+    {
+        EXPECT_EQ(node->get_placement(), Placement::DEFAULT);
+    }
+}
+
+TEST(graph_partition, hybrid_unsupported_op_fallback)
+{
+    // CPU has no kernel for Quantize and Dequantize, so they fall back to INTERPRETER while
+    // Add and Multiply stay on CPU
+    Shape shape = Shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto scale = op::Constant::create(element::f32, Shape{}, {2});
+    auto offset = op::Constant::create(element::u8, Shape{}, {1});
+    auto quantize = make_shared<op::Quantize>(A + B,
+                                              scale,
+                                              offset,
+                                              element::u8,
+                                              AxisSet{},
+                                              op::Quantize::RoundMode::HALF_AWAY_FROM_ZERO);
+    auto dequantize = make_shared<op::Dequantize>(quantize, scale, offset, element::f32, AxisSet{});
+    auto f = make_shared<Function>(dequantize * C, op::ParameterVector{A, B, C});
+
+    EXPECT_FALSE(runtime::Backend::create("CPU")->is_supported(*quantize));
+    auto backend = runtime::Backend::create("HYBRID:CPU,INTERPRETER");
+    EXPECT_TRUE(backend->is_supported(*quantize));
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> c = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> r = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, test::NDArray<float, 2>({{1, 2}, {3, 4}}).get_vector());
+    copy_data(b, test::NDArray<float, 2>({{3, 4}, {5, 6}}).get_vector());
+    copy_data(c, test::NDArray<float, 2>({{1, 2}, {3, 4}}).get_vector());
+
+    // A + B is even, so it survives quantization with a scale of 2 exactly
+    backend->call_with_validate(f, {r}, {a, b, c});
+    EXPECT_EQ(read_vector<float>(r), (test::NDArray<float, 2>({{4, 12}, {24, 40}})).get_vector());
+}
+#endif
+
 #endif
@@ -56,6 +56,31 @@ TEST(onnx, model_add_abc_initializers)
     EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
 }
 
+TEST(onnx, model_add_abc_external_data)
+{
+    auto function = onnx_import::import_onnx_function(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_external_data.onnx"));
+
+    Inputs inputs{{1, 2, 3, 4}};
+    Outputs expected_outputs{{3, 6, 9, 12}};
+
+    Outputs outputs{execute(function, inputs, "INTERPRETER")};
+    EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
+}
+
+TEST(onnx, model_add_abc_external_data_mapped)
+{
+    Model model{onnx_import::load_onnx_model_mapped(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_external_data.onnx"))};
+    ASSERT_EQ(model.size(), 1);
+
+    Inputs inputs{{1, 2, 3, 4}};
+    Outputs expected_outputs{{3, 6, 9, 12}};
+
+    Outputs outputs{execute(model.front(), inputs, "INTERPRETER")};
+    EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
+}
+
 TEST(onnx, model_addmul_abc)
 {
     auto function = onnx_import::import_onnx_function(
@@ -15,10 +15,14 @@
 //*****************************************************************************
 
 #include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <onnxifi.h>
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 
 const constexpr std::size_t g_backend_ids_count{10};
@@ -66,3 +70,134 @@ TEST(onnxifi, get_backend_ids_consistency_check)
     EXPECT_TRUE(first_count == second_count);
     EXPECT_TRUE(std::memcmp(first_ids, second_ids, first_count) == 0);
 }
+
+namespace
+{
+    ::onnxTensorDescriptorV1 make_descriptor(const char* name, const uint64_t* shape, float* value)
+    {
+        return {ONNXIFI_TAG_TENSOR_DESCRIPTOR_V1,
+                name,
+                ONNXIFI_DATATYPE_FLOAT32,
+                ONNXIFI_MEMORY_TYPE_CPU,
+                1,
+                shape,
+                reinterpret_cast<::onnxPointer>(value)};
+    }
+
+    ::onnxMemoryFenceV1 make_fence()
+    {
+        ::onnxMemoryFenceV1 fence;
+        fence.tag = ONNXIFI_TAG_MEMORY_FENCE_V1;
+        fence.type = ONNXIFI_SYNCHRONIZATION_EVENT;
+        return fence;
+    }
+
+    // Y = (A + B) + C initialized on the first backend, with C supplied as a weight and
+    // A, B and Y bound to the members of the fixture
+    class onnxifi_graph : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            std::ifstream model_file{
+                ngraph::file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc.onnx"),
+                std::ios::in | std::ios::binary};
+            std::vector<char> model{std::istreambuf_iterator<char>{model_file},
+                                    std::istreambuf_iterator<char>{}};
+
+            ::onnxBackendID backendIDs[g_backend_ids_count];
+            std::size_t count{g_backend_ids_count};
+            ASSERT_TRUE(::onnxGetBackendIDs(backendIDs, &count) == ONNXIFI_STATUS_SUCCESS);
+            ASSERT_TRUE(count > 0);
+            ASSERT_TRUE(::onnxInitBackend(backendIDs[0], nullptr, &m_backend) ==
+                        ONNXIFI_STATUS_SUCCESS);
+
+            ::onnxTensorDescriptorV1 weight{make_descriptor("C", m_shape, &m_c)};
+            ASSERT_TRUE(::onnxInitGraph(m_backend,
+                                        nullptr,
+                                        model.size(),
+                                        model.data(),
+                                        1,
+                                        &weight,
+                                        &m_graph) == ONNXIFI_STATUS_SUCCESS);
+
+            // Inputs are matched by name, not by position
+            m_inputs[0] = make_descriptor("B", m_shape, &m_b);
+            m_inputs[1] = make_descriptor("A", m_shape, &m_a);
+            m_output = make_descriptor("Y", m_shape, &m_y);
+            ASSERT_TRUE(::onnxSetGraphIO(m_graph, 2, m_inputs, 1, &m_output) ==
+                        ONNXIFI_STATUS_SUCCESS);
+        }
+
+        void TearDown() override
+        {
+            if (m_graph != nullptr)
+            {
+                EXPECT_TRUE(::onnxReleaseGraph(m_graph) == ONNXIFI_STATUS_SUCCESS);
+            }
+            if (m_backend != nullptr)
+            {
+                EXPECT_TRUE(::onnxReleaseBackend(m_backend) == ONNXIFI_STATUS_SUCCESS);
+            }
+        }
+
+        const uint64_t m_shape[1]{1};
+        float m_a{1};
+        float m_b{2};
+        float m_c{3};
+        float m_y{0};
+        ::onnxTensorDescriptorV1 m_inputs[2];
+        ::onnxTensorDescriptorV1 m_output;
+        ::onnxBackend m_backend{nullptr};
+        ::onnxGraph m_graph{nullptr};
+    };
+}
+
+TEST_F(onnxifi_graph, lifecycle)
+{
+    for (float step : {0.0f, 10.0f})
+    {
+        m_a = 1 + step;
+        ::onnxMemoryFenceV1 input_fence{make_fence()};
+        ASSERT_TRUE(::onnxInitEvent(m_backend, &input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+        ::onnxMemoryFenceV1 output_fence{make_fence()};
+
+        ASSERT_TRUE(::onnxRunGraph(m_graph, &input_fence, &output_fence) ==
+                    ONNXIFI_STATUS_SUCCESS);
+        EXPECT_TRUE(::onnxSignalEvent(input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+        EXPECT_TRUE(::onnxWaitEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+        EXPECT_EQ(m_y, 6 + step);
+
+        EXPECT_TRUE(::onnxReleaseEvent(input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+        EXPECT_TRUE(::onnxReleaseEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    }
+
+    ::onnxTensorDescriptorV1 unknown{m_output};
+    unknown.name = "Z";
+    EXPECT_TRUE(::onnxSetGraphIO(m_graph, 2, m_inputs, 1, &unknown) ==
+                ONNXIFI_STATUS_UNIDENTIFIED_NAME);
+}
+
+TEST_F(onnxifi_graph, queued_runs)
+{
+    // Both runs are queued before any input is ready, so onnxRunGraph must not wait
+    ::onnxMemoryFenceV1 input_fences[2];
+    ::onnxMemoryFenceV1 output_fences[2];
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        input_fences[i] = make_fence();
+        ASSERT_TRUE(::onnxInitEvent(m_backend, &input_fences[i].event) ==
+                    ONNXIFI_STATUS_SUCCESS);
+        output_fences[i] = make_fence();
+        ASSERT_TRUE(::onnxRunGraph(m_graph, &input_fences[i], &output_fences[i]) ==
+                    ONNXIFI_STATUS_SUCCESS);
+    }
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        EXPECT_TRUE(::onnxSignalEvent(input_fences[i].event) == ONNXIFI_STATUS_SUCCESS);
+        EXPECT_TRUE(::onnxWaitEvent(output_fences[i].event) == ONNXIFI_STATUS_SUCCESS);
+        EXPECT_EQ(m_y, 6);
+        EXPECT_TRUE(::onnxReleaseEvent(input_fences[i].event) == ONNXIFI_STATUS_SUCCESS);
+        EXPECT_TRUE(::onnxReleaseEvent(output_fences[i].event) == ONNXIFI_STATUS_SUCCESS);
+    }
+}
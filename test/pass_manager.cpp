@@ -59,3 +59,39 @@ TEST(pass_manager, module_add_function)
                                        make_shared<op::FunctionCall>(f, NodeVector{X, Y, Z}),
                                    op::ParameterVector{X, Y, Z});
 }
+
+TEST(pass_manager, modified_node_tracker)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto mul = add * C;
+    auto f = make_shared<Function>(mul, op::ParameterVector{A, B, C});
+
+    ModifiedNodeTracker outer;
+    {
+        ModifiedNodeTracker inner;
+        EXPECT_TRUE(inner.empty());
+        replace_node(add, A - B);
+        ASSERT_EQ(inner.get_modified_nodes().size(), 1);
+        EXPECT_EQ(inner.get_modified_nodes().at(0), mul);
+        EXPECT_TRUE(outer.empty());
+    }
+    // The enclosing tracker sees the changes of nested ones
+    ASSERT_EQ(outer.get_modified_nodes().size(), 1);
+    EXPECT_EQ(outer.get_modified_nodes().at(0), mul);
+
+    // Nodes that are gone are not reported
+    auto dead = make_shared<op::Negative>(C);
+    dead->get_inputs().at(0).replace_output(B, 0);
+    EXPECT_EQ(outer.get_modified_nodes().size(), 2);
+    dead = nullptr;
+    EXPECT_EQ(outer.get_modified_nodes().size(), 1);
+
+    outer.clear();
+    EXPECT_TRUE(outer.empty());
+    validate_downstream_nodes_and_infer_types(NodeVector{mul});
+    EXPECT_EQ(f->get_results().at(0)->get_argument(0), mul);
+}
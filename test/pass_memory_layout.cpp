@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <memory>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -204,6 +206,131 @@ TEST(memory_manager, memory_align)
     EXPECT_EQ(128, mm.allocate(4));
 }
 
+TEST(memory_manager, best_fit)
+{
+    pass::MemoryManager mm{1, pass::MemoryManager::allocation_scheme::BEST_FIT};
+
+    EXPECT_EQ(0, mm.allocate(30));
+    EXPECT_EQ(30, mm.allocate(10));
+    EXPECT_EQ(40, mm.allocate(10));
+    EXPECT_EQ(50, mm.allocate(10));
+    EXPECT_EQ(60, mm.allocate(10));
+
+    mm.free(0);
+    mm.free(40);
+
+    // The 10 byte hole fits better than the 30 byte one
+    EXPECT_EQ(40, mm.allocate(8));
+    EXPECT_EQ(0, mm.allocate(20));
+    EXPECT_EQ(48, mm.allocate(2));
+    EXPECT_EQ(20, mm.allocate(10));
+    EXPECT_EQ(70, mm.allocate(1));
+    EXPECT_EQ(mm.max_allocated(), 71);
+}
+
+TEST(memory_manager, free_merges_neighbors)
+{
+    pass::MemoryManager mm{1};
+
+    EXPECT_EQ(0, mm.allocate(10));
+    EXPECT_EQ(10, mm.allocate(10));
+    EXPECT_EQ(20, mm.allocate(10));
+
+    mm.free(0);
+    mm.free(20);
+    mm.free(10);
+    EXPECT_EQ(1, mm.get_node_list().size());
+    EXPECT_THROW(mm.free(10), std::runtime_error);
+    EXPECT_EQ(0, mm.allocate(25));
+}
+
+TEST(memory_planner, disjoint_lifetimes)
+{
+    pass::MemoryPlanner planner{1};
+
+    auto b0 = planner.add_buffer(10, 0, 1);
+    auto b1 = planner.add_buffer(10, 2, 3);
+    auto b2 = planner.add_buffer(10, 4, 5);
+    planner.plan();
+
+    EXPECT_EQ(0, planner.get_offset(b0));
+    EXPECT_EQ(0, planner.get_offset(b1));
+    EXPECT_EQ(0, planner.get_offset(b2));
+    EXPECT_EQ(10, planner.max_allocated());
+}
+
+TEST(memory_planner, overlapping_lifetimes)
+{
+    pass::MemoryPlanner planner{8};
+
+    auto b0 = planner.add_buffer(32, 0, 2);
+    auto b1 = planner.add_buffer(16, 1, 3);
+    // Lifetimes are inclusive, so b2 overlaps b1 but not b0
+    auto b2 = planner.add_buffer(30, 3, 4);
+    auto b3 = planner.add_buffer(4, 0);
+    planner.set_last_use(b3, 0);
+    planner.plan();
+
+    EXPECT_EQ(0, planner.get_offset(b0));
+    EXPECT_EQ(32, planner.get_offset(b1));
+    EXPECT_EQ(0, planner.get_offset(b2));
+    EXPECT_EQ(32, planner.get_offset(b3));
+    EXPECT_EQ(48, planner.max_allocated());
+}
+
+TEST(memory_planner, reuse_dead_buffer)
+{
+    pass::MemoryPlanner planner{1};
+
+    auto b0 = planner.add_buffer(40, 0, 0);
+    auto b1 = planner.add_buffer(30, 0, 10);
+    auto b2 = planner.add_buffer(20, 1, 10);
+    auto b3 = planner.add_buffer(10, 1, 10);
+    planner.plan();
+
+    // b0 is dead when b2 and b3 are live, leaving a 40 byte hole below b1
+    EXPECT_EQ(0, planner.get_offset(b0));
+    EXPECT_EQ(40, planner.get_offset(b1));
+    EXPECT_EQ(0, planner.get_offset(b2));
+    EXPECT_EQ(20, planner.get_offset(b3));
+    EXPECT_EQ(70, planner.max_allocated());
+}
+
+TEST(memory_planner, random_lifetimes_do_not_alias)
+{
+    mt19937 rng(0);
+    uniform_int_distribution<size_t> size_dist(1, 1000);
+    uniform_int_distribution<size_t> time_dist(0, 200);
+    uniform_int_distribution<size_t> length_dist(0, 20);
+    pass::MemoryPlanner planner{64};
+    vector<size_t> sizes;
+    vector<pair<size_t, size_t>> lifetimes;
+    for (size_t i = 0; i < 500; i++)
+    {
+        size_t first_use = time_dist(rng);
+        sizes.push_back(size_dist(rng));
+        lifetimes.push_back({first_use, first_use + length_dist(rng)});
+        planner.add_buffer(sizes.back(), lifetimes.back().first, lifetimes.back().second);
+    }
+    planner.plan();
+
+    size_t max_end = 0;
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        EXPECT_EQ(0, planner.get_offset(i) % 64);
+        max_end = max(max_end, planner.get_offset(i) + sizes[i]);
+        for (size_t j = 0; j < i; j++)
+        {
+            bool live_together = lifetimes[i].first <= lifetimes[j].second &&
+                                 lifetimes[j].first <= lifetimes[i].second;
+            bool overlap = planner.get_offset(i) < planner.get_offset(j) + sizes[j] &&
+                           planner.get_offset(j) < planner.get_offset(i) + sizes[i];
+            EXPECT_FALSE(live_together && overlap) << "buffers " << i << " and " << j;
+        }
+    }
+    EXPECT_LE(max_end, planner.max_allocated());
+}
+
 TEST(memory_layout, basic)
 {
     string dump_file = "memory_layout.txt";
@@ -236,3 +363,38 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_layout, offline)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, false, true);
+
+    auto graph = make_test_graph();
+    pass_manager.run_passes(graph);
+    EXPECT_LE(graph->get_temporary_pool_size(), 12);
+
+    // Tensors that are live at the same time must not overlap
+    vector<descriptor::Tensor*> live;
+    for (shared_ptr<Node> node : graph->get_ordered_ops())
+    {
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            live.push_back(tensor);
+        }
+        for (size_t i = 0; i < live.size(); i++)
+        {
+            for (size_t j = i + 1; j < live.size(); j++)
+            {
+                EXPECT_TRUE(live[i]->get_pool_offset() + live[i]->size() <=
+                                live[j]->get_pool_offset() ||
+                            live[j]->get_pool_offset() + live[j]->size() <=
+                                live[i]->get_pool_offset());
+            }
+        }
+        for (descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            live.erase(find(live.begin(), live.end(), tensor));
+        }
+    }
+}
@@ -763,6 +763,33 @@ TEST(pattern, recurrent_graph_rewrite)
     }
 }
 
+TEST(pattern, recurrent_graph_rewrite_many_chains)
+{
+    Shape shape{};
+    pass::Manager pass_manager;
+    pass_manager.register_pass<TestRecurrentGraphRewrite>();
+
+    auto iconst0 = construct_constant_node(0);
+    op::ParameterVector params;
+    NodeVector results;
+    for (size_t i = 0; i < 4; i++)
+    {
+        auto p = make_shared<op::Parameter>(element::i32, shape);
+        params.push_back(p);
+        results.push_back(std::make_shared<op::Abs>((p + iconst0) + iconst0));
+    }
+
+    auto f = std::make_shared<Function>(results, params);
+    pass_manager.run_passes(f);
+
+    // Every chain is collapsed in a single run of the pass
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        ASSERT_EQ(results.at(i)->get_argument(0), params.at(i));
+    }
+    ASSERT_EQ(count_ops_of_type<op::Add>(f), 0);
+}
+
 TEST(pattern, label_on_skip)
 {
     Shape shape{2, 2};
@@ -23,6 +23,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/pass/manager.hpp"
 #include "ngraph/runtime/cpu/op/dequantize.hpp"
 #include "ngraph/runtime/cpu/op/quantize.hpp"
 #include "ngraph/runtime/cpu/op/quantized_avg_pool.hpp"
@@ -30,6 +31,8 @@
 #include "ngraph/runtime/cpu/op/quantized_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/quantized_conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/quantized_max_pool.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_quantization.hpp"
+#include "ngraph/runtime/cpu/quantization_calibrator.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
@@ -538,3 +541,106 @@ TEST(quantize_cpu, quantizedConv2D_with_bias_and_relu)
     EXPECT_EQ((vector<float>{20.0}), read_vector<float>(result_min));
     EXPECT_EQ((vector<float>{-24.0}), read_vector<float>(result_max));
 }
+
+TEST(quantize_cpu, calibration_ranges)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto relu = make_shared<op::Relu>(A);
+    auto f = make_shared<Function>(relu, op::ParameterVector{A});
+    auto backend = runtime::Backend::create("CPU");
+
+    runtime::cpu::QuantizationCalibrator calibrator(f, backend);
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{-1.5f, 0.5f, 2.0f, 0.0f, 1.0f, -0.5f});
+    calibrator.calibrate({a});
+    copy_data(a, vector<float>{-0.5f, 0.5f, 3.0f, 0.0f, 1.0f, -0.5f});
+    calibrator.calibrate({a});
+
+    auto& ranges = calibrator.get_ranges();
+    EXPECT_EQ(-1.5f, ranges.at(A).min);
+    EXPECT_EQ(3.0f, ranges.at(A).max);
+    EXPECT_EQ(0.0f, ranges.at(relu).min);
+    EXPECT_EQ(3.0f, ranges.at(relu).max);
+    // Calibration runs on a clone, so the function keeps its single result
+    EXPECT_EQ(1, relu->get_users().size());
+}
+
+TEST(quantize_cpu, quantize_conv_pool_chain)
+{
+    Shape shape_a{2, 2, 8, 8};
+    Shape shape_w1{4, 2, 3, 3};
+    Shape shape_w2{3, 4, 3, 3};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> w1(shape_size(shape_w1));
+    vector<float> w2(shape_size(shape_w2));
+    rng.initialize(w1);
+    rng.initialize(w2);
+    vector<float> bias{0.1f, -0.2f, 0.3f, 0.0f};
+
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        auto conv1 = make_shared<op::Convolution>(A,
+                                                  op::Constant::create(element::f32, shape_w1, w1),
+                                                  Strides{1, 1},
+                                                  Strides{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  CoordinateDiff{1, 1});
+        auto bias1 = make_shared<op::Broadcast>(op::Constant::create(element::f32, Shape{4}, bias),
+                                                conv1->get_shape(),
+                                                AxisSet{0, 2, 3});
+        auto relu1 = make_shared<op::Relu>(conv1 + bias1);
+        auto pool1 = make_shared<op::MaxPool>(relu1, Shape{2, 2}, Strides{2, 2});
+        auto conv2 = make_shared<op::Convolution>(pool1,
+                                                  op::Constant::create(element::f32, shape_w2, w2),
+                                                  Strides{1, 1},
+                                                  Strides{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  CoordinateDiff{1, 1});
+        auto relu2 = make_shared<op::Relu>(conv2);
+        auto pool2 = make_shared<op::AvgPool>(relu2, Shape{2, 2}, Strides{2, 2});
+        return make_shared<Function>(pool2, op::ParameterVector{A});
+    };
+    auto f_ref = make_function();
+    auto f = make_function();
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape_a);
+    test::Uniform<float> input_rng(0.0f, 1.0f, 2);
+    {
+        runtime::cpu::QuantizationCalibrator calibrator(f, backend);
+        for (size_t i = 0; i < 4; i++)
+        {
+            input_rng.initialize(a);
+            calibrator.calibrate({a});
+        }
+        pass::Manager pass_manager;
+        pass_manager.register_pass<runtime::cpu::pass::CPUQuantization>(calibrator.get_ranges());
+        pass_manager.run_passes(f);
+    }
+
+    // One region from the quantized input to the dequantized result
+    EXPECT_EQ(count_ops_of_type<op::Convolution>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::QuantizeCPU>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedConvolutionBias>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedMaxPool>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedConvolutionRelu>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedAvgPool>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::DequantizeCPU>(f), 1);
+
+    input_rng.initialize(a);
+    auto expected = backend->create_tensor(element::f32, f_ref->get_output_shape(0));
+    auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+    backend->call_with_validate(f_ref, {expected}, {a});
+    backend->call_with_validate(f, {result}, {a});
+
+    // Two 8-bit layers stay within a few output levels of the f32 result
+    auto expected_values = read_vector<float>(expected);
+    auto result_values = read_vector<float>(result);
+    float max_abs = 0.0f;
+    for (auto v : expected_values)
+    {
+        max_abs = std::max(max_abs, std::abs(v));
+    }
+    EXPECT_TRUE(test::all_close(expected_values, result_values, 0.0f, 0.05f * max_abs));
+}
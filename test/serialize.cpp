@@ -158,6 +158,50 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, constant_bf16)
+{
+    auto A = op::Constant::create(element::bf16, Shape{4}, {1.0f, -2.5f, 0.1f, 300.0f});
+    auto f = make_shared<Function>(A, op::ParameterVector{});
+    vector<bfloat16> expected{1.0f, -2.5f, 0.1f, 300.0f};
+    EXPECT_EQ(expected, A->get_vector<bfloat16>());
+
+    auto g = deserialize(serialize(f));
+    ASSERT_NE(g, nullptr);
+    auto c = dynamic_pointer_cast<op::Constant>(g->get_results().at(0)->get_argument(0));
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(element::bf16, c->get_element_type());
+    EXPECT_EQ(expected, c->get_vector<bfloat16>());
+}
+
+TEST(serialize, constant_mapped)
+{
+    const string tmp_file = "serialize_constant_mapped.cpio";
+    auto A = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto B = op::Constant::create(element::i8, Shape{3}, {-1, 0, 1});
+    auto C = op::Constant::create(element::f64, Shape{2}, {0.5, 0.25});
+    auto f = make_shared<Function>(NodeVector{A, B, C}, op::ParameterVector{});
+    serialize(tmp_file, f);
+
+    auto g = deserialize_mapped(tmp_file);
+    ASSERT_NE(g, nullptr);
+    ASSERT_EQ(g->get_output_size(), 3);
+    auto get_constant = [](const shared_ptr<Function>& func, size_t i) {
+        return dynamic_pointer_cast<op::Constant>(
+            func->get_output_op(i)->get_argument(0));
+    };
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), get_constant(g, 0)->get_vector<float>());
+    EXPECT_EQ((vector<int8_t>{-1, 0, 1}), get_constant(g, 1)->get_vector<int8_t>());
+    EXPECT_EQ((vector<double>{0.5, 0.25}), get_constant(g, 2)->get_vector<double>());
+
+    // Copies share the mapped data and keep it alive after the original is gone
+    auto h = clone_function(*g);
+    g = nullptr;
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), get_constant(h, 0)->get_vector<float>());
+    EXPECT_EQ((vector<double>{0.5, 0.25}), get_constant(h, 2)->get_vector<double>());
+    h = nullptr;
+    file_util::remove_file(tmp_file);
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <numeric>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/specialized_function_cache.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Returns A * W for A of shape {batch, 3} and a constant W of shape {3, 2}, built with batch 2
+static shared_ptr<Function> make_batched_dot()
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto W = op::Constant::create(element::f32, Shape{3, 2}, {1, 2, 3, 4, 5, 6});
+    return make_shared<Function>(make_shared<op::Dot>(A, W), op::ParameterVector{A});
+}
+
+// The expected result of make_batched_dot for an input filled with 0, 1, 2, ...
+static vector<float> batched_dot_result(size_t batch)
+{
+    vector<float> result;
+    for (size_t i = 0; i < batch; i++)
+    {
+        float a0 = 3 * i, a1 = 3 * i + 1, a2 = 3 * i + 2;
+        result.push_back(a0 * 1 + a1 * 3 + a2 * 5);
+        result.push_back(a0 * 2 + a1 * 4 + a2 * 6);
+    }
+    return result;
+}
+
+static vector<float> call_batched_dot(runtime::Backend& backend,
+                                      runtime::SpecializedFunctionCache& cache,
+                                      size_t batch)
+{
+    vector<float> input(batch * 3);
+    iota(input.begin(), input.end(), 0);
+    auto a = backend.create_tensor(element::f32, Shape{batch, 3});
+    copy_data(a, input);
+    vector<Shape> output_shapes = cache.get_output_shapes({Shape{batch, 3}});
+    EXPECT_EQ(output_shapes, vector<Shape>{(Shape{batch, 2})});
+    auto result = backend.create_tensor(element::f32, output_shapes.at(0));
+    cache.call({result}, {a});
+    return read_vector<float>(result);
+}
+
+TEST(specialized_function_cache, reuse)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::SpecializedFunctionCache cache(
+        backend, make_batched_dot(), {PartialShape{Dimension::undetermined(), 3}});
+
+    EXPECT_EQ(call_batched_dot(*backend, cache, 2), batched_dot_result(2));
+    EXPECT_EQ(call_batched_dot(*backend, cache, 5), batched_dot_result(5));
+    EXPECT_EQ(call_batched_dot(*backend, cache, 2), batched_dot_result(2));
+    EXPECT_EQ(cache.get_compile_count(), 2);
+    EXPECT_EQ(cache.get_cached_count(), 2);
+}
+
+TEST(specialized_function_cache, evict_least_recently_used)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::SpecializedFunctionCache cache(
+        backend, make_batched_dot(), {PartialShape{Dimension::undetermined(), 3}}, 2);
+
+    call_batched_dot(*backend, cache, 1);
+    call_batched_dot(*backend, cache, 2);
+    call_batched_dot(*backend, cache, 1);
+    // Evicts batch 2, which was used least recently
+    call_batched_dot(*backend, cache, 3);
+    EXPECT_EQ(cache.get_cached_count(), 2);
+    EXPECT_EQ(cache.get_compile_count(), 3);
+
+    EXPECT_EQ(call_batched_dot(*backend, cache, 1), batched_dot_result(1));
+    EXPECT_EQ(cache.get_compile_count(), 3);
+    EXPECT_EQ(call_batched_dot(*backend, cache, 2), batched_dot_result(2));
+    EXPECT_EQ(cache.get_compile_count(), 4);
+}
+
+TEST(specialized_function_cache, pad_to_power_of_two)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::SpecializedFunctionCache cache(
+        backend, make_batched_dot(), {PartialShape{Dimension::undetermined(), 3}}, 8, true);
+
+    for (size_t batch = 5; batch <= 8; batch++)
+    {
+        EXPECT_EQ(call_batched_dot(*backend, cache, batch), batched_dot_result(batch));
+    }
+    EXPECT_EQ(cache.get_compile_count(), 1);
+    EXPECT_EQ(call_batched_dot(*backend, cache, 3), batched_dot_result(3));
+    EXPECT_EQ(cache.get_compile_count(), 2);
+}
+
+TEST(specialized_function_cache, incompatible_shape)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::SpecializedFunctionCache cache(
+        backend, make_batched_dot(), {PartialShape{Dimension::undetermined(), 3}});
+
+    EXPECT_THROW(cache.get_output_shapes({Shape{2, 4}}), ngraph_error);
+    EXPECT_THROW(cache.get_output_shapes({Shape{2, 3}, Shape{2, 3}}), ngraph_error);
+    EXPECT_THROW(runtime::SpecializedFunctionCache(
+                     backend, make_batched_dot(), {PartialShape{Dimension::undetermined(), 4}}),
+                 ngraph_error);
+}